@@ -0,0 +1,75 @@
+"""Count the heap allocations per integration step of a single-arc propagation.
+
+Requires a kernel module built with the CMake option TUDATPY_COUNT_ALLOCATIONS=ON
+(see include/tudatpy/allocationCounter.h).
+
+The allocations are also given per evaluation of the state derivative. The propagation loop of tudatpy reuses the
+buffers of the simulator (see StepwisePropagationBuffers), so that the allocations that remain are made by Tudat:
+the state derivative, which is returned by value (at least one allocation per evaluation), and the saving of results
+and dependent variables.
+"""
+import numpy as np
+
+from tudatpy import kernel
+from tudatpy.kernel.interface import spice
+from tudatpy.kernel.numerical_simulation import SingleArcStepwiseSimulator
+from tudatpy.kernel.numerical_simulation import environment_setup, propagation_setup
+
+if not kernel._is_heap_allocation_counting_enabled():
+    raise RuntimeError("kernel module is not built with TUDATPY_COUNT_ALLOCATIONS=ON")
+
+spice.load_standard_kernels()
+
+bodies_to_create = ["Earth", "Moon", "Sun"]
+body_settings = environment_setup.get_default_body_settings(bodies_to_create, "Earth", "J2000")
+bodies = environment_setup.create_system_of_bodies(body_settings)
+bodies.create_empty_body("Vehicle")
+
+acceleration_settings = {
+    "Vehicle": {
+        "Earth": [propagation_setup.acceleration.spherical_harmonic_gravity(8, 8)],
+        "Moon": [propagation_setup.acceleration.point_mass_gravity()],
+        "Sun": [propagation_setup.acceleration.point_mass_gravity()],
+    }
+}
+acceleration_models = propagation_setup.create_acceleration_models(
+    bodies, acceleration_settings, ["Vehicle"], ["Earth"])
+
+initial_state = np.array([7.0E6, 0.0, 0.0, 0.0, 7.5E3, 1.0E3])
+number_of_steps = 10000
+step_size = 10.0
+
+
+def count_allocations_per_step(save_frequency_in_steps, dependent_variables):
+    processing_settings = propagation_setup.propagator.ExtendedSingleArcPropagatorProcessingSettings()
+    processing_settings.results_save_frequency_in_steps = save_frequency_in_steps
+    propagator_settings = propagation_setup.propagator.translational(
+        ["Earth"], acceleration_models, ["Vehicle"], initial_state, 0.0,
+        propagation_setup.integrator.runge_kutta_4(step_size),
+        propagation_setup.propagator.time_termination(2.0 * number_of_steps * step_size),
+        output_variables=dependent_variables,
+        processing_settings=processing_settings)
+
+    dynamics_simulator = SingleArcStepwiseSimulator(bodies, propagator_settings)
+    dynamics_simulator.initialize_propagation()
+    assert dynamics_simulator.is_integrated_state_size_fixed
+
+    # Skip the first steps, in which buffers of the models are created
+    dynamics_simulator.step(100)
+    initial_number_of_allocations = kernel._get_number_of_heap_allocations()
+    initial_number_of_evaluations = dynamics_simulator.total_number_of_function_evaluations
+    dynamics_simulator.step(number_of_steps)
+    number_of_allocations = kernel._get_number_of_heap_allocations() - initial_number_of_allocations
+    number_of_evaluations = dynamics_simulator.total_number_of_function_evaluations - initial_number_of_evaluations
+    return number_of_allocations / number_of_steps, number_of_allocations / number_of_evaluations
+
+
+dependent_variables = [
+    propagation_setup.dependent_variable.keplerian_state("Vehicle", "Earth"),
+    propagation_setup.dependent_variable.total_acceleration("Vehicle")]
+
+print("Heap allocations (RK4, %d steps)           per step  per evaluation" % number_of_steps)
+print("  results saved every step:         %8.1f  %8.2f" % count_allocations_per_step(1, []))
+print("  results saved every 1000 steps:   %8.1f  %8.2f" % count_allocations_per_step(1000, []))
+print("  with dependent variables, saved:  %8.1f  %8.2f" % count_allocations_per_step(1, dependent_variables))
+print("  with dependent variables, sparse: %8.1f  %8.2f" % count_allocations_per_step(1000, dependent_variables))
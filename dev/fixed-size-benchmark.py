@@ -0,0 +1,64 @@
+"""Compare the propagation of a single-body Cartesian state with fixed-size and dynamic-size integrated states.
+
+create_dynamics_simulator integrates such a state with fixed-size types (see isFixedSizeStepwisePropagation in
+include/tudatpy/stepwiseDynamicsSimulator.h); the SingleArcSimulator of Tudat, created directly, integrates it as a
+dynamic-size state. The CPU time per integration step is reported for both, and the number of heap allocations per
+step if the kernel module is built with the CMake option TUDATPY_COUNT_ALLOCATIONS=ON.
+"""
+import time
+
+import numpy as np
+
+from tudatpy import kernel
+from tudatpy.kernel import numerical_simulation
+from tudatpy.kernel.interface import spice
+from tudatpy.kernel.numerical_simulation import environment_setup, propagation_setup
+
+spice.load_standard_kernels()
+
+bodies_to_create = ["Earth", "Moon", "Sun"]
+body_settings = environment_setup.get_default_body_settings(bodies_to_create, "Earth", "J2000")
+bodies = environment_setup.create_system_of_bodies(body_settings)
+bodies.create_empty_body("Vehicle")
+
+acceleration_settings = {
+    "Vehicle": {
+        "Earth": [propagation_setup.acceleration.spherical_harmonic_gravity(8, 8)],
+        "Moon": [propagation_setup.acceleration.point_mass_gravity()],
+        "Sun": [propagation_setup.acceleration.point_mass_gravity()],
+    }
+}
+acceleration_models = propagation_setup.create_acceleration_models(
+    bodies, acceleration_settings, ["Vehicle"], ["Earth"])
+
+initial_state = np.array([7.0E6, 0.0, 0.0, 0.0, 7.5E3, 1.0E3])
+number_of_steps = 100000
+step_size = 10.0
+integrator_settings = propagation_setup.integrator.runge_kutta_fixed_step_size(
+    step_size, propagation_setup.integrator.CoefficientSets.rkf_78)
+propagator_settings = propagation_setup.propagator.translational(
+    ["Earth"], acceleration_models, ["Vehicle"], initial_state, 0.0, integrator_settings,
+    propagation_setup.propagator.time_termination(number_of_steps * step_size))
+
+
+def benchmark(create_simulator):
+    initial_number_of_allocations = kernel._get_number_of_heap_allocations()
+    start_time = time.perf_counter()
+    dynamics_simulator = create_simulator()
+    time_per_step = (time.perf_counter() - start_time) / number_of_steps
+    allocations_per_step = (kernel._get_number_of_heap_allocations() - initial_number_of_allocations) / number_of_steps
+    final_state = dynamics_simulator.propagation_results.state_history[number_of_steps * step_size]
+    return time_per_step, allocations_per_step, final_state
+
+
+fixed_size_results = benchmark(
+    lambda: numerical_simulation.create_dynamics_simulator(bodies, propagator_settings))
+dynamic_size_results = benchmark(
+    lambda: numerical_simulation.SingleArcSimulator(bodies, integrator_settings, propagator_settings))
+
+print("Single-body propagation (RKF7(8) fixed step, %d steps)" % number_of_steps)
+print("                      time per step [us]  allocations per step")
+for name, results in [("fixed-size state", fixed_size_results), ("dynamic-size state", dynamic_size_results)]:
+    allocations = ("%8.1f" % results[1]) if kernel._is_heap_allocation_counting_enabled() else "     n/a"
+    print("  %-18s  %18.2f  %20s" % (name, 1.0E6 * results[0], allocations))
+print("Maximum difference in final position [m]: %.3e" % np.max(np.abs(fixed_size_results[2][:3] - dynamic_size_results[2][:3])))
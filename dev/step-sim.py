@@ -1,11 +1,18 @@
-class DynamicsSimulator:
-    pass
+from tudatpy.kernel import numerical_simulation
+
+
+class Guidance:
+    # guidance parameters are read by the (custom) thrust models of the
+    # propagation, and may be changed in between integration steps
+    thrust_direction = None
+    thrust_magnitude = 0.0
 
 
-# # Create simulation object and propagate dynamics.
-dynamics_simulator = propagation_setup.SingleArcDynamicsSimulator(
+guidance = Guidance()
+
+# # Create simulation object, without propagating the dynamics on creation.
+dynamics_simulator = numerical_simulation.SingleArcStepwiseSimulator(
     bodies,
-    integrator_settings,
     propagator_settings
 )
 
@@ -14,23 +21,22 @@ def guidance_algorithm(r1, r2, v1, v2):
     # do some fancy magic here
     pass
 
-terminated = False
-
-while not terminated:
-    # standard step for retrieving the three pillars of tudat simulations
-    environment, propagation, estimation = dynamics_simulator.step()
+dynamics_simulator.initialize_propagation()
 
-    # check if state is terminal according to propagator
-    terminated = propagation.propagator.state
+while not dynamics_simulator.is_terminated:
+    # take a single integrator step; the environment is updated to the
+    # current state after the step
+    dynamics_simulator.step()
 
     # retrieve algorithm dependent variables from environment
-    r1, v1 = environment.bodies.asteroid.state_vectors
-    r2, v2 = environment.bodies.spacecraft.state_vectors
+    r1, v1 = bodies.get("Asteroid").position, bodies.get("Asteroid").velocity
+    r2, v2 = bodies.get("Spacecraft").position, bodies.get("Spacecraft").velocity
 
     # retrieve current guidance according to environment state
     direction, magnitude = guidance_algorithm(r1, r2, v1, v2)
 
-    # set newly updated thrust settings
-    dynamics_simulator.propagation.bodies.spacecraft.set_thrust(
-        direction=direction,
-        magnitude=magnitude)
+    # set newly updated thrust settings, used from the next step onwards
+    guidance.thrust_direction = direction
+    guidance.thrust_magnitude = magnitude
+
+state_history = dynamics_simulator.state_history
@@ -0,0 +1,97 @@
+/*    Copyright (c) 2010-2022, Delft University of Technology
+ *    All rights reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ */
+
+#ifndef TUDATPY_ALLOCATION_COUNTER_H
+#define TUDATPY_ALLOCATION_COUNTER_H
+
+/*!
+ * Counter of the heap allocations made by the kernel module, for allocation benchmarks. Counting is only compiled in
+ * when the module is built with the CMake option TUDATPY_COUNT_ALLOCATIONS, in which case this header is included
+ * before any other header in each source file of the module (so that it precedes the Eigen headers). Two types of
+ * allocations are counted:
+ *
+ *  - calls of the global operator new (std containers, std::function, shared pointers, ...), which is replaced in
+ *    kernel.cpp
+ *  - heap allocations of Eigen (aligned_malloc, conditional_aligned_malloc and their realloc counterparts, which use
+ *    malloc instead of operator new), including those made when a matrix is resized. These are counted through the EIGEN_RUNTIME_NO_MALLOC check
+ *    that Eigen performs in each of these allocations: heap allocations of Eigen are 'forbidden' when the module is
+ *    loaded (see kernel.cpp), and the assertion that Eigen makes in each of them is replaced by a function that counts
+ *    it (see handleEigenAssertion). Constructors, copies and in-place assignments that do not allocate are not counted.
+ *
+ * The counts are therefore exact for the template code compiled into the module, but Eigen matrices allocated in
+ * precompiled (non-template) Tudat code are not counted.
+ */
+
+#include <atomic>
+#include <cassert>
+#include <cstdint>
+#include <cstring>
+
+namespace tudatpy
+{
+
+//! Function to retrieve the counter of heap allocations
+inline std::atomic< std::uint64_t >& getHeapAllocationCounter( )
+{
+    static std::atomic< std::uint64_t > heapAllocationCounter( 0 );
+    return heapAllocationCounter;
+}
+
+//! Function to add a single allocation to the counter of heap allocations
+inline void countHeapAllocation( )
+{
+    getHeapAllocationCounter( ).fetch_add( 1, std::memory_order_relaxed );
+}
+
+//! Function replacing the assertions of Eigen, which counts the heap allocations checked by EIGEN_RUNTIME_NO_MALLOC
+/*!
+ * Function replacing the assertions of Eigen (eigen_assert) when counting is enabled, called only when an assertion
+ * fails. The assertion made by Eigen in each heap allocation (which fails, since heap allocations of Eigen are
+ * 'forbidden') is counted as an allocation; other failed assertions are handled as by the assert of the standard
+ * library (as Eigen does by default).
+ * \param condition Text of the condition of the failed assertion
+ */
+inline void handleEigenAssertion( const char* condition )
+{
+    if( std::strstr( condition, "heap allocation is forbidden" ) != nullptr )
+    {
+        countHeapAllocation( );
+    }
+    else
+    {
+        assert( false && "Eigen assertion failed" );
+    }
+}
+
+//! Function to retrieve the number of heap allocations made by the kernel module (0 if counting is not enabled)
+inline std::uint64_t getNumberOfHeapAllocations( )
+{
+    return getHeapAllocationCounter( ).load( std::memory_order_relaxed );
+}
+
+//! Function to check whether the kernel module is built with counting of heap allocations
+inline bool isHeapAllocationCountingEnabled( )
+{
+#ifdef TUDATPY_COUNT_ALLOCATIONS
+    return true;
+#else
+    return false;
+#endif
+}
+
+} // namespace tudatpy
+
+#ifdef TUDATPY_COUNT_ALLOCATIONS
+#define EIGEN_RUNTIME_NO_MALLOC
+#define eigen_assert( condition ) \
+    ( static_cast< bool >( condition ) ? static_cast< void >( 0 ) : ::tudatpy::handleEigenAssertion( #condition ) )
+#endif
+
+#endif // TUDATPY_ALLOCATION_COUNTER_H
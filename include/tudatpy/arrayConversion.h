@@ -0,0 +1,221 @@
+/*    Copyright (c) 2010-2022, Delft University of Technology
+ *    All rights reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ */
+
+#ifndef TUDATPY_ARRAY_CONVERSION_H
+#define TUDATPY_ARRAY_CONVERSION_H
+
+#include <algorithm>
+#include <map>
+#include <stdexcept>
+#include <vector>
+
+#include <Eigen/Core>
+
+#include <pybind11/pybind11.h>
+#include <pybind11/numpy.h>
+
+#include "tudatpy/propagationResultSink.h"
+
+namespace tudatpy
+{
+
+//! Function to wrap a buffer of doubles, allocated with new[], in a NumPy array that takes ownership of the buffer
+/*!
+ * Function to wrap a buffer of doubles, allocated with new[], in a (row-major) NumPy array that takes ownership of the
+ * buffer, so that no copy of the data is made when the array is handed to Python.
+ * \param data Buffer containing the array entries (in row-major order), allocated with new[]
+ * \param numberOfRows Number of rows of the array
+ * \param numberOfColumns Number of columns of the array
+ * \return NumPy array of size numberOfRows x numberOfColumns, viewing (and owning) the buffer
+ */
+inline pybind11::array_t< double > wrapBufferInArray( double* data,
+                                                      const std::size_t numberOfRows,
+                                                      const std::size_t numberOfColumns )
+{
+    pybind11::capsule bufferOwner( data, []( void* buffer ) { delete[] static_cast< double* >( buffer ); } );
+    return pybind11::array_t< double >(
+                { numberOfRows, numberOfColumns },
+                { numberOfColumns * sizeof( double ), sizeof( double ) },
+                data, bufferOwner );
+}
+
+//! Function to convert a time history of vectors to a single contiguous two-dimensional NumPy array
+/*!
+ * Function to convert a time history of vectors (as used for state and dependent variable histories) to a single
+ * contiguous two-dimensional NumPy array, in which each row contains the time (if requested) followed by the entries of
+ * the vector at that time. All entries are copied once, directly from the map into the buffer owned by the returned
+ * array, without creating any intermediate Python objects.
+ * \param history Time history of vectors to convert; all vectors must be of equal size
+ * \param addEpochColumn Boolean denoting whether the first column of the array is to contain the epochs
+ * \return NumPy array of size N x (n + 1) (or N x n if addEpochColumn is false) with N the number of epochs and n the
+ * size of the vectors
+ */
+template< typename TimeType, typename StateScalarType, int NumberOfRows, int NumberOfColumns >
+pybind11::array_t< double > convertTimeHistoryToArray(
+        const std::map< TimeType, Eigen::Matrix< StateScalarType, NumberOfRows, NumberOfColumns > >& history,
+        const bool addEpochColumn = true )
+{
+    const std::size_t numberOfEpochs = history.size( );
+    const std::size_t vectorSize = ( numberOfEpochs > 0 ) ? history.begin( )->second.size( ) : 0;
+    const std::size_t epochColumnSize = addEpochColumn ? 1 : 0;
+    const std::size_t numberOfArrayColumns = vectorSize + epochColumnSize;
+
+    double* data = new double[ numberOfEpochs * numberOfArrayColumns ];
+    double* currentRow = data;
+    for( auto historyIterator = history.begin( ); historyIterator != history.end( ); historyIterator++ )
+    {
+        if( static_cast< std::size_t >( historyIterator->second.size( ) ) != vectorSize )
+        {
+            delete[] data;
+            throw std::runtime_error( "Error when converting time history to array, vector sizes are inconsistent" );
+        }
+
+        if( addEpochColumn )
+        {
+            currentRow[ 0 ] = static_cast< double >( historyIterator->first );
+        }
+        Eigen::Map< Eigen::Matrix< double, Eigen::Dynamic, 1 > >( currentRow + epochColumnSize, vectorSize ) =
+                historyIterator->second.template cast< double >( );
+        currentRow += numberOfArrayColumns;
+    }
+
+    return wrapBufferInArray( data, numberOfEpochs, numberOfArrayColumns );
+}
+
+//! Function to retrieve the epochs of a time history as a one-dimensional NumPy array
+template< typename TimeType, typename ValueType >
+pybind11::array_t< double > getTimeHistoryEpochs( const std::map< TimeType, ValueType >& history )
+{
+    pybind11::array_t< double > epochs( history.size( ) );
+    double* data = epochs.mutable_data( );
+    for( auto historyIterator = history.begin( ); historyIterator != history.end( ); historyIterator++ )
+    {
+        *( data++ ) = static_cast< double >( historyIterator->first );
+    }
+    return epochs;
+}
+
+//! Function to stack a list of equally sized vectors into a single contiguous two-dimensional NumPy array
+/*!
+ * Function to stack a list of equally sized vectors into a single contiguous two-dimensional NumPy array, in which
+ * row i contains the entries of vector i
+ * \param vectors Vectors to stack
+ * \return NumPy array of size N x n with N the number of vectors and n their size
+ */
+inline pybind11::array_t< double > stackVectorsInArray( const std::vector< Eigen::VectorXd >& vectors )
+{
+    const std::size_t numberOfVectors = vectors.size( );
+    const std::size_t vectorSize = ( numberOfVectors > 0 ) ? vectors.at( 0 ).size( ) : 0;
+
+    double* data = new double[ numberOfVectors * vectorSize ];
+    for( std::size_t i = 0; i < numberOfVectors; i++ )
+    {
+        if( static_cast< std::size_t >( vectors.at( i ).size( ) ) != vectorSize )
+        {
+            delete[] data;
+            throw std::runtime_error( "Error when stacking vectors in array, vector sizes are inconsistent" );
+        }
+        Eigen::Map< Eigen::VectorXd >( data + i * vectorSize, vectorSize ) = vectors.at( i );
+    }
+    return wrapBufferInArray( data, numberOfVectors, vectorSize );
+}
+
+//! Function to stack a list of equally sized matrices into a single contiguous three-dimensional NumPy array
+/*!
+ * Function to stack a list of equally sized matrices into a single contiguous three-dimensional NumPy array, in which
+ * entry [ i, :, : ] contains matrix i
+ * \param matrices Matrices to stack
+ * \return NumPy array of size N x r x c with N the number of matrices, and r x c their size
+ */
+inline pybind11::array_t< double > stackMatricesInArray( const std::vector< Eigen::MatrixXd >& matrices )
+{
+    const std::size_t numberOfMatrices = matrices.size( );
+    const std::size_t numberOfRows = ( numberOfMatrices > 0 ) ? matrices.at( 0 ).rows( ) : 0;
+    const std::size_t numberOfColumns = ( numberOfMatrices > 0 ) ? matrices.at( 0 ).cols( ) : 0;
+    const std::size_t matrixSize = numberOfRows * numberOfColumns;
+
+    double* data = new double[ numberOfMatrices * matrixSize ];
+    for( std::size_t i = 0; i < numberOfMatrices; i++ )
+    {
+        if( static_cast< std::size_t >( matrices.at( i ).rows( ) ) != numberOfRows ||
+                static_cast< std::size_t >( matrices.at( i ).cols( ) ) != numberOfColumns )
+        {
+            delete[] data;
+            throw std::runtime_error( "Error when stacking matrices in array, matrix sizes are inconsistent" );
+        }
+        Eigen::Map< Eigen::Matrix< double, Eigen::Dynamic, Eigen::Dynamic, Eigen::RowMajor > >(
+                    data + i * matrixSize, numberOfRows, numberOfColumns ) = matrices.at( i );
+    }
+
+    pybind11::capsule bufferOwner( data, []( void* buffer ) { delete[] static_cast< double* >( buffer ); } );
+    return pybind11::array_t< double >(
+                { numberOfMatrices, numberOfRows, numberOfColumns },
+                { matrixSize * sizeof( double ), numberOfColumns * sizeof( double ), sizeof( double ) },
+                data, bufferOwner );
+}
+
+//! Function to read the epochs and a single quantity (states or dependent variables) from a result sink file into an array
+/*!
+ * Function to read the epochs and a single quantity (states or dependent variables) for a range of rows from a result
+ * sink file into an array, with the same layout as the array returned by convertTimeHistoryToArray
+ * \param resultReader Reader for the result sink file
+ * \param startRow First row to read
+ * \param endRow Row after the last row to read
+ * \param readDependentVariables Boolean denoting whether the dependent variables (true) or states (false) are read
+ * \return NumPy array of size N x (n + 1), with N = endRow - startRow, and n the size of the quantity
+ */
+inline pybind11::array_t< double > readStreamedResultsToArray(
+        ChunkedResultReader& resultReader,
+        const std::size_t startRow,
+        const std::size_t endRow,
+        const bool readDependentVariables )
+{
+    if( endRow < startRow )
+    {
+        throw std::runtime_error( "Error when reading streamed results, end row is smaller than start row" );
+    }
+
+    const std::size_t numberOfRows = endRow - startRow;
+    const std::size_t numberOfValueColumns = readDependentVariables ?
+                resultReader.getDependentVariableSize( ) : resultReader.getStateSize( );
+
+    std::vector< double > epochs( numberOfRows );
+    std::vector< double > values( numberOfRows * numberOfValueColumns );
+    resultReader.readEpochs( startRow, endRow, epochs.data( ) );
+    if( readDependentVariables )
+    {
+        resultReader.readDependentVariables( startRow, endRow, values.data( ) );
+    }
+    else
+    {
+        resultReader.readStates( startRow, endRow, values.data( ) );
+    }
+
+    double* data = new double[ numberOfRows * ( numberOfValueColumns + 1 ) ];
+    for( std::size_t i = 0; i < numberOfRows; i++ )
+    {
+        data[ i * ( numberOfValueColumns + 1 ) ] = epochs.at( i );
+        std::copy( values.begin( ) + i * numberOfValueColumns, values.begin( ) + ( i + 1 ) * numberOfValueColumns,
+                   data + i * ( numberOfValueColumns + 1 ) + 1 );
+    }
+    return wrapBufferInArray( data, numberOfRows, numberOfValueColumns + 1 );
+}
+
+//! Function to read all epochs from a result sink file into a one-dimensional array
+inline pybind11::array_t< double > readStreamedEpochsToArray( ChunkedResultReader& resultReader )
+{
+    pybind11::array_t< double > epochs( resultReader.getNumberOfRows( ) );
+    resultReader.readEpochs( 0, resultReader.getNumberOfRows( ), epochs.mutable_data( ) );
+    return epochs;
+}
+
+} // namespace tudatpy
+
+#endif // TUDATPY_ARRAY_CONVERSION_H
@@ -0,0 +1,76 @@
+/*    Copyright (c) 2010-2022, Delft University of Technology
+ *    All rights reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ */
+
+#ifndef TUDATPY_BATCHED_INITIAL_STATES_H
+#define TUDATPY_BATCHED_INITIAL_STATES_H
+
+#include <cstddef>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include <Eigen/Core>
+
+#include "tudat/astro/ephemerides/frameManager.h"
+#include "tudat/simulation/environment_setup/body.h"
+#include "tudat/simulation/propagation_setup.h"
+
+namespace tudatpy
+{
+
+//! Function to compute the translational states of a set of bodies with respect to their central bodies at many epochs
+/*!
+ * Function to compute the translational states of a set of bodies with respect to their central bodies at many epochs,
+ * as computed by tudat::propagators::getInitialStatesOfBodies for a single epoch. The frame manager, which determines
+ * the chain of ephemerides between each body and its central body, is created once for all epochs instead of once per
+ * epoch. The epochs are processed in the order in which they are provided, so that (for tabulated ephemerides) the
+ * interpolator lookup of each epoch starts from that of the previous epoch; sorted epochs are therefore processed
+ * fastest.
+ * \param bodiesToPropagate Names of the bodies for which the states are computed
+ * \param centralBodies Names of the central bodies, with respect to which the states are computed
+ * \param bodies System of bodies from which the states are retrieved
+ * \param epochs Epochs at which the states are computed
+ * \param numberOfEpochs Number of epochs
+ * \param initialStates Buffer (of size numberOfEpochs x 6 * number of bodies) in which the states are written, with one
+ * row (in row-major order) per epoch, containing the concatenated states of all bodies
+ */
+template< typename TimeType = double, typename StateScalarType = double >
+void getInitialStatesOfBodiesAtEpochs(
+        const std::vector< std::string >& bodiesToPropagate,
+        const std::vector< std::string >& centralBodies,
+        const tudat::simulation_setup::SystemOfBodies& bodies,
+        const double* epochs,
+        const std::size_t numberOfEpochs,
+        double* initialStates )
+{
+    if( bodiesToPropagate.size( ) != centralBodies.size( ) )
+    {
+        throw std::runtime_error( "Error when computing initial states at epochs, number of propagated bodies (" +
+                                  std::to_string( bodiesToPropagate.size( ) ) + ") and central bodies (" +
+                                  std::to_string( centralBodies.size( ) ) + ") is not equal" );
+    }
+
+    const std::shared_ptr< tudat::ephemerides::ReferenceFrameManager > frameManager =
+            tudat::simulation_setup::createFrameManager( bodies.getMap( ) );
+
+    const std::size_t numberOfColumns = 6 * bodiesToPropagate.size( );
+    for( std::size_t i = 0; i < numberOfEpochs; i++ )
+    {
+        Eigen::Map< Eigen::Matrix< double, Eigen::Dynamic, 1 > >( initialStates + i * numberOfColumns, numberOfColumns ) =
+                tudat::propagators::getInitialStatesOfBodies< TimeType, StateScalarType >(
+                    bodiesToPropagate, centralBodies, bodies, static_cast< TimeType >( epochs[ i ] ),
+                    frameManager ).template cast< double >( );
+    }
+}
+
+} // namespace tudatpy
+
+#endif // TUDATPY_BATCHED_INITIAL_STATES_H
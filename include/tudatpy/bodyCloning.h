@@ -0,0 +1,347 @@
+/*    Copyright (c) 2010-2022, Delft University of Technology
+ *    All rights reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ */
+
+#ifndef TUDATPY_BODY_CLONING_H
+#define TUDATPY_BODY_CLONING_H
+
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "tudat/astro/aerodynamics.h"
+#include "tudat/astro/electromagnetism/radiationPressureInterface.h"
+#include "tudat/astro/ephemerides.h"
+#include "tudat/astro/gravitation.h"
+#include "tudat/simulation/environment_setup/body.h"
+
+#include "tudatpy/synchronizedEnvironment.h"
+
+namespace tudatpy
+{
+
+//! Function to retrieve the mutex with which the clones of a body synchronize their access to a shared model
+/*!
+ * Function to retrieve the mutex with which the clones of a body synchronize their access to a shared model. The same
+ * mutex is returned for a given model as long as any clone uses it, also for clones created by separate calls to
+ * cloneSystemOfBodies.
+ * \param model Model of the original body that is shared between its clones
+ * \return Mutex for the model
+ */
+inline std::shared_ptr< std::mutex > getClonedModelMutex( const void* model )
+{
+    static std::mutex registryMutex;
+    static std::map< const void*, std::weak_ptr< std::mutex > > modelMutexes;
+
+    std::lock_guard< std::mutex > lock( registryMutex );
+    std::shared_ptr< std::mutex > modelMutex = modelMutexes[ model ].lock( );
+    if( modelMutex == nullptr )
+    {
+        modelMutex = std::make_shared< std::mutex >( );
+        modelMutexes[ model ] = modelMutex;
+    }
+    return modelMutex;
+}
+
+//! Function to retrieve the ephemeris of the clone of a body
+/*!
+ * Function to retrieve the ephemeris of the clone of a body, which shares the ephemeris of the original body.
+ * Ephemerides evaluated through CSPICE are wrapped in a SynchronizedEphemeris holding the SPICE mutex. Tabulated
+ * ephemerides keep the state of their interpolator lookup, and are wrapped in a SynchronizedEphemeris with a mutex
+ * specific to the ephemeris (see getClonedModelMutex). Other ephemerides only depend on time, and are shared directly.
+ * \param ephemeris Ephemeris of the original body (which is not modified)
+ * \return Ephemeris to use for the clone
+ */
+inline std::shared_ptr< tudat::ephemerides::Ephemeris > getClonedEphemeris(
+        const std::shared_ptr< tudat::ephemerides::Ephemeris > ephemeris )
+{
+    if( std::dynamic_pointer_cast< tudat::ephemerides::SpiceEphemeris >( ephemeris ) != nullptr )
+    {
+        return std::make_shared< SynchronizedEphemeris >( ephemeris );
+    }
+    else if( std::dynamic_pointer_cast< tudat::ephemerides::TabulatedCartesianEphemeris< double, double > >( ephemeris ) != nullptr ||
+             std::dynamic_pointer_cast< tudat::ephemerides::TabulatedCartesianEphemeris< long double, double > >( ephemeris ) != nullptr )
+    {
+        return std::make_shared< SynchronizedEphemeris >( ephemeris, getClonedModelMutex( ephemeris.get( ) ) );
+    }
+    return ephemeris;
+}
+
+//! Function to retrieve the atmosphere model of the clone of a body
+/*!
+ * Function to retrieve the atmosphere model of the clone of a body, which shares the atmosphere model of the original
+ * body. Exponential atmospheres only depend on their input, and are shared directly; other atmosphere models (tabulated,
+ * NRLMSISE-00, custom) may keep internal state, and are wrapped in a SynchronizedAtmosphereModel with a mutex specific
+ * to the model (see getClonedModelMutex).
+ * \param atmosphereModel Atmosphere model of the original body (which is not modified)
+ * \return Atmosphere model to use for the clone
+ */
+inline std::shared_ptr< tudat::aerodynamics::AtmosphereModel > getClonedAtmosphereModel(
+        const std::shared_ptr< tudat::aerodynamics::AtmosphereModel > atmosphereModel )
+{
+    if( std::dynamic_pointer_cast< tudat::aerodynamics::ExponentialAtmosphere >( atmosphereModel ) != nullptr ||
+            std::dynamic_pointer_cast< SynchronizedAtmosphereModel >( atmosphereModel ) != nullptr )
+    {
+        return atmosphereModel;
+    }
+    return std::make_shared< SynchronizedAtmosphereModel >( atmosphereModel, getClonedModelMutex( atmosphereModel.get( ) ) );
+}
+
+//! Function to retrieve the rotation model of the clone of a body
+/*!
+ * Function to retrieve the rotation model of the clone of a body, which shares the rotation model of the original body
+ * if it only depends on time. SPICE rotation models are wrapped in a SynchronizedRotationalEphemeris holding the SPICE
+ * mutex; simple and constant rotation models are shared directly.
+ * \param rotationModel Rotation model of the original body (which is not modified)
+ * \return Rotation model to use for the clone (nullptr if the rotation model cannot be shared)
+ */
+inline std::shared_ptr< tudat::ephemerides::RotationalEphemeris > getClonedRotationModel(
+        const std::shared_ptr< tudat::ephemerides::RotationalEphemeris > rotationModel )
+{
+    if( std::dynamic_pointer_cast< tudat::ephemerides::SpiceRotationalEphemeris >( rotationModel ) != nullptr )
+    {
+        return std::make_shared< SynchronizedRotationalEphemeris >( rotationModel );
+    }
+    else if( std::dynamic_pointer_cast< tudat::ephemerides::SimpleRotationalEphemeris >( rotationModel ) != nullptr ||
+             std::dynamic_pointer_cast< tudat::ephemerides::ConstantRotationalEphemeris >( rotationModel ) != nullptr ||
+             std::dynamic_pointer_cast< SynchronizedRotationalEphemeris >( rotationModel ) != nullptr )
+    {
+        return rotationModel;
+    }
+    return nullptr;
+}
+
+//! Function to retrieve the aerodynamic coefficient interface of the clone of a body
+/*!
+ * Function to retrieve the aerodynamic coefficient interface of the clone of a body, which shares the coefficient tables
+ * (or functions) of the interface of the original body through a SynchronizedAerodynamicCoefficientInterface, with a
+ * mutex specific to the original interface (see getClonedModelMutex). The current coefficients are stored separately
+ * for each clone.
+ * \param coefficientInterface Aerodynamic coefficient interface of the original body (which is not modified)
+ * \return Coefficient interface to use for the clone (nullptr if the interface has control surfaces, and cannot be shared)
+ */
+inline std::shared_ptr< tudat::aerodynamics::AerodynamicCoefficientInterface > getClonedAerodynamicCoefficientInterface(
+        const std::shared_ptr< tudat::aerodynamics::AerodynamicCoefficientInterface > coefficientInterface )
+{
+    if( coefficientInterface->getControlSurfaceIndependentVariables( ).size( ) > 0 )
+    {
+        return nullptr;
+    }
+
+    // Wrap the original interface (not another wrapper), so that all clones of a body use the same mutex
+    std::shared_ptr< tudat::aerodynamics::AerodynamicCoefficientInterface > originalCoefficientInterface = coefficientInterface;
+    if( std::shared_ptr< SynchronizedAerodynamicCoefficientInterface > synchronizedCoefficientInterface =
+            std::dynamic_pointer_cast< SynchronizedAerodynamicCoefficientInterface >( coefficientInterface ) )
+    {
+        originalCoefficientInterface = synchronizedCoefficientInterface->getWrappedCoefficientInterface( );
+    }
+    return std::make_shared< SynchronizedAerodynamicCoefficientInterface >(
+                originalCoefficientInterface, getClonedModelMutex( originalCoefficientInterface.get( ) ) );
+}
+
+//! Function to create the radiation pressure interface of the clone of a body
+/*!
+ * Function to create the radiation pressure interface of the clone of a body, with the same source power, radiation
+ * pressure coefficient and area as the interface of the original body, but with the positions of the source and the
+ * target taken from the cloned bodies, and its own current radiation pressure.
+ * \param radiationPressureInterface Radiation pressure interface of the original body (which is not modified)
+ * \param sourceBody Clone of the body emitting the radiation
+ * \param targetBody Clone of the body undergoing the radiation pressure
+ * \return Radiation pressure interface to use for the clone (nullptr if the interface has occulting bodies, of which the
+ * positions are bound to the original bodies, and cannot be recreated)
+ */
+inline std::shared_ptr< tudat::electromagnetism::RadiationPressureInterface > getClonedRadiationPressureInterface(
+        const std::shared_ptr< tudat::electromagnetism::RadiationPressureInterface > radiationPressureInterface,
+        const std::shared_ptr< tudat::simulation_setup::Body > sourceBody,
+        const std::shared_ptr< tudat::simulation_setup::Body > targetBody )
+{
+    if( radiationPressureInterface->getOccultingBodyPositions( ).size( ) > 0 )
+    {
+        return nullptr;
+    }
+
+    return std::make_shared< tudat::electromagnetism::RadiationPressureInterface >(
+                radiationPressureInterface->getSourcePowerFunction( ),
+                std::bind( &tudat::simulation_setup::Body::getPosition, sourceBody ),
+                std::bind( &tudat::simulation_setup::Body::getPosition, targetBody ),
+                radiationPressureInterface->getRadiationPressureCoefficient( ),
+                radiationPressureInterface->getArea( ),
+                std::vector< std::function< Eigen::Vector3d( ) > >( ),
+                std::vector< double >( ),
+                radiationPressureInterface->getSourceRadius( ) );
+}
+
+//! Function to create a copy of a system of bodies that shares the (read-only) environment models of the original
+/*!
+ * Function to create a copy of a system of bodies that shares the (read-only) environment models of the original, so
+ * that the copy can be used in a propagation that runs concurrently with a propagation using the original, without
+ * duplicating the memory of large models. Each body of the copy has its own current state, orientation and mass. The
+ * following models are shared between the original and the copy:
+ *
+ *  - Ephemerides (SPICE and tabulated ephemerides through a synchronized wrapper in the copy)
+ *  - Rotation models that only depend on time (simple and constant rotation models, and SPICE rotation models through a
+ *    synchronized wrapper in the copy)
+ *  - Gravity field models without time variations (including the spherical harmonic coefficients)
+ *  - Shape models
+ *  - Atmosphere models (through a synchronized wrapper in the copy if they may keep internal state)
+ *  - Mass functions and inertia tensors
+ *  - Aerodynamic coefficient tables and functions (through a synchronized wrapper in the copy, which stores the current
+ *    coefficients of the copy)
+ *  - Radiation pressure coefficients and areas (in a radiation pressure interface of the copy, bound to the bodies of the
+ *    copy)
+ *
+ * The original bodies are not modified, so that the synchronized wrappers only synchronize the copies with each other:
+ * the original bodies must not be used concurrently with their copies, unless their SPICE models are synchronized as
+ * well (see synchronizeSpiceAccess) and they have no tabulated ephemerides or stateful atmosphere models. For concurrent
+ * propagations, a copy should therefore be used for each propagation.
+ * Models that keep state for a specific body or propagation (aerodynamic coefficient interfaces with control surfaces,
+ * radiation pressure interfaces with occulting bodies, ground stations, vehicle systems, time-variable gravity fields
+ * and rotation models that depend on the state of the bodies) are not copied; they have to be added to the copy using
+ * the environment setup functions. Flight conditions are created for the copy by the acceleration setup.
+ * \param bodies System of bodies to copy
+ * \param skipModelsNotCloned Boolean denoting whether the copy is created without the models that cannot be copied (if
+ * false, an exception listing these models is thrown if the bodies contain any of them)
+ * \return Copy of the system of bodies
+ */
+inline tudat::simulation_setup::SystemOfBodies cloneSystemOfBodies( tudat::simulation_setup::SystemOfBodies& bodies,
+                                                                    const bool skipModelsNotCloned = false )
+{
+    tudat::simulation_setup::SystemOfBodies clonedBodies(
+                bodies.getFrameOrigin( ), bodies.getFrameOrientation( ) );
+
+    std::vector< std::string > modelsNotCloned;
+    for( auto bodyIterator : bodies.getMap( ) )
+    {
+        const std::string bodyName = bodyIterator.first;
+        const std::shared_ptr< tudat::simulation_setup::Body > originalBody = bodyIterator.second;
+
+        clonedBodies.createEmptyBody( bodyName, false );
+        const std::shared_ptr< tudat::simulation_setup::Body > clonedBody = clonedBodies.getBody( bodyName );
+
+        if( originalBody->getEphemeris( ) != nullptr )
+        {
+            clonedBody->setEphemeris( getClonedEphemeris( originalBody->getEphemeris( ) ) );
+        }
+
+        if( originalBody->getRotationalEphemeris( ) != nullptr )
+        {
+            const std::shared_ptr< tudat::ephemerides::RotationalEphemeris > clonedRotationModel =
+                    getClonedRotationModel( originalBody->getRotationalEphemeris( ) );
+            if( clonedRotationModel != nullptr )
+            {
+                clonedBody->setRotationalEphemeris( clonedRotationModel );
+            }
+            else
+            {
+                modelsNotCloned.push_back( "rotation model of " + bodyName );
+            }
+        }
+
+        if( originalBody->getGravityFieldModel( ) != nullptr )
+        {
+            if( std::dynamic_pointer_cast< tudat::gravitation::TimeDependentSphericalHarmonicsGravityField >(
+                        originalBody->getGravityFieldModel( ) ) == nullptr )
+            {
+                clonedBody->setGravityFieldModel( originalBody->getGravityFieldModel( ) );
+            }
+            else
+            {
+                modelsNotCloned.push_back( "time-variable gravity field of " + bodyName );
+            }
+        }
+
+        if( originalBody->getShapeModel( ) != nullptr )
+        {
+            clonedBody->setShapeModel( originalBody->getShapeModel( ) );
+        }
+
+        if( originalBody->getAtmosphereModel( ) != nullptr )
+        {
+            clonedBody->setAtmosphereModel( getClonedAtmosphereModel( originalBody->getAtmosphereModel( ) ) );
+        }
+
+        if( originalBody->getBodyMassFunction( ) != nullptr )
+        {
+            clonedBody->setBodyMassFunction( originalBody->getBodyMassFunction( ) );
+        }
+        clonedBody->setBodyInertiaTensor( originalBody->getBodyInertiaTensor( ) );
+        clonedBody->setState( originalBody->getState( ) );
+
+        if( originalBody->getAerodynamicCoefficientInterface( ) != nullptr )
+        {
+            const std::shared_ptr< tudat::aerodynamics::AerodynamicCoefficientInterface > clonedCoefficientInterface =
+                    getClonedAerodynamicCoefficientInterface( originalBody->getAerodynamicCoefficientInterface( ) );
+            if( clonedCoefficientInterface != nullptr )
+            {
+                clonedBody->setAerodynamicCoefficientInterface( clonedCoefficientInterface );
+            }
+            else
+            {
+                modelsNotCloned.push_back( "aerodynamic coefficient interface (with control surfaces) of " + bodyName );
+            }
+        }
+        if( originalBody->getGroundStationMap( ).size( ) > 0 )
+        {
+            modelsNotCloned.push_back( "ground stations of " + bodyName );
+        }
+        if( originalBody->getVehicleSystems( ) != nullptr )
+        {
+            modelsNotCloned.push_back( "vehicle systems of " + bodyName );
+        }
+    }
+
+    // Radiation pressure interfaces are bound to the source bodies, which are only all available once all bodies are created
+    for( auto bodyIterator : bodies.getMap( ) )
+    {
+        for( auto interfaceIterator : bodyIterator.second->getRadiationPressureInterfaces( ) )
+        {
+            std::shared_ptr< tudat::electromagnetism::RadiationPressureInterface > clonedRadiationPressureInterface;
+            if( clonedBodies.getMap( ).count( interfaceIterator.first ) > 0 )
+            {
+                clonedRadiationPressureInterface = getClonedRadiationPressureInterface(
+                            interfaceIterator.second, clonedBodies.getBody( interfaceIterator.first ),
+                            clonedBodies.getBody( bodyIterator.first ) );
+            }
+
+            if( clonedRadiationPressureInterface != nullptr )
+            {
+                clonedBodies.getBody( bodyIterator.first )->setRadiationPressureInterface(
+                            interfaceIterator.first, clonedRadiationPressureInterface );
+            }
+            else
+            {
+                modelsNotCloned.push_back( "radiation pressure interface (with occulting bodies) of " + bodyIterator.first +
+                                           " due to " + interfaceIterator.first );
+            }
+        }
+    }
+
+    if( modelsNotCloned.size( ) > 0 && !skipModelsNotCloned )
+    {
+        std::string modelsNotClonedList;
+        for( unsigned int i = 0; i < modelsNotCloned.size( ); i++ )
+        {
+            modelsNotClonedList += ( ( i > 0 ) ? ", " : "" ) + modelsNotCloned.at( i );
+        }
+        throw std::runtime_error( "Error when cloning system of bodies, the following models cannot be copied: " +
+                                  modelsNotClonedList + ". Skip these models (skip_models_not_cloned) to create the copy "
+                                  "without them, and add them to the copy separately" );
+    }
+    clonedBodies.processBodyFrameDefinitions( );
+
+    return clonedBodies;
+}
+
+} // namespace tudatpy
+
+#endif // TUDATPY_BODY_CLONING_H
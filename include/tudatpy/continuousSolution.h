@@ -0,0 +1,321 @@
+/*    Copyright (c) 2010-2022, Delft University of Technology
+ *    All rights reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ */
+
+#ifndef TUDATPY_CONTINUOUS_SOLUTION_H
+#define TUDATPY_CONTINUOUS_SOLUTION_H
+
+#include <algorithm>
+#include <functional>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include <Eigen/Core>
+
+namespace tudatpy
+{
+
+//! Function to evaluate the cubic Hermite polynomial through two states and their time derivatives
+/*!
+ * Function to evaluate the cubic Hermite polynomial through two states and their time derivatives, which is used to
+ * interpolate the solution within an integration step (the states and derivatives at both ends of the step are available
+ * from the integrator and the state derivative function). Note that this is not the dense output of the integrator
+ * itself: the interpolation error is of fourth order in the step size, regardless of the order of the integrator.
+ * \param initialTime Time at the start of the step
+ * \param finalTime Time at the end of the step
+ * \param initialState State at the start of the step
+ * \param initialStateDerivative State derivative at the start of the step
+ * \param finalState State at the end of the step
+ * \param finalStateDerivative State derivative at the end of the step
+ * \param interpolationTime Time at which the polynomial is to be evaluated
+ * \param interpolatedState Interpolated state (returned by reference)
+ */
+template< typename TimeType, typename InputType, typename OutputType >
+void evaluateCubicHermitePolynomial(
+        const TimeType initialTime,
+        const TimeType finalTime,
+        const InputType& initialState,
+        const InputType& initialStateDerivative,
+        const InputType& finalState,
+        const InputType& finalStateDerivative,
+        const TimeType interpolationTime,
+        OutputType& interpolatedState )
+{
+    const TimeType stepSize = finalTime - initialTime;
+    const TimeType normalizedTime = ( interpolationTime - initialTime ) / stepSize;
+    const TimeType normalizedTimeSquared = normalizedTime * normalizedTime;
+    const TimeType normalizedTimeCubed = normalizedTimeSquared * normalizedTime;
+
+    interpolatedState =
+            ( 2.0 * normalizedTimeCubed - 3.0 * normalizedTimeSquared + 1.0 ) * initialState +
+            ( ( normalizedTimeCubed - 2.0 * normalizedTimeSquared + normalizedTime ) * stepSize ) * initialStateDerivative +
+            ( -2.0 * normalizedTimeCubed + 3.0 * normalizedTimeSquared ) * finalState +
+            ( ( normalizedTimeCubed - normalizedTimeSquared ) * stepSize ) * finalStateDerivative;
+}
+
+//! Continuous solution of a single-arc propagation, interpolated between the states at the integration steps
+/*!
+ * Continuous solution of a single-arc propagation, interpolated between the states at the integration steps. For
+ * each accepted step, only the propagated state is stored, and the solution within a step is evaluated by Lagrange
+ * interpolation through the states at the surrounding nodes (by default 8 nodes, as for the interpolation of the state
+ * history in Tudat), centered on the step where possible. The solution is exact (to within the integration error) at
+ * the nodes only; within a step, the interpolation error is small if the integration steps are short compared to the
+ * time scale of the dynamics (e.g. many steps per orbit). When the propagated state is modified during the propagation
+ * (e.g. an impulsive manoeuvre), two nodes with equal time are stored; at that time, the solution after the
+ * modification is returned, and the interpolation does not use nodes on both sides of the modification.
+ */
+template< typename TimeType = double, typename StateScalarType = double >
+class ContinuousSolution
+{
+public:
+
+    typedef Eigen::Matrix< StateScalarType, Eigen::Dynamic, 1 > VectorType;
+
+    typedef Eigen::Matrix< StateScalarType, Eigen::Dynamic, Eigen::Dynamic > StateType;
+
+    //! Constructor
+    /*!
+     * Constructor
+     * \param stateSize Size of the propagated state
+     * \param outputConversionFunction Function to convert the propagated state at a given time to the processed (e.g.
+     * Cartesian) state (if nullptr, the propagated state is returned as processed state)
+     * \param numberOfInterpolationNodes Number of nodes used for the Lagrange interpolation (fewer nodes are used if
+     * fewer are available between modifications of the state)
+     */
+    ContinuousSolution( const unsigned int stateSize,
+                        const std::function< StateType( const StateType&, const TimeType ) > outputConversionFunction = nullptr,
+                        const unsigned int numberOfInterpolationNodes = 8 ):
+        stateSize_( stateSize ), outputConversionFunction_( outputConversionFunction ),
+        numberOfInterpolationNodes_( numberOfInterpolationNodes ), lastSegmentIndex_( 0 )
+    {
+        if( numberOfInterpolationNodes_ < 2 )
+        {
+            throw std::runtime_error( "Error when creating continuous solution, at least 2 interpolation nodes are required" );
+        }
+    }
+
+    //! Function to add the propagated state at the end of an accepted integration step (or after a state modification)
+    void addNode( const TimeType time, const StateType& propagatedState )
+    {
+        if( static_cast< unsigned int >( propagatedState.size( ) ) != stateSize_ )
+        {
+            throw std::runtime_error( "Error when adding node to continuous solution, state size is inconsistent" );
+        }
+        if( times_.size( ) > 1 && ( time - times_.back( ) ) * ( times_.back( ) - times_.front( ) ) < 0.0 )
+        {
+            throw std::runtime_error( "Error when adding node to continuous solution, times are not monotonic" );
+        }
+
+        // A node with the same time as the previous one (state modification) starts a new continuous interval
+        if( times_.size( ) == 0 || time == times_.back( ) )
+        {
+            intervalStartIndices_.push_back( static_cast< unsigned int >( times_.size( ) ) );
+        }
+        times_.push_back( time );
+        propagatedStates_.insert( propagatedStates_.end( ), propagatedState.data( ), propagatedState.data( ) + stateSize_ );
+    }
+
+    //! Function to retrieve the propagated state at the given time
+    VectorType getPropagatedState( const TimeType time )
+    {
+        const unsigned int segmentIndex = findSegment( time );
+        if( times_.size( ) == 1 )
+        {
+            return getNodeState( 0 );
+        }
+
+        // Nodes of the continuous interval containing the step, centered on the step where possible
+        const unsigned int intervalIndex = static_cast< unsigned int >(
+                    std::upper_bound( intervalStartIndices_.begin( ), intervalStartIndices_.end( ), segmentIndex ) -
+                    intervalStartIndices_.begin( ) ) - 1;
+        const unsigned int intervalStart = intervalStartIndices_.at( intervalIndex );
+        const unsigned int intervalEnd = ( intervalIndex + 1 < intervalStartIndices_.size( ) ) ?
+                    intervalStartIndices_.at( intervalIndex + 1 ) : static_cast< unsigned int >( times_.size( ) );
+        const unsigned int numberOfNodes = std::min( numberOfInterpolationNodes_, intervalEnd - intervalStart );
+        const unsigned int nodesBeforeStep = ( numberOfNodes - 1 ) / 2;
+        unsigned int firstNode = ( segmentIndex >= intervalStart + nodesBeforeStep ) ?
+                    segmentIndex - nodesBeforeStep : intervalStart;
+        firstNode = std::min( firstNode, intervalEnd - numberOfNodes );
+
+        VectorType propagatedState = VectorType::Zero( stateSize_ );
+        for( unsigned int i = firstNode; i < firstNode + numberOfNodes; i++ )
+        {
+            StateScalarType basisPolynomial = 1.0;
+            for( unsigned int j = firstNode; j < firstNode + numberOfNodes; j++ )
+            {
+                if( j != i )
+                {
+                    basisPolynomial *= static_cast< StateScalarType >(
+                                ( time - times_.at( j ) ) / ( times_.at( i ) - times_.at( j ) ) );
+                }
+            }
+            propagatedState += basisPolynomial * getNodeState( i );
+        }
+        return propagatedState;
+    }
+
+    //! Function to retrieve the processed (e.g. Cartesian) state at the given time
+    VectorType getState( const TimeType time )
+    {
+        if( outputConversionFunction_ == nullptr )
+        {
+            return getPropagatedState( time );
+        }
+        else
+        {
+            return outputConversionFunction_( getPropagatedState( time ), time ).col( 0 );
+        }
+    }
+
+    //! Function to retrieve the processed (e.g. Cartesian) states at a list of times, with one state per row
+    Eigen::Matrix< StateScalarType, Eigen::Dynamic, Eigen::Dynamic, Eigen::RowMajor > getStates(
+            const std::vector< TimeType >& times )
+    {
+        Eigen::Matrix< StateScalarType, Eigen::Dynamic, Eigen::Dynamic, Eigen::RowMajor > states;
+        for( unsigned int i = 0; i < times.size( ); i++ )
+        {
+            const VectorType currentState = getState( times.at( i ) );
+            if( i == 0 )
+            {
+                states.resize( times.size( ), currentState.rows( ) );
+            }
+            states.row( i ) = currentState.transpose( );
+        }
+        return states;
+    }
+
+    TimeType getStartTime( )
+    {
+        checkIsNotEmpty( );
+        return times_.front( );
+    }
+
+    TimeType getEndTime( )
+    {
+        checkIsNotEmpty( );
+        return times_.back( );
+    }
+
+    unsigned int getNumberOfNodes( )
+    {
+        return static_cast< unsigned int >( times_.size( ) );
+    }
+
+    unsigned int getStateSize( )
+    {
+        return stateSize_;
+    }
+
+    //! Function to retrieve the time of a single node
+    TimeType getNodeTime( const unsigned int nodeIndex )
+    {
+        return times_.at( nodeIndex );
+    }
+
+    //! Function to retrieve the propagated state at a single node
+    VectorType getNodeState( const unsigned int nodeIndex )
+    {
+        return Eigen::Map< const VectorType >( propagatedStates_.data( ) + nodeIndex * stateSize_, stateSize_ );
+    }
+
+private:
+
+    void checkIsNotEmpty( )
+    {
+        if( times_.size( ) == 0 )
+        {
+            throw std::runtime_error( "Error when evaluating continuous solution, solution contains no nodes" );
+        }
+    }
+
+    //! Function to find the index of the node at the start of the step containing the given time
+    /*!
+     * Function to find the index of the node at the start of the step containing the given time. The step found in the
+     * previous call is checked first, so that evaluating the solution at a sequence of increasing (or, for a backward
+     * propagation, decreasing) times does not require a search.
+     * \param time Time for which the step is to be found
+     * \return Index of the node at the start of the step
+     */
+    unsigned int findSegment( const TimeType time )
+    {
+        checkIsNotEmpty( );
+
+        const TimeType direction = ( times_.back( ) < times_.front( ) ) ? -1.0 : 1.0;
+        if( ( time - times_.front( ) ) * direction < 0.0 || ( time - times_.back( ) ) * direction > 0.0 )
+        {
+            throw std::runtime_error( "Error when evaluating continuous solution, time " +
+                                      std::to_string( static_cast< double >( time ) ) +
+                                      " is outside of the propagated interval" );
+        }
+        if( times_.size( ) == 1 )
+        {
+            return 0;
+        }
+
+        // Check cached step (and the one after it) before searching
+        for( unsigned int segmentIndex = lastSegmentIndex_;
+             segmentIndex < std::min( lastSegmentIndex_ + 2, static_cast< unsigned int >( times_.size( ) - 1 ) );
+             segmentIndex++ )
+        {
+            if( ( time - times_.at( segmentIndex ) ) * direction >= 0.0 &&
+                    ( times_.at( segmentIndex + 1 ) - time ) * direction > 0.0 )
+            {
+                lastSegmentIndex_ = segmentIndex;
+                return segmentIndex;
+            }
+        }
+
+        // Find first node after the given time; the step ends at this node
+        typename std::vector< TimeType >::iterator nodeIterator;
+        if( direction > 0.0 )
+        {
+            nodeIterator = std::upper_bound( times_.begin( ), times_.end( ), time );
+        }
+        else
+        {
+            nodeIterator = std::upper_bound( times_.begin( ), times_.end( ), time, std::greater< TimeType >( ) );
+        }
+
+        unsigned int segmentIndex = static_cast< unsigned int >( nodeIterator - times_.begin( ) );
+        segmentIndex = ( segmentIndex == 0 ) ? 0 : segmentIndex - 1;
+
+        // At the final time, use the last step with non-zero length
+        while( segmentIndex > 0 && ( segmentIndex >= times_.size( ) - 1 ||
+                                     times_.at( segmentIndex + 1 ) == times_.at( segmentIndex ) ) )
+        {
+            segmentIndex--;
+        }
+
+        lastSegmentIndex_ = segmentIndex;
+        return segmentIndex;
+    }
+
+    unsigned int stateSize_;
+
+    std::function< StateType( const StateType&, const TimeType ) > outputConversionFunction_;
+
+    //! Times of the nodes
+    std::vector< TimeType > times_;
+
+    //! Number of nodes used for the Lagrange interpolation
+    unsigned int numberOfInterpolationNodes_;
+
+    //! Propagated states at the nodes, stored contiguously
+    std::vector< StateScalarType > propagatedStates_;
+
+    //! Indices of the first node of each continuous interval (between modifications of the state)
+    std::vector< unsigned int > intervalStartIndices_;
+
+    unsigned int lastSegmentIndex_;
+};
+
+} // namespace tudatpy
+
+#endif // TUDATPY_CONTINUOUS_SOLUTION_H
@@ -0,0 +1,223 @@
+/*    Copyright (c) 2010-2022, Delft University of Technology
+ *    All rights reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ */
+
+#ifndef TUDATPY_DEPENDENT_VARIABLE_POST_PROCESSING_H
+#define TUDATPY_DEPENDENT_VARIABLE_POST_PROCESSING_H
+
+#include <algorithm>
+#include <functional>
+#include <map>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include <Eigen/Core>
+
+#include "tudat/math/interpolators/createInterpolator.h"
+#include "tudat/simulation/propagation_setup/dynamicsSimulator.h"
+#include "tudat/simulation/propagation_setup/propagationOutput.h"
+
+#include "tudatpy/parallelExecution.h"
+#include "tudatpy/synchronizedEnvironment.h"
+
+namespace tudatpy
+{
+
+//! Function to compute dependent variables after a propagation, from the propagated state history
+/*!
+ * Function to compute dependent variables after a single-arc propagation, from the propagated state history, so that
+ * dependent variables that are not needed during the propagation (e.g. for termination) do not have to be computed at
+ * each step. At each requested epoch, the propagated state is set in the environment and the state derivative models
+ * (including the accelerations) are updated, using the models of the dynamics simulator, after which all dependent
+ * variables are evaluated at once. The environment of the simulator is therefore left at the state of the last epoch.
+ *
+ * If no epochs are given, the dependent variables are computed at the epochs of the propagated state history. Otherwise,
+ * the propagated state at each epoch is interpolated from the state history (8th-order Lagrange interpolation, or linear
+ * interpolation if the history contains fewer than 8 epochs); epochs must then be within the propagated interval.
+ *
+ * The environment and state derivative models of a simulator can only be at one state at a time, so that the epochs
+ * are evaluated sequentially on a single simulator. If worker simulators are provided (each with its own system of
+ * bodies, e.g. a clone of the bodies of the dynamics simulator, and state derivative models created for these bodies
+ * from equivalent propagator settings), the epochs are distributed over as many threads as there are simulators, each
+ * evaluating its epochs on its own simulator. The SPICE-based models of all bodies are then synchronized during the
+ * evaluation (see synchronizeSpiceAccess), and the environment of the dynamics simulator is finally reset to the state
+ * of the last epoch.
+ * \param dynamicsSimulator Dynamics simulator with which the propagation was performed
+ * \param dependentVariables Dependent variables to compute
+ * \param epochs Epochs at which the dependent variables are computed (epochs of state history if empty)
+ * \param outputEpochs Epochs at which the dependent variables are computed (returned by reference)
+ * \param workerSimulators Additional simulators on which epochs are evaluated concurrently (none if empty)
+ * \return Dependent variables, with one row per epoch
+ */
+template< typename StateScalarType = double, typename TimeType = double >
+Eigen::Matrix< double, Eigen::Dynamic, Eigen::Dynamic, Eigen::RowMajor > computeDependentVariablesFromStateHistory(
+        const std::shared_ptr< tudat::propagators::SingleArcDynamicsSimulator< StateScalarType, TimeType > > dynamicsSimulator,
+        const std::vector< std::shared_ptr< tudat::propagators::SingleDependentVariableSaveSettings > >& dependentVariables,
+        const std::vector< TimeType >& epochs,
+        std::vector< TimeType >& outputEpochs,
+        const std::vector< std::shared_ptr< tudat::propagators::SingleArcDynamicsSimulator< StateScalarType, TimeType > > >&
+        workerSimulators =
+        std::vector< std::shared_ptr< tudat::propagators::SingleArcDynamicsSimulator< StateScalarType, TimeType > > >( ) )
+{
+    typedef Eigen::Matrix< StateScalarType, Eigen::Dynamic, 1 > StateVectorType;
+
+    const std::map< TimeType, StateVectorType >& stateHistory =
+            dynamicsSimulator->getEquationsOfMotionNumericalSolutionRaw( );
+    if( stateHistory.size( ) == 0 )
+    {
+        throw std::runtime_error( "Error when computing dependent variables from state history, state history is empty" );
+    }
+    if( dependentVariables.size( ) == 0 )
+    {
+        throw std::runtime_error( "Error when computing dependent variables from state history, no dependent variables provided" );
+    }
+
+    // Simulators on which the epochs are evaluated, each with its own environment
+    std::vector< std::shared_ptr< tudat::propagators::SingleArcDynamicsSimulator< StateScalarType, TimeType > > > simulators =
+    { dynamicsSimulator };
+    simulators.insert( simulators.end( ), workerSimulators.begin( ), workerSimulators.end( ) );
+
+    std::map< tudat::simulation_setup::Body*, unsigned int > bodyUsers;
+    std::vector< std::shared_ptr< tudat::propagators::DynamicsStateDerivativeModel< TimeType, StateScalarType > > >
+            dynamicsStateDerivatives;
+    std::vector< std::function< Eigen::VectorXd( ) > > dependentVariableFunctions;
+    for( unsigned int i = 0; i < simulators.size( ); i++ )
+    {
+        if( simulators.at( i ) == nullptr )
+        {
+            throw std::runtime_error( "Error when computing dependent variables from state history, worker simulator " +
+                                      std::to_string( i ) + " is not defined" );
+        }
+        if( simulators.at( i )->getPropagatorSettings( )->getInitialStates( ).rows( ) !=
+                dynamicsSimulator->getPropagatorSettings( )->getInitialStates( ).rows( ) )
+        {
+            throw std::runtime_error( "Error when computing dependent variables from state history, state size of worker simulator " +
+                                      std::to_string( i ) + " is inconsistent with that of the dynamics simulator" );
+        }
+        for( auto bodyIterator : simulators.at( i )->getSystemOfBodies( ).getMap( ) )
+        {
+            if( bodyUsers.count( bodyIterator.second.get( ) ) > 0 )
+            {
+                throw std::runtime_error( "Error when computing dependent variables from state history, body " +
+                                          bodyIterator.first + " is used by simulators " +
+                                          std::to_string( bodyUsers.at( bodyIterator.second.get( ) ) ) + " and " +
+                                          std::to_string( i ) + "; each simulator must have its own system of bodies" );
+            }
+            bodyUsers[ bodyIterator.second.get( ) ] = i;
+        }
+
+        dynamicsStateDerivatives.push_back( simulators.at( i )->getDynamicsStateDerivative( ) );
+        dependentVariableFunctions.push_back(
+                    tudat::propagators::createDependentVariableListFunction< TimeType, StateScalarType >(
+                        dependentVariables, simulators.at( i )->getSystemOfBodies( ),
+                        dynamicsStateDerivatives.back( )->getStateDerivativeModels( ) ).first );
+    }
+
+    // Retrieve propagated states at requested epochs
+    std::vector< StateVectorType > states;
+    if( epochs.size( ) == 0 )
+    {
+        outputEpochs.clear( );
+        for( auto stateIterator : stateHistory )
+        {
+            outputEpochs.push_back( stateIterator.first );
+            states.push_back( stateIterator.second );
+        }
+    }
+    else
+    {
+        const TimeType startTime = std::min( stateHistory.begin( )->first, stateHistory.rbegin( )->first );
+        const TimeType endTime = std::max( stateHistory.begin( )->first, stateHistory.rbegin( )->first );
+        std::shared_ptr< tudat::interpolators::InterpolatorSettings > interpolatorSettings;
+        if( stateHistory.size( ) >= 8 )
+        {
+            interpolatorSettings = std::make_shared< tudat::interpolators::LagrangeInterpolatorSettings >( 8 );
+        }
+        else
+        {
+            interpolatorSettings = std::make_shared< tudat::interpolators::InterpolatorSettings >(
+                        tudat::interpolators::linear_interpolator );
+        }
+        const std::shared_ptr< tudat::interpolators::OneDimensionalInterpolator< TimeType, StateVectorType > > stateInterpolator =
+                tudat::interpolators::createOneDimensionalInterpolator< TimeType, StateVectorType >(
+                    stateHistory, interpolatorSettings );
+
+        outputEpochs = epochs;
+        for( unsigned int i = 0; i < epochs.size( ); i++ )
+        {
+            if( epochs.at( i ) < startTime || epochs.at( i ) > endTime )
+            {
+                throw std::runtime_error( "Error when computing dependent variables from state history, epoch " +
+                                          std::to_string( static_cast< double >( epochs.at( i ) ) ) +
+                                          " is outside of the propagated interval" );
+            }
+            states.push_back( stateInterpolator->interpolate( epochs.at( i ) ) );
+        }
+    }
+
+    // Update environment and state derivative models at each epoch, and evaluate dependent variables, with the simulator
+    // of the thread evaluating the epoch
+    std::vector< Eigen::VectorXd > dependentVariablesPerEpoch( outputEpochs.size( ) );
+    auto evaluateEpoch = [ & ]( const std::size_t epochIndex, const unsigned int threadIndex )
+    {
+        dynamicsStateDerivatives.at( threadIndex )->computeStateDerivative(
+                    outputEpochs.at( epochIndex ), states.at( epochIndex ) );
+        dependentVariablesPerEpoch.at( epochIndex ) = dependentVariableFunctions.at( threadIndex )( );
+    };
+
+    if( simulators.size( ) == 1 )
+    {
+        for( unsigned int i = 0; i < outputEpochs.size( ); i++ )
+        {
+            evaluateEpoch( i, 0 );
+        }
+    }
+    else
+    {
+        std::vector< SpiceAccessSynchronization > spiceAccessSynchronizations;
+        try
+        {
+            for( unsigned int i = 0; i < simulators.size( ); i++ )
+            {
+                tudat::simulation_setup::SystemOfBodies bodies = simulators.at( i )->getSystemOfBodies( );
+                spiceAccessSynchronizations.push_back( synchronizeSpiceAccess( bodies ) );
+            }
+            executeTasksInParallel( outputEpochs.size( ), static_cast< int >( simulators.size( ) ), evaluateEpoch );
+        }
+        catch( ... )
+        {
+            for( unsigned int i = 0; i < spiceAccessSynchronizations.size( ); i++ )
+            {
+                restoreSpiceAccess( spiceAccessSynchronizations.at( i ) );
+            }
+            throw;
+        }
+        for( unsigned int i = 0; i < spiceAccessSynchronizations.size( ); i++ )
+        {
+            restoreSpiceAccess( spiceAccessSynchronizations.at( i ) );
+        }
+
+        // Leave the environment of the dynamics simulator at the last epoch, as for a sequential evaluation
+        dynamicsStateDerivatives.at( 0 )->computeStateDerivative( outputEpochs.back( ), states.back( ) );
+    }
+
+    Eigen::Matrix< double, Eigen::Dynamic, Eigen::Dynamic, Eigen::RowMajor > dependentVariableValues(
+                outputEpochs.size( ), dependentVariablesPerEpoch.at( 0 ).rows( ) );
+    for( unsigned int i = 0; i < outputEpochs.size( ); i++ )
+    {
+        dependentVariableValues.row( i ) = dependentVariablesPerEpoch.at( i ).transpose( );
+    }
+    return dependentVariableValues;
+}
+
+} // namespace tudatpy
+
+#endif // TUDATPY_DEPENDENT_VARIABLE_POST_PROCESSING_H
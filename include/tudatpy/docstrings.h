@@ -11,6 +11,1975 @@ static inline std::string get_docstring(std::string name, int variant=0) {
 
 
 
+    } else if(name == "ExtendedSingleArcPropagatorProcessingSettings.output_interval") {
+         return R"(
+
+        Fixed interval between the epochs at which the results are saved, starting at the initial time.
+
+        If NaN, the results are saved according to the save frequency settings, or at the ``output_epochs``.
+        The states at epochs between two integration steps are integrated from the start of the step, with a
+        single step of the same integrator, so that their error is that of the integrator. These additional
+        integrations are included in the number of function evaluations of the propagation.
+
+        :type: float
+     )";
+
+
+
+    } else if(name == "ExtendedSingleArcPropagatorProcessingSettings.output_epochs") {
+         return R"(
+
+        Epochs at which the results are saved.
+
+        If empty, the results are saved according to the save frequency settings, or at the ``output_interval``.
+        As for the ``output_interval``, the states at epochs between two integration steps are integrated from
+        the start of the step.
+
+        :type: list[float]
+     )";
+
+
+
+
+    } else if(name == "expression_termination" && variant==0) {
+            return R"(
+
+        Factory function to create termination settings from a termination expression.
+
+        Factory function to create termination settings from a termination expression, such as
+        ``"altitude < 25.0E3 or ( mach < 3.0 and time > 1200.0 )"``. The expression is parsed once, and
+        converted to the native termination settings: each comparison becomes a dependent variable termination
+        condition (or a time or CPU time termination condition for the reserved names ``time`` and ``cpu_time``),
+        and the boolean operators ``and``/``&&``, ``or``/``||`` and ``not``/``!`` become hybrid termination
+        conditions (negations are propagated to the comparisons). All conditions are therefore evaluated in C++
+        during the propagation.
+
+        Each comparison is met once the variable is on the given side of the limit (strict and non-strict
+        comparisons are not distinguished), so that ``x < a`` terminates the propagation when ``x`` crosses ``a``
+        in negative direction, and ``x > a`` when it crosses ``a`` in positive direction. A comparison of
+        ``time`` is met when passing the limit in the direction of propagation, so that it must be
+        ``time > a`` for a forward propagation and ``time < a`` for a backward propagation (after negations are
+        applied); other comparisons of ``time`` raise an exception. ``cpu_time`` can only be used as upper
+        limit. Conditions that are re-armed after being met (hysteresis) are not supported.
+
+
+        Parameters
+        ----------
+        expression : str
+            Termination expression.
+        variables : dict[str, SingleDependentVariableSaveSettings], default={}
+            Dependent variable settings (of size 1) for each variable name used in the expression, other than
+            ``time`` and ``cpu_time`` (which are reserved).
+        terminate_exactly_on_final_condition : bool, default=False
+            Denotes whether the propagation is to terminate exactly on the condition that is met, or on the first
+            step where it is met. Exact termination is applied to all comparisons that are not part of a
+            conjunction (``and``).
+        termination_root_finder_settings : RootFinderSettings, default=None
+            Settings object to create root finder used to converge on exact final condition.
+        propagate_backwards : bool, default=False
+            Denotes whether the propagation runs backwards in time (negative time step), which determines the
+            direction in which ``time`` may be compared.
+
+        Returns
+        -------
+        PropagationTerminationSettings
+            Termination settings object (a hybrid termination settings object if the expression combines
+            several comparisons).
+    )";
+
+
+
+    } else if(name == "compute_dependent_variables" && variant==0) {
+            return R"(
+
+        Function to compute dependent variables after a propagation, from the propagated state history.
+
+        Function to compute dependent variables after a single-arc propagation, from the propagated state
+        history, so that dependent variables that are not needed during the propagation (e.g. for termination)
+        do not have to be computed at each step. At each requested epoch, the propagated state is set in the
+        environment and the state derivative models (including the accelerations) of the dynamics simulator
+        are updated, after which all dependent variables are evaluated at once. The environment of the
+        simulator is therefore left at the state of the last epoch.
+
+        If no epochs are given, the dependent variables are computed at the epochs of the propagated state
+        history. Otherwise, the propagated state at each epoch is interpolated from the state history
+        (8th-order Lagrange interpolation, or linear interpolation if the history contains fewer than 8
+        epochs), so that the epochs must be within the propagated interval. The accuracy of the results then
+        depends on the density of the saved state history.
+
+        The environment and models of a simulator can only be at one state at a time, so that, by default, the
+        epochs are evaluated one after the other on the dynamics simulator. To evaluate them concurrently, a
+        ``worker_simulator_factory`` can be provided, which is called (before the computation starts) once for each
+        additional thread, and must return a simulator with its own system of bodies: typically a simulator created,
+        without propagating, from a clone of the bodies (see :meth:`SystemOfBodies.clone`), with acceleration models
+        and propagator settings created for the clone in the same way as for the original propagation. The epochs are
+        then distributed over the threads, each evaluating its epochs on its own simulator, and the SPICE-based models
+        of all bodies are synchronized during the computation. The results do not depend on the number of threads.
+
+
+        Parameters
+        ----------
+        dynamics_simulator : SingleArcSimulator
+            Single-arc dynamics simulator with which the propagation was performed.
+        dependent_variable_settings : list[SingleDependentVariableSaveSettings]
+            Dependent variables to compute.
+        epochs : list[float], default=[]
+            Epochs at which the dependent variables are computed (epochs of the state history if empty).
+        worker_simulator_factory : Callable[[int], SingleArcSimulator], default=None
+            Function returning a simulator, with its own system of bodies, for a given worker index (from 0). If None,
+            the epochs are evaluated sequentially on the dynamics simulator.
+        number_of_threads : int, default=0
+            Number of threads to use if a ``worker_simulator_factory`` is provided (number of hardware threads if 0,
+            and at most the number of epochs).
+
+        Returns
+        -------
+        numpy.ndarray
+            Dependent variables, with one row per epoch: the epoch in the first column, followed by the
+            values of all dependent variables (in the order in which they are provided).
+    )";
+
+
+
+    } else if(name == "EventCrossingDirections") {
+         return R"(
+
+        Enumeration of the directions (in time) of the zero crossings of an event function that are detected as events.
+     )";
+
+
+
+    } else if(name == "EventCrossingDirections.any_crossing") {
+         return R"(
+
+        Both increasing and decreasing crossings are detected.
+     )";
+
+
+
+    } else if(name == "EventCrossingDirections.increasing_crossing") {
+         return R"(
+
+        Only crossings at which the event function changes from negative to non-negative are detected.
+     )";
+
+
+
+    } else if(name == "EventCrossingDirections.decreasing_crossing") {
+         return R"(
+
+        Only crossings at which the event function changes from positive to non-positive are detected.
+     )";
+
+
+
+    } else if(name == "EventSettings") {
+         return R"(
+
+        Settings for an event that is detected and located during a single-arc propagation.
+
+        An event occurs when the event function, computed from a list of dependent variables, crosses zero.
+        The dependent variables are evaluated with the environment of the propagation, but do not have to be
+        saved with the results. Instances of this class are created by the factory functions of this module
+        (e.g. :func:`custom_event`, :func:`apsis_event`), and are passed to the ``events`` of the
+        :class:`ExtendedSingleArcPropagatorProcessingSettings`.
+     )";
+
+
+
+    } else if(name == "EventSettings.event_name") {
+         return R"(
+
+        Name of the event, used to identify it in the detected events.
+
+        :type: str
+     )";
+
+
+
+    } else if(name == "EventSettings.crossing_direction") {
+         return R"(
+
+        Directions (in time) of the zero crossings that are detected as events.
+
+        :type: EventCrossingDirections
+     )";
+
+
+
+    } else if(name == "custom_event" && variant==0) {
+            return R"(
+
+        Function to create settings for an event with a user-defined event function.
+
+        Function to create settings for an event that occurs when a user-defined function of a list of dependent
+        variables crosses zero. The event function is evaluated after each integration step (and at additional
+        epochs within the step), so it should be inexpensive and free of side effects.
+
+
+        Parameters
+        ----------
+        event_name : str
+            Name of the event, used to identify it in the detected events.
+        dependent_variables : list[SingleDependentVariableSaveSettings]
+            Dependent variables from which the event function is computed.
+        event_function : Callable[[numpy.ndarray], float]
+            Function computing the value of the event function from the values of the dependent variables
+            (concatenated in the order in which they are provided).
+        crossing_direction : EventCrossingDirections, default=any_crossing
+            Directions (in time) of the zero crossings that are detected as events.
+        root_finder_settings : RootFinderSettings, default=None
+            Settings for the root finder used to locate the events. If None, bisection to an absolute tolerance of
+            1 microsecond is used. Only root finders that do not use the derivative of the event function (bisection,
+            secant) may be used.
+
+        Returns
+        -------
+        EventSettings
+            Settings for the event.
+    )";
+
+
+
+    } else if(name == "dependent_variable_event" && variant==0) {
+            return R"(
+
+        Function to create settings for an event at which a dependent variable crosses a threshold.
+
+        Function to create settings for an event at which a component of a dependent variable crosses a threshold
+        (e.g. an altitude or a latitude). The event function is the component minus the threshold.
+
+
+        Parameters
+        ----------
+        event_name : str
+            Name of the event, used to identify it in the detected events.
+        dependent_variable : SingleDependentVariableSaveSettings
+            Dependent variable that is compared to the threshold.
+        threshold : float
+            Value of the dependent variable at the event.
+        crossing_direction : EventCrossingDirections, default=any_crossing
+            Directions (in time) of the crossings of the threshold that are detected as events.
+        component_index : int, default=0
+            Index of the component of the dependent variable that is compared to the threshold.
+        root_finder_settings : RootFinderSettings, default=None
+            Settings for the root finder used to locate the events. If None, bisection to an absolute tolerance of
+            1 microsecond is used. Only root finders that do not use the derivative of the event function (bisection,
+            secant) may be used.
+
+        Returns
+        -------
+        EventSettings
+            Settings for the event.
+    )";
+
+
+
+    } else if(name == "apsis_event" && variant==0) {
+            return R"(
+
+        Function to create settings for apsis passages of a body with respect to a central body.
+
+        Function to create settings for apsis passages of a body with respect to a central body, at which the
+        radial velocity crosses zero. The event function (dot product of the relative position and velocity) is
+        increasing at periapsis and decreasing at apoapsis.
+
+
+        Parameters
+        ----------
+        event_name : str
+            Name of the event, used to identify it in the detected events.
+        body : str
+            Name of the orbiting body.
+        central_body : str
+            Name of the central body.
+        crossing_direction : EventCrossingDirections, default=any_crossing
+            Directions of the crossings that are detected (``increasing_crossing`` for periapsis passages only,
+            ``decreasing_crossing`` for apoapsis passages only).
+        root_finder_settings : RootFinderSettings, default=None
+            Settings for the root finder used to locate the events. If None, bisection to an absolute tolerance of
+            1 microsecond is used. Only root finders that do not use the derivative of the event function (bisection,
+            secant) may be used.
+
+        Returns
+        -------
+        EventSettings
+            Settings for the event.
+    )";
+
+
+
+    } else if(name == "node_event" && variant==0) {
+            return R"(
+
+        Function to create settings for node crossings of a body with respect to a central body.
+
+        Function to create settings for node crossings of a body with respect to a central body, at which the
+        component of the relative position along the z-axis of the global frame orientation crosses zero. The
+        event function is increasing at the ascending node and decreasing at the descending node.
+
+
+        Parameters
+        ----------
+        event_name : str
+            Name of the event, used to identify it in the detected events.
+        body : str
+            Name of the orbiting body.
+        central_body : str
+            Name of the central body.
+        crossing_direction : EventCrossingDirections, default=any_crossing
+            Directions of the crossings that are detected (``increasing_crossing`` for ascending nodes only,
+            ``decreasing_crossing`` for descending nodes only).
+        root_finder_settings : RootFinderSettings, default=None
+            Settings for the root finder used to locate the events. If None, bisection to an absolute tolerance of
+            1 microsecond is used. Only root finders that do not use the derivative of the event function (bisection,
+            secant) may be used.
+
+        Returns
+        -------
+        EventSettings
+            Settings for the event.
+    )";
+
+
+
+    } else if(name == "eclipse_event" && variant==0) {
+            return R"(
+
+        Function to create settings for eclipse entries and exits of a body.
+
+        Function to create settings for eclipse entries and exits of a body, using a conical shadow model with
+        spherical occulting and source bodies (with the average radii of their shape models). The event function
+        is the angular separation between the apparent discs of the source and occulting body, as seen from the
+        body, minus its value at the start of the penumbra or umbra. It is decreasing at eclipse entry and
+        increasing at eclipse exit.
+
+
+        Parameters
+        ----------
+        event_name : str
+            Name of the event, used to identify it in the detected events.
+        bodies : SystemOfBodies
+            System of bodies, from which the radii of the occulting and source body are retrieved.
+        body : str
+            Name of the body for which the eclipses are detected.
+        occulting_body : str
+            Name of the occulting body.
+        source_body : str, default="Sun"
+            Name of the source body.
+        use_umbra : bool, default=False
+            Boolean denoting whether the entry and exit of the umbra (instead of the penumbra) are detected.
+        crossing_direction : EventCrossingDirections, default=any_crossing
+            Directions of the crossings that are detected (``decreasing_crossing`` for eclipse entries only,
+            ``increasing_crossing`` for eclipse exits only).
+        root_finder_settings : RootFinderSettings, default=None
+            Settings for the root finder used to locate the events. If None, bisection to an absolute tolerance of
+            1 microsecond is used. Only root finders that do not use the derivative of the event function (bisection,
+            secant) may be used.
+
+        Returns
+        -------
+        EventSettings
+            Settings for the event.
+    )";
+
+
+
+    } else if(name == "elevation_event" && variant==0) {
+            return R"(
+
+        Function to create settings for the rise and set of a body as seen from a ground station.
+
+        Function to create settings for the rise and set of a body as seen from a ground station, at which the
+        elevation of the body above the local horizon of the station crosses a minimum elevation. The local
+        vertical is taken along the nominal (body-fixed) position vector of the station. The event function
+        (elevation minus minimum elevation) is increasing at rise and decreasing at set.
+
+
+        Parameters
+        ----------
+        event_name : str
+            Name of the event, used to identify it in the detected events.
+        bodies : SystemOfBodies
+            System of bodies, from which the ground station is retrieved.
+        body : str
+            Name of the body for which the rise and set are detected.
+        station_body : str
+            Name of the body on which the ground station is located.
+        station_name : str
+            Name of the ground station.
+        minimum_elevation : float, default=0.0
+            Elevation (in radians) at rise and set.
+        crossing_direction : EventCrossingDirections, default=any_crossing
+            Directions of the crossings that are detected (``increasing_crossing`` for rises only,
+            ``decreasing_crossing`` for sets only).
+        root_finder_settings : RootFinderSettings, default=None
+            Settings for the root finder used to locate the events. If None, bisection to an absolute tolerance of
+            1 microsecond is used. Only root finders that do not use the derivative of the event function (bisection,
+            secant) may be used.
+
+        Returns
+        -------
+        EventSettings
+            Settings for the event.
+    )";
+
+
+
+    } else if(name == "ExtendedSingleArcPropagatorProcessingSettings.events") {
+         return R"(
+
+        Settings for the events that are detected and located during the propagation.
+
+        After each integration step, the event functions are evaluated at the start, middle and end of the step
+        (and at the extremum of the quadratic polynomial through these values, so that two crossings within one
+        step are detected). Each crossing is first located on the state interpolated within the step, and then
+        refined on the state integrated from the start of the step, so that the event epoch is not affected by the
+        interpolation error. More than two crossings of one event function within a single step may be missed;
+        limit the maximum step size of the integrator if this can occur. Events do not terminate the propagation.
+
+        :type: list[EventSettings]
+     )";
+
+
+
+    } else if(name == "DetectedEvent") {
+         return R"(
+
+        Event located during a single-arc propagation.
+     )";
+
+
+
+    } else if(name == "DetectedEvent.event_name") {
+         return R"(
+
+        Name of the event, as provided in its settings.
+
+        :type: str
+     )";
+
+
+
+    } else if(name == "DetectedEvent.epoch") {
+         return R"(
+
+        Epoch at which the event function crosses zero.
+
+        :type: float
+     )";
+
+
+
+    } else if(name == "DetectedEvent.is_increasing") {
+         return R"(
+
+        Boolean denoting whether the event function is increasing (in time) at the crossing.
+
+        :type: bool
+     )";
+
+
+
+    } else if(name == "DetectedEvent.state") {
+         return R"(
+
+        Propagated (processed, e.g. Cartesian) state at the epoch of the event.
+
+        :type: numpy.ndarray
+     )";
+
+
+
+    } else if(name == "SingleArcStepwiseSimulator.detected_events") {
+         return R"(
+
+        Events located so far during the propagation, in the order of detection.
+
+        :type: list[DetectedEvent]
+     )";
+
+
+
+    } else if(name == "SingleArcStepwiseSimulator.event_epochs") {
+         return R"(
+
+        Epochs of the events located so far during the propagation, per event name, in the order of detection.
+
+        :type: dict[str, list[float]]
+     )";
+
+
+
+    } else if(name == "compute_residuals_and_partials_in_parallel" && variant==0) {
+            return R"(
+
+        Function to compute the residuals and observation partials of an observation collection concurrently.
+
+        Function to compute the residuals and the partials of all observations of a collection w.r.t. the estimated
+        parameters (design matrix) concurrently, with one task per single observation set, and one worker thread per
+        estimator. The estimators must be equivalent (same observation settings, parameters and propagator settings),
+        but must each use their own system of bodies (e.g. created by the same function, or by
+        :meth:`~tudatpy.numerical_simulation.environment.SystemOfBodies.clone`). The SPICE-based ephemerides and
+        rotation models of these bodies are replaced by wrappers that serialize the calls to SPICE, which is not
+        thread-safe, while the partials are computed; the original models are put back afterwards.
+
+        The results of each observation set are written to the rows of that set in the concatenated observation
+        vector of the collection, and are computed by the same sequence of operations whichever thread evaluates
+        them, so that they are identical for any number of estimators.
+
+
+        Parameters
+        ----------
+        estimators : list[Estimator]
+            Estimators used by the worker threads (one per thread).
+        observation_collection : ObservationCollection
+            Observations for which the residuals and partials are computed.
+        parameter_values : numpy.ndarray, default=[]
+            Parameter values at which the residuals and partials are computed. If empty, the current parameter values
+            of the estimators are used. Otherwise, each estimator is first reset to these values, and its
+            variational equations are reintegrated (concurrently).
+
+        Returns
+        -------
+        tuple[numpy.ndarray, numpy.ndarray]
+            Residuals (observed minus computed) of all observations, and the design matrix (partials of all
+            observations w.r.t. the estimated parameters, one row per observation).
+    )";
+
+
+
+    } else if(name == "StreamingEstimationOutput") {
+         return R"(
+
+        Results of an estimation or covariance analysis in which the design matrix is not stored.
+
+        Results of :func:`perform_streaming_estimation` and :func:`compute_streaming_covariance`. The covariance
+        quantities are those of the normal equations at the final parameter estimate (for an estimation: at the
+        start of the iteration with the lowest rms residual), computed in the same manner as by
+        :meth:`Estimator.perform_estimation`.
+     )";
+
+
+
+    } else if(name == "StreamingEstimationOutput.parameter_estimate") {
+         return R"(
+
+        Final parameter estimate (that of the iteration with the lowest rms residual).
+
+        :type: numpy.ndarray
+     )";
+
+
+
+    } else if(name == "StreamingEstimationOutput.final_residuals") {
+         return R"(
+
+        Residuals (observed minus computed) of all observations at the final parameter estimate.
+
+        :type: numpy.ndarray
+     )";
+
+
+
+    } else if(name == "StreamingEstimationOutput.normalization_terms") {
+         return R"(
+
+        Normalization terms of the parameters, by which the columns of the design matrix are divided
+        before the normal equations are solved.
+
+        :type: numpy.ndarray
+     )";
+
+
+
+    } else if(name == "StreamingEstimationOutput.inverse_covariance") {
+         return R"(
+
+        Inverse of the (unnormalized) covariance matrix: the normal matrix plus the inverse a priori covariance.
+
+        :type: numpy.ndarray
+     )";
+
+
+
+    } else if(name == "StreamingEstimationOutput.covariance") {
+         return R"(
+
+        Unnormalized covariance matrix of the parameters.
+
+        :type: numpy.ndarray
+     )";
+
+
+
+    } else if(name == "StreamingEstimationOutput.formal_errors") {
+         return R"(
+
+        Formal errors of the parameters (square roots of the diagonal of the covariance matrix).
+
+        :type: numpy.ndarray
+     )";
+
+
+
+    } else if(name == "StreamingEstimationOutput.parameter_history") {
+         return R"(
+
+        Parameter estimate at the start of each iteration, followed by the estimate computed in the last
+        iteration. For a covariance analysis, only the parameter values at which it is performed.
+
+        :type: list[numpy.ndarray]
+     )";
+
+
+
+    } else if(name == "StreamingEstimationOutput.rms_residual_history") {
+         return R"(
+
+        Rms residual of each iteration. For a covariance analysis, only the rms residual at the parameter values
+        at which it is performed.
+
+        :type: list[float]
+     )";
+
+
+
+    } else if(name == "StreamingEstimationOutput.best_iteration") {
+         return R"(
+
+        Index of the iteration of the final parameter estimate.
+
+        :type: int
+     )";
+
+
+
+    } else if(name == "perform_streaming_estimation" && variant==0) {
+            return R"(
+
+        Function to perform an iterative least-squares estimation without storing the design matrix.
+
+        Function to perform an iterative least-squares estimation that follows the iterations of
+        :meth:`Estimator.perform_estimation`, but does not store the design matrix. In each iteration, the
+        observations are divided into blocks, of which the partials are computed concurrently (one worker thread
+        per estimator) and added to the normal equations, after which the partials are discarded. The contributions
+        of the blocks are added in a fixed order, so that the results are identical for any number of estimators.
+        Observation sets that are larger than the block size are split into ranges of observation times, so that
+        each block has fewer than twice ``minimum_block_size`` observations. Memory use is of the order of the
+        number of estimators, times the block size plus the number of parameters, times the number of parameters,
+        in addition to the residual vector, independently of the size of the observation sets. The iterations stop
+        when the convergence checker of the estimation input is satisfied; the parameter estimate with the lowest
+        rms residual is returned, and set in all estimators.
+
+        The estimators must be equivalent (same observation settings, parameters and propagator settings), but must
+        each use their own system of bodies (e.g. created by the same function, or by
+        :meth:`~tudatpy.numerical_simulation.environment.SystemOfBodies.clone`). The SPICE-based ephemerides and
+        rotation models of these bodies are replaced by wrappers that serialize the calls to SPICE while the
+        normal equations are accumulated; the original models are put back afterwards.
+
+
+        Parameters
+        ----------
+        estimators : list[Estimator]
+            Estimators used by the worker threads (one per thread). The parameter values of the first estimator are
+            used as initial estimate.
+        estimation_input : EstimationInput
+            Observations, weights, a priori covariance and convergence checker of the estimation.
+        minimum_block_size : int, default=0
+            Minimum number of observations per block. If zero or negative, the maximum of the number of parameters
+            and 1000 is used. Observation sets with more observations are split into ranges of observation times of
+            at most this size, so that blocks have fewer than twice this number of observations.
+
+        Returns
+        -------
+        StreamingEstimationOutput
+            Parameter estimate, residuals, covariance and formal errors, and the history of the iterations.
+    )";
+
+
+
+    } else if(name == "perform_estimation_in_parallel" && variant==0) {
+            return R"(
+
+        Function to perform an iterative least-squares estimation on multiple threads.
+
+        Function to perform an iterative least-squares estimation that follows the iterations of
+        :meth:`Estimator.perform_estimation`, with the observations and partials of each iteration computed on
+        multiple threads. The estimators used by the threads are created by the ``estimator_factory``, which is
+        called once per thread (with the index of the thread), before the threads are started. Each call must
+        return a new estimator with the same observation settings, parameters and propagator settings, but with its
+        own system of bodies (for instance, by creating the bodies inside the factory). The estimation itself is
+        performed by :func:`perform_streaming_estimation`, so that the design matrix is not stored, and the results
+        are identical for any number of threads.
+
+
+        Parameters
+        ----------
+        estimator_factory : Callable[[int], Estimator]
+            Function that creates the estimator of a thread, called with the index of the thread. The parameter
+            values of the estimator of thread 0 are used as initial estimate, and the final estimate is set in all
+            estimators.
+        estimation_input : EstimationInput
+            Observations, weights, a priori covariance and convergence checker of the estimation.
+        number_of_threads : int, default=0
+            Number of threads (and estimators). If zero or negative, the number of hardware threads is used.
+        minimum_block_size : int, default=0
+            Minimum number of observations per block (see :func:`perform_streaming_estimation`).
+
+        Returns
+        -------
+        StreamingEstimationOutput
+            Parameter estimate, residuals, covariance and formal errors, and the history of the iterations.
+    )";
+
+
+
+    } else if(name == "compute_streaming_covariance" && variant==0) {
+            return R"(
+
+        Function to perform a covariance analysis without storing the design matrix.
+
+        Function to perform a covariance analysis at the current parameter values of the estimators, in the same
+        manner as :meth:`Estimator.compute_covariance`, but without storing the design matrix. The normal equations
+        are accumulated block by block, with the partials of each block computed concurrently (one worker thread per
+        estimator), as in :func:`perform_streaming_estimation`. All estimators are first reset to the parameter
+        values of the first estimator. The same requirements on the estimators apply as for
+        :func:`perform_streaming_estimation`.
+
+
+        Parameters
+        ----------
+        estimators : list[Estimator]
+            Estimators used by the worker threads (one per thread).
+        covariance_analysis_input : CovarianceAnalysisInput
+            Observations, weights and a priori covariance of the covariance analysis.
+        minimum_block_size : int, default=0
+            Minimum number of observations per block. If zero or negative, the maximum of the number of parameters
+            and 1000 is used. Observation sets with more observations are split into ranges of observation times of
+            at most this size, so that blocks have fewer than twice this number of observations.
+
+        Returns
+        -------
+        StreamingEstimationOutput
+            Residuals, covariance and formal errors at the current parameter values.
+    )";
+
+
+
+    } else if(name == "SquareRootInformationFilter") {
+         return R"(
+
+        Sequential square-root information filter (SRIF) for the parameters of an estimator.
+
+        Sequential square-root information filter, which processes observations batch by batch as they become
+        available, instead of re-estimating the parameters from the full set of observations. The filter variables
+        are the estimated parameters, with the initial state replaced by the state at the current epoch of the filter
+        (see :attr:`current_epoch`). The information on these variables is stored as an upper-triangular matrix
+        :math:`R` and vector :math:`z`, such that the least-squares estimate of their deviation :math:`\Delta y` from
+        the reference trajectory satisfies :math:`R\Delta y=z`. Each batch is added by a Householder QR
+        decomposition, so that the cost of an update only depends on the number of parameters and the size of the
+        batch.
+
+        Between batches, the filter can be moved to a later epoch with :meth:`propagate_to_epoch`, which maps the
+        information with the state transition and sensitivity matrices of the estimator, and adds process noise to
+        the state. Without propagation (or process noise), the estimate and covariance after all observations are
+        added are equal (to numerical precision) to those of a single iteration of :meth:`Estimator.perform_estimation`
+        with the same observations, weights and a priori covariance.
+
+        The filter is linear: observations are always linearized at the reference trajectory, defined by the
+        reference parameters. Use :meth:`relinearize` to move the reference to the current estimate before adding
+        further observations. As the dynamics of the estimator start at the initial epoch of its propagation, the
+        reference trajectory is always integrated from that epoch, and its variational equations must cover all
+        epochs of the observations and of the propagation of the filter.
+     )";
+
+
+
+    } else if(name == "SquareRootInformationFilter.ctor" && variant==0) {
+            return R"(
+
+        Constructor.
+
+        Constructor of the filter, which takes the current parameter values of the estimator as a priori estimate and
+        initial reference parameters.
+
+
+        Parameters
+        ----------
+        estimator : Estimator
+            Estimator of which the parameters are estimated, and of which the observation managers and state
+            transition interface are used.
+        inverse_apriori_covariance : numpy.ndarray, default=[]
+            Inverse of the a priori covariance of the parameters (must be positive definite). If empty, no a priori
+            information is used, so that the parameters can only be estimated once the observations fully determine
+            them.
+    )";
+
+
+
+    } else if(name == "SquareRootInformationFilter.add_observations" && variant==0) {
+            return R"(
+
+        Function to add a batch of observations to the filter.
+
+        Function to add a batch of observations to the filter. The residuals and partials of the observations are
+        computed with the observation managers of the estimator, at the reference parameters (the parameters are
+        defined at the initial epoch of the propagation, and mapped to the epochs of the observations with the
+        state transition and sensitivity matrices of the estimator, which must cover these epochs). The
+        observations are processed one observation set at a time, so that the partials of only one set are stored
+        at a time.
+
+
+        Parameters
+        ----------
+        observation_collection : ObservationCollection
+            Observations to add.
+        weights : numpy.ndarray
+            Non-negative weights of the observations, in the order of the concatenated observation vector of the
+            collection.
+
+        Returns
+        -------
+        numpy.ndarray
+            Residuals (observed minus computed) of the observations w.r.t. the reference parameters, in the order of
+            the concatenated observation vector of the collection.
+    )";
+
+
+
+    } else if(name == "SquareRootInformationFilter.add_observations" && variant==1) {
+            return R"(
+
+        Function to add a batch of observations to the filter.
+
+        Function to add a batch of observations to the filter. The residuals and partials of the observations are
+        computed with the observation managers of the estimator, at the reference parameters (the parameters are
+        defined at the initial epoch of the propagation, and mapped to the epochs of the observations with the
+        state transition and sensitivity matrices of the estimator, which must cover these epochs). The
+        observations are processed one observation set at a time, so that the partials of only one set are stored
+        at a time.
+
+
+        Parameters
+        ----------
+        observation_collection : ObservationCollection
+            Observations to add.
+        weight : float, default=1.0
+            Weight of all observations.
+
+        Returns
+        -------
+        numpy.ndarray
+            Residuals (observed minus computed) of the observations w.r.t. the reference parameters, in the order of
+            the concatenated observation vector of the collection.
+    )";
+
+
+
+    } else if(name == "SquareRootInformationFilter.relinearize" && variant==0) {
+            return R"(
+
+        Function to move the reference parameters to the current estimate.
+
+        Function to move the reference parameters, at which the residuals and partials of new observations are
+        computed, to the current estimate. The parameters of the estimator are reset, and its variational equations
+        are reintegrated from the initial epoch. If the filter has been propagated, the estimate of the state at the
+        current epoch is first mapped back to an equivalent initial state (see :attr:`parameter_estimate`). The
+        information of the observations processed so far is kept, linearized at the previous reference parameters.
+    )";
+
+
+
+    } else if(name == "SquareRootInformationFilter.propagate_to_epoch" && variant==0) {
+            return R"(
+
+        Function to propagate the filter to a later epoch.
+
+        Function to propagate the filter to a later epoch (time update): the information on the filter variables is
+        mapped to the new epoch with the state transition and sensitivity matrices of the estimator, after which
+        process noise is added to the state, eliminating the noise variables with a QR decomposition. The process
+        noise de-weights the information of the observations processed before, for instance to account for
+        unmodelled accelerations. The parameters other than the initial state are mapped unchanged.
+
+
+        Parameters
+        ----------
+        epoch : float
+            Epoch to which the filter is propagated. May not be before the current epoch.
+        process_noise_covariance : numpy.ndarray, default=[]
+            Covariance of the process noise added to the state between the current epoch and the new epoch
+            (symmetric positive semi-definite, of the size of the propagated state). If empty, the process noise
+            function is used (see :meth:`set_process_noise_function`); if that is not set either, no process noise
+            is added.
+    )";
+
+
+
+    } else if(name == "SquareRootInformationFilter.set_process_noise_function" && variant==0) {
+            return R"(
+
+        Function to set the process noise function of the filter.
+
+        Function to set the function returning the process noise covariance of the state between two epochs, which is
+        used by :meth:`propagate_to_epoch` when no process noise covariance is provided.
+
+
+        Parameters
+        ----------
+        process_noise_function : Callable[[float, float], numpy.ndarray]
+            Function returning the process noise covariance, called with the current epoch of the filter and the
+            epoch to which it is propagated. If None, no process noise is added.
+    )";
+
+
+
+    } else if(name == "SquareRootInformationFilter.propagated_covariance" && variant==0) {
+            return R"(
+
+        Function to propagate the current covariance of the parameters to a list of epochs.
+
+        Function to propagate the current covariance of the parameters to a list of epochs, with the state transition
+        and sensitivity matrices of the estimator.
+
+
+        Parameters
+        ----------
+        output_times : list[float]
+            Epochs at which the covariance is computed.
+
+        Returns
+        -------
+        dict[float, numpy.ndarray]
+            Propagated covariance, per epoch.
+    )";
+
+
+
+    } else if(name == "SquareRootInformationFilter.parameter_estimate") {
+         return R"(
+
+        Current estimate of the parameters. If the filter has been propagated, the estimate of the state at the
+        current epoch is mapped back to the equivalent initial state (to first order, including the effect of the
+        process noise). An exception is raised if the information matrix is singular.
+
+        :type: numpy.ndarray
+     )";
+
+
+
+    } else if(name == "SquareRootInformationFilter.covariance") {
+         return R"(
+
+        Current covariance of the parameters. If the filter has been propagated, the covariance of the state at the
+        current epoch is mapped back to the initial epoch (see :attr:`parameter_estimate`). An exception is raised if
+        the information matrix is singular.
+
+        :type: numpy.ndarray
+     )";
+
+
+
+    } else if(name == "SquareRootInformationFilter.current_epoch") {
+         return R"(
+
+        Current epoch of the filter: the epoch to which it has been propagated, or the initial epoch of the
+        propagation of the estimator if it has not been propagated.
+
+        :type: float
+     )";
+
+
+
+    } else if(name == "SquareRootInformationFilter.current_covariance") {
+         return R"(
+
+        Current covariance of the filter variables: the parameters, with the initial state replaced by the state at
+        the current epoch. An exception is raised if the information matrix is singular.
+
+        :type: numpy.ndarray
+     )";
+
+
+
+    } else if(name == "SquareRootInformationFilter.formal_errors") {
+         return R"(
+
+        Current formal errors of the parameters (square roots of the diagonal of the covariance).
+
+        :type: numpy.ndarray
+     )";
+
+
+
+    } else if(name == "SquareRootInformationFilter.square_root_information_matrix") {
+         return R"(
+
+        Upper-triangular square root :math:`R` of the information matrix of the filter variables (at the current
+        epoch), with :math:`R^{T}R` the information matrix.
+
+        :type: numpy.ndarray
+     )";
+
+
+
+    } else if(name == "SquareRootInformationFilter.information_vector") {
+         return R"(
+
+        Information vector :math:`z`, with :math:`R\Delta y=z` for the deviation :math:`\Delta y` of the filter variables
+        from the reference trajectory.
+
+        :type: numpy.ndarray
+     )";
+
+
+
+    } else if(name == "SquareRootInformationFilter.reference_parameters") {
+         return R"(
+
+        Parameter values at which the residuals and partials of new observations are computed.
+
+        :type: numpy.ndarray
+     )";
+
+
+
+    } else if(name == "SquareRootInformationFilter.residual_sum_of_squares") {
+         return R"(
+
+        Weighted sum of squares of the residuals of the least-squares solution, for all observations processed so far.
+
+        :type: float
+     )";
+
+
+
+    } else if(name == "SquareRootInformationFilter.number_of_observations") {
+         return R"(
+
+        Number of observations processed so far.
+
+        :type: int
+     )";
+
+
+
+    } else if(name == "SquareRootInformationFilter.number_of_batches") {
+         return R"(
+
+        Number of batches of observations processed so far.
+
+        :type: int
+     )";
+
+
+
+    } else if(name == "propagate_covariance_rsw_stacked_output" && variant==0) {
+            return R"(
+
+        Function to propagate a covariance matrix to a list of epochs in the RSW frame, as stacked arrays.
+
+        Function to propagate the covariance of an estimation to a list of epochs, and rotate it to the RSW frame of
+        the estimated bodies, returning the results as a single three-dimensional array (instead of a list of
+        matrices, as :func:`propagate_covariance_rsw_split_output`). For a single-arc estimation, the covariance of
+        all parameters is returned. For a multi- or hybrid-arc estimation, the covariance of the propagated state at
+        each epoch is returned: the single-arc states, followed by the states of the arc containing the epoch.
+
+        The translational state of each estimated body is rotated to the RSW frame of that body w.r.t. its central
+        body (radial, along-track, cross-track), at each epoch; entries of other parameters are not rotated. Only
+        the rows of the state transition and sensitivity matrix that belong to the propagated states are used, so
+        that the cost per epoch scales with the square of the number of parameters (instead of its cube). For a
+        multi- or hybrid-arc estimation, each epoch is assigned to the last arc that starts at or before it, and the
+        epochs of each arc are processed as a separate task, concurrently. The results do not depend on the number
+        of threads.
+
+
+        Parameters
+        ----------
+        covariance_output : CovarianceAnalysisOutput
+            Output of the covariance analysis or estimation, of which the (unnormalized) covariance is propagated.
+        estimator : Estimator
+            Estimator of the covariance analysis, from which the state transition and sensitivity matrices, the
+            estimated parameters and the bodies defining the RSW frames are retrieved.
+        output_times : list[float]
+            Epochs at which the covariance is computed.
+        number_of_threads : int, default=0
+            Number of threads to use. If zero or negative, the number of hardware threads is used (at most one
+            thread per arc).
+
+        Returns
+        -------
+        tuple[numpy.ndarray, numpy.ndarray]
+            Epochs (size N), and propagated covariance in the RSW frame at each epoch (size N x m x m), in the order
+            of ``output_times``. Here, m is the number of parameters for a single-arc estimation, and the size of the
+            propagated state otherwise.
+    )";
+
+
+
+    } else if(name == "propagate_formal_errors_rsw_stacked_output" && variant==0) {
+            return R"(
+
+        Function to propagate the formal errors to a list of epochs in the RSW frame, as stacked arrays.
+
+        Function to propagate the formal errors of an estimation to a list of epochs, in the RSW frame of the
+        estimated bodies, returning the results as a single two-dimensional array (instead of a list of vectors, as
+        :func:`propagate_formal_errors_rsw_split_output`). The formal errors are computed from the diagonal of the
+        propagated covariance only, without forming the full propagated covariance. The entries are those of
+        :func:`propagate_covariance_rsw_stacked_output`.
+
+        The translational state of each estimated body is rotated to the RSW frame of that body w.r.t. its central
+        body (radial, along-track, cross-track), at each epoch; entries of other parameters are not rotated. Only
+        the rows of the state transition and sensitivity matrix that belong to the propagated states are used, so
+        that the cost per epoch scales with the square of the number of parameters (instead of its cube). For a
+        multi- or hybrid-arc estimation, each epoch is assigned to the last arc that starts at or before it, and the
+        epochs of each arc are processed as a separate task, concurrently. The results do not depend on the number
+        of threads.
+
+
+        Parameters
+        ----------
+        covariance_output : CovarianceAnalysisOutput
+            Output of the covariance analysis or estimation, of which the (unnormalized) covariance is propagated.
+        estimator : Estimator
+            Estimator of the covariance analysis, from which the state transition and sensitivity matrices, the
+            estimated parameters and the bodies defining the RSW frames are retrieved.
+        output_times : list[float]
+            Epochs at which the formal errors are computed.
+        number_of_threads : int, default=0
+            Number of threads to use. If zero or negative, the number of hardware threads is used (at most one
+            thread per arc).
+
+        Returns
+        -------
+        tuple[numpy.ndarray, numpy.ndarray]
+            Epochs (size N), and propagated formal errors in the RSW frame at each epoch (size N x m), in the order
+            of ``output_times``. Here, m is the number of parameters for a single-arc estimation, and the size of the
+            propagated state otherwise.
+    )";
+
+
+
+    } else if(name == "profiling" && variant==0) {
+            return R"(
+
+        Function to create settings for profiling the propagation loop of a single-arc propagation.
+
+        Function to create settings for profiling the propagation loop of a single-arc propagation, for use as the
+        ``profiling`` argument of :class:`ExtendedSingleArcPropagatorProcessingSettings`. The timing of the
+        integration steps, state derivative evaluations, termination conditions, result processing and of each
+        dependent variable is recorded in the evaluations performed by the propagation itself. Each acceleration model
+        is timed by evaluating it once more after each state derivative evaluation (at the same time, and in the same
+        environment), which roughly doubles the cost of the acceleration models while profiling, but does not modify
+        the propagation results. The remainder of the state derivative evaluation time, dominated by the update of the
+        environment, is recorded as the ``Environment update`` quantity. Custom (Python) acceleration models and
+        dependent variables are given the ``custom_callback`` category. The results are available from the
+        ``profiler`` of the :class:`SingleArcStepwiseSimulator`.
+
+
+        Parameters
+        ----------
+        record_trace_events : bool, default=False
+            Boolean denoting whether the individual timing measurements are stored, so that they can be written to a
+            trace file with :meth:`PropagationProfiler.write_chrome_trace`.
+        maximum_number_of_trace_events : int, default=1000000
+            Maximum number of timing measurements that is stored.
+
+        Returns
+        -------
+        ProfilingSettings
+            Settings for profiling the propagation loop.
+    )";
+
+
+
+    } else if(name == "ProfiledQuantity.category") {
+         return R"(
+
+        Category of the profiled quantity: ``propagation`` (integration step, result processing), ``state_derivative``,
+        ``environment`` (environment update), ``acceleration``, ``dependent_variable``, ``termination`` or
+        ``custom_callback`` (custom acceleration models and custom dependent variables).
+
+        :type: str
+     )";
+
+
+
+    } else if(name == "SingleArcStepwiseSimulator.is_integrated_state_size_fixed") {
+         return R"(
+
+        Boolean denoting whether the current (or last) propagation integrates the state with fixed-size types. This is
+        the case when the propagated state is the Cartesian state of a single body (size 6) and a Runge-Kutta
+        integrator is used; the operations of the integrator on the state then do not use the heap. Each evaluation of
+        the state derivative model of Tudat still allocates its (dynamic-size) result. Propagations of this type are
+        performed by this simulator when created with ``create_dynamics_simulator``, also without
+        :class:`ExtendedSingleArcPropagatorProcessingSettings`, unless Tudat is to print output.
+
+        :type: bool
+     )";
+
+
+
+    } else if(name == "SystemOfBodies.clone" && variant==0) {
+            return R"(
+
+        Function to create a copy of the system of bodies that shares the read-only environment models of the original.
+
+        Function to create a copy of the system of bodies, for use in a propagation that runs concurrently with
+        propagations using the original (or other copies), without duplicating the memory of large models. Each body of
+        the copy has its own current state, orientation and mass. Ephemerides, time-only rotation models, gravity fields
+        without time variations, shape models, atmosphere models, mass functions and inertia tensors are shared (models
+        that keep internal state, such as SPICE or tabulated models, through synchronized wrappers). Aerodynamic
+        coefficient tables and functions are shared through a synchronized wrapper that stores the current coefficients
+        of the copy, and radiation pressure interfaces are recreated with the same coefficient and area, bound to the
+        bodies of the copy. The original bodies are not modified.
+
+        Aerodynamic coefficient interfaces with control surfaces, radiation pressure interfaces with occulting bodies,
+        ground stations, vehicle systems, time-variable gravity fields and rotation models that depend on the state of
+        the bodies cannot be copied.
+
+
+        Parameters
+        ----------
+        skip_models_not_cloned : bool, default=False
+            Boolean denoting whether the copy is created without the models that cannot be copied. If false, an
+            exception listing these models is raised if the bodies contain any of them.
+
+        Returns
+        -------
+        SystemOfBodies
+            Copy of the system of bodies.
+    )";
+
+
+
+    } else if(name == "custom_acceleration" && variant==1) {
+            return R"(
+
+        Creates settings for a custom acceleration model, computed by a native (compiled) function.
+
+        Creates settings for a custom acceleration model, computed by a native function with the C signature
+
+        ``void acceleration_function(double time, double* acceleration, void* user_data)``
+
+        which fills the acceleration (3 entries, in the inertial frame of the propagation) at the given time.
+
+        The native function is given as the address of a C function (e.g. the ``address`` attribute of a numba
+        ``cfunc``, or the address of a ``ctypes`` function pointer, obtained with ``ctypes.cast(f, ctypes.c_void_p).value``),
+        and is called directly from the propagation, without the GIL, so that it must not call into the Python
+        interpreter. Output arrays are allocated by tudatpy and must be completely filled by the function. In concurrent
+        propagations the function may be called from several threads at the same time. See
+        ``include/tudatpy/nativeCallbacks.h`` for the definition of the ABI.
+
+
+        Parameters
+        ----------
+        acceleration_function : int
+            Address of the native acceleration function.
+        user_data : int, default=0
+            Address passed unchanged as the last argument of each call of the native function(s) (e.g. the
+            ``ctypes.data`` address of a numpy array holding the parameters of the callback); 0 passes a null pointer.
+            The memory at this address is not managed by tudatpy, and must remain valid as long as the settings are
+            used.
+
+        Returns
+        -------
+        CustomAccelerationSettings
+            Custom acceleration settings object.
+    )";
+
+
+
+    } else if(name == "custom_thrust_magnitude" && variant==1) {
+            return R"(
+
+        Creates settings for a thrust magnitude and specific impulse computed by native (compiled) functions.
+
+        Creates settings for a thrust magnitude and specific impulse computed by native functions, both with the C
+        signature
+
+        ``double function(double time, void* user_data)``
+
+        which return the thrust magnitude (in N) and specific impulse (in s) at the given time. Both functions receive
+        the same user data.
+
+        The native function is given as the address of a C function (e.g. the ``address`` attribute of a numba
+        ``cfunc``, or the address of a ``ctypes`` function pointer, obtained with ``ctypes.cast(f, ctypes.c_void_p).value``),
+        and is called directly from the propagation, without the GIL, so that it must not call into the Python
+        interpreter. Output arrays are allocated by tudatpy and must be completely filled by the function. In concurrent
+        propagations the function may be called from several threads at the same time. See
+        ``include/tudatpy/nativeCallbacks.h`` for the definition of the ABI.
+
+
+        Parameters
+        ----------
+        thrust_magnitude_function : int
+            Address of the native thrust magnitude function.
+        specific_impulse_function : int
+            Address of the native specific impulse function.
+        user_data : int, default=0
+            Address passed unchanged as the last argument of each call of the native function(s) (e.g. the
+            ``ctypes.data`` address of a numpy array holding the parameters of the callback); 0 passes a null pointer.
+            The memory at this address is not managed by tudatpy, and must remain valid as long as the settings are
+            used.
+
+        Returns
+        -------
+        CustomThrustMagnitudeSettings
+            Thrust magnitude settings object.
+    )";
+
+
+
+    } else if(name == "custom_thrust_magnitude_fixed_isp" && variant==1) {
+            return R"(
+
+        Creates settings for a thrust magnitude computed by a native (compiled) function, with a constant specific impulse.
+
+        Creates settings for a thrust magnitude computed by a native function with the C signature
+
+        ``double thrust_magnitude_function(double time, void* user_data)``
+
+        which returns the thrust magnitude (in N) at the given time, and a constant specific impulse.
+
+        The native function is given as the address of a C function (e.g. the ``address`` attribute of a numba
+        ``cfunc``, or the address of a ``ctypes`` function pointer, obtained with ``ctypes.cast(f, ctypes.c_void_p).value``),
+        and is called directly from the propagation, without the GIL, so that it must not call into the Python
+        interpreter. Output arrays are allocated by tudatpy and must be completely filled by the function. In concurrent
+        propagations the function may be called from several threads at the same time. See
+        ``include/tudatpy/nativeCallbacks.h`` for the definition of the ABI.
+
+
+        Parameters
+        ----------
+        thrust_magnitude_function : int
+            Address of the native thrust magnitude function.
+        specific_impulse : float
+            Constant specific impulse (in s).
+        user_data : int, default=0
+            Address passed unchanged as the last argument of each call of the native function(s) (e.g. the
+            ``ctypes.data`` address of a numpy array holding the parameters of the callback); 0 passes a null pointer.
+            The memory at this address is not managed by tudatpy, and must remain valid as long as the settings are
+            used.
+
+        Returns
+        -------
+        CustomThrustMagnitudeSettings
+            Thrust magnitude settings object.
+    )";
+
+
+
+    } else if(name == "custom_dependent_variable" && variant==1) {
+            return R"(
+
+        Function to add a custom dependent variable, computed by a native (compiled) function, to the dependent variables to save.
+
+        Function to add a custom dependent variable, computed by a native function with the C signature
+
+        ``void custom_function(double* dependent_variable, int32_t variable_size, void* user_data)``
+
+        which fills the dependent variable (of ``variable_size`` entries) from the current environment. As for custom
+        dependent variables defined by a Python function, the current time is not passed to the function; a function
+        that needs it can read it from its user data, written by another native callback evaluated at the same time
+        (e.g. a custom acceleration, which is evaluated before the dependent variables).
+
+        The native function is given as the address of a C function (e.g. the ``address`` attribute of a numba
+        ``cfunc``, or the address of a ``ctypes`` function pointer, obtained with ``ctypes.cast(f, ctypes.c_void_p).value``),
+        and is called directly from the propagation, without the GIL, so that it must not call into the Python
+        interpreter. Output arrays are allocated by tudatpy and must be completely filled by the function. In concurrent
+        propagations the function may be called from several threads at the same time. See
+        ``include/tudatpy/nativeCallbacks.h`` for the definition of the ABI.
+
+
+        Parameters
+        ----------
+        custom_function : int
+            Address of the native dependent variable function.
+        variable_size : int
+            Size of the dependent variable.
+        user_data : int, default=0
+            Address passed unchanged as the last argument of each call of the native function(s) (e.g. the
+            ``ctypes.data`` address of a numpy array holding the parameters of the callback); 0 passes a null pointer.
+            The memory at this address is not managed by tudatpy, and must remain valid as long as the settings are
+            used.
+
+        Returns
+        -------
+        CustomDependentVariableSaveSettings
+            Custom dependent variable settings object.
+    )";
+
+
+
+    } else if(name == "custom_state" && variant==1) {
+            return R"(
+
+        Creates the settings for a custom state propagator, with a state derivative computed by a native (compiled) function.
+
+        Creates the settings for a custom state propagator, with a state derivative computed by a native function with
+        the C signature
+
+        ``void state_derivative_function(double time, const double* state, double* state_derivative, int32_t state_size, void* user_data)``
+
+        which fills the state derivative (of ``state_size`` entries) for the given time and state.
+
+        The native function is given as the address of a C function (e.g. the ``address`` attribute of a numba
+        ``cfunc``, or the address of a ``ctypes`` function pointer, obtained with ``ctypes.cast(f, ctypes.c_void_p).value``),
+        and is called directly from the propagation, without the GIL, so that it must not call into the Python
+        interpreter. Output arrays are allocated by tudatpy and must be completely filled by the function. In concurrent
+        propagations the function may be called from several threads at the same time. See
+        ``include/tudatpy/nativeCallbacks.h`` for the definition of the ABI.
+
+
+        Parameters
+        ----------
+        state_derivative_function : int
+            Address of the native state derivative function.
+        initial_state : numpy.ndarray
+            Initial state of the propagation.
+        initial_time : float
+            Initial time of the propagation.
+        integrator_settings : IntegratorSettings
+            Integration settings of the propagation.
+        termination_settings : PropagationTerminationSettings
+            Termination settings of the propagation.
+        output_variables : list[SingleDependentVariableSaveSettings], default=[]
+            Dependent variables to save during the propagation.
+        processing_settings : SingleArcPropagatorProcessingSettings, default=SingleArcPropagatorProcessingSettings()
+            Settings for the processing of the propagation output.
+        user_data : int, default=0
+            Address passed unchanged as the last argument of each call of the native function(s) (e.g. the
+            ``ctypes.data`` address of a numpy array holding the parameters of the callback); 0 passes a null pointer.
+            The memory at this address is not managed by tudatpy, and must remain valid as long as the settings are
+            used.
+
+        Returns
+        -------
+        CustomStatePropagatorSettings
+            Custom state propagator settings object.
+    )";
+
+
+
+    } else if(name == "custom_termination" && variant==1) {
+            return R"(
+
+        Function to create a propagation termination setting based on a native (compiled) function.
+
+        Function to create a propagation termination setting based on a native function with the C signature
+
+        ``int32_t custom_condition(double time, void* user_data)``
+
+        which returns a non-zero value if the propagation is to be terminated at the given time.
+
+        The native function is given as the address of a C function (e.g. the ``address`` attribute of a numba
+        ``cfunc``, or the address of a ``ctypes`` function pointer, obtained with ``ctypes.cast(f, ctypes.c_void_p).value``),
+        and is called directly from the propagation, without the GIL, so that it must not call into the Python
+        interpreter. Output arrays are allocated by tudatpy and must be completely filled by the function. In concurrent
+        propagations the function may be called from several threads at the same time. See
+        ``include/tudatpy/nativeCallbacks.h`` for the definition of the ABI.
+
+
+        Parameters
+        ----------
+        custom_condition : int
+            Address of the native termination function.
+        user_data : int, default=0
+            Address passed unchanged as the last argument of each call of the native function(s) (e.g. the
+            ``ctypes.data`` address of a numpy array holding the parameters of the callback); 0 passes a null pointer.
+            The memory at this address is not managed by tudatpy, and must remain valid as long as the settings are
+            used.
+
+        Returns
+        -------
+        PropagationCustomTerminationSettings
+            Custom termination settings object.
+    )";
+
+
+
+    } else if(name == "SingleArcSimulator.reset_initial_state_and_propagate" && variant==0) {
+            return R"(
+
+        Function to propagate again from a new initial state, reusing all models created by the simulator.
+
+        Function to propagate again from a new initial state, reusing the acceleration models, state derivative models,
+        environment updater, termination conditions and dependent variable functions created by the simulator, so that
+        only the integrator is reset. The initial time and all other settings are those of the propagator settings with
+        which the simulator was created (which are not modified). The GIL is released during the propagation.
+
+        .. warning::
+
+            The returned results object is the :attr:`propagation_results` object of the simulator, which is overwritten
+            in place by the next call of this function (or of :meth:`reset_initial_states_and_propagate`). Results
+            that are to be kept must be copied (e.g. the ``state_history``) before propagating again.
+
+
+        Parameters
+        ----------
+        initial_state : numpy.ndarray
+            New initial (processed, e.g. Cartesian) state of the propagation, of the same size as the initial state of
+            the propagator settings.
+
+        Returns
+        -------
+        SingleArcSimulationResults
+            Results of the propagation (the results object of the simulator, overwritten by the next propagation).
+    )";
+
+
+
+    } else if(name == "SingleArcSimulator.reset_initial_states_and_propagate" && variant==0) {
+            return R"(
+
+        Function to propagate from a series of initial states, reusing all models created by the simulator.
+
+        Function to propagate from a series of initial states, one after the other, reusing all models created by the
+        simulator (see :meth:`reset_initial_state_and_propagate`). The GIL is released during the propagations.
+
+        The results of each propagation are copied from the results object of the simulator after the propagation, so
+        that the results in the returned object are not modified by later propagations. The :attr:`propagation_results`
+        object of the simulator itself is overwritten in place by each propagation (it holds the results of the last
+        one after this function returns), as are results written to a result sink.
+
+
+        Parameters
+        ----------
+        initial_states : numpy.ndarray
+            Initial (processed, e.g. Cartesian) states of the propagations, one per row.
+
+        Returns
+        -------
+        BatchPropagationResults
+            Results of the propagations, with the reason of failure of each unsuccessful propagation.
+    )";
+
+
+
+    } else if(name == "PolynomialThrustFrames") {
+         return R"(
+
+        Enumeration of the frames in which the thrust vector of a :class:`PiecewisePolynomialThrustProfile` can be defined.
+     )";
+
+
+
+    } else if(name == "PolynomialThrustFrames.inertial_polynomial_thrust_frame") {
+         return R"(
+
+        Thrust vector defined in the inertial frame (global frame orientation) of the propagation.
+     )";
+
+
+
+    } else if(name == "PolynomialThrustFrames.rsw_polynomial_thrust_frame") {
+         return R"(
+
+        Thrust vector defined in the RSW frame of the vehicle w.r.t. the central body (R: along the relative position,
+        W: along the orbital angular momentum, S: completing the right-handed frame).
+     )";
+
+
+
+    } else if(name == "PolynomialThrustFrames.tnw_polynomial_thrust_frame") {
+         return R"(
+
+        Thrust vector defined in the TNW frame of the vehicle w.r.t. the central body (T: along the relative velocity,
+        W: along the orbital angular momentum, N: completing the right-handed frame, towards the central body).
+     )";
+
+
+
+    } else if(name == "PiecewisePolynomialThrustProfile") {
+         return R"(
+
+        Thrust vector profile defined by a piecewise polynomial of time, in an inertial, RSW or TNW frame.
+
+        Thrust vector profile defined by a piecewise polynomial of time, with three components, in one of the
+        :class:`PolynomialThrustFrames`. The thrust magnitude and inertial thrust direction are computed entirely in
+        C++, and are used in a propagation through the thrust magnitude settings created by
+        :func:`piecewise_polynomial_thrust_magnitude` and the rotation model settings created by
+        :func:`piecewise_polynomial_thrust_orientation`. Instances of this class are created by
+        :func:`piecewise_polynomial_thrust_profile`.
+     )";
+
+
+
+    } else if(name == "PiecewisePolynomialThrustProfile.thrust_magnitude" && variant==0) {
+            return R"(
+
+        Function to compute the thrust magnitude at the given time.
+
+
+        Parameters
+        ----------
+        time : float
+            Time at which the thrust is evaluated.
+
+        Returns
+        -------
+        float
+            Thrust magnitude (in N); zero outside of the segments of the profile.
+    )";
+
+
+
+    } else if(name == "PiecewisePolynomialThrustProfile.inertial_thrust_direction" && variant==0) {
+            return R"(
+
+        Function to compute the thrust direction in the inertial frame at the given time.
+
+        Function to compute the thrust direction in the inertial frame at the given time. For an RSW or TNW thrust
+        frame, the frame is computed from the current states of the vehicle and central body in the environment. If
+        the thrust is zero, the direction of the first axis of the thrust frame is returned, so that the orientation
+        of the vehicle remains defined.
+
+
+        Parameters
+        ----------
+        time : float
+            Time at which the thrust is evaluated.
+
+        Returns
+        -------
+        numpy.ndarray
+            Unit vector of the thrust direction in the inertial frame.
+    )";
+
+
+
+    } else if(name == "PiecewisePolynomialThrustProfile.thrust_frame") {
+         return R"(
+
+        **read-only**
+
+        Frame in which the thrust vector of the profile is defined.
+
+        :type: PolynomialThrustFrames
+     )";
+
+
+
+    } else if(name == "piecewise_polynomial_thrust_profile" && variant==0) {
+            return R"(
+
+        Function to create a thrust vector profile defined by a piecewise polynomial of time.
+
+        Function to create a thrust vector profile defined by a piecewise polynomial of time. In segment i (between
+        the segment boundaries t_i and t_i+1), the thrust vector (in N) in the thrust frame is
+
+        .. math::
+            \mathbf{F}(t) = \sum_k \mathbf{c}_{ik} ( t - t_i )^k
+
+        with :math:`\mathbf{c}_{ik}` the k-th row of the coefficient matrix of segment i. The polynomial order may
+        differ between segments. Outside of the segments, the thrust is zero. The profile is evaluated without memory
+        allocation, and the segment containing the evaluation time is found from the segment of the previous
+        evaluation, so that its evaluation cost does not depend on the number of segments during a propagation.
+
+        The profile is used in a propagation by creating an engine with thrust magnitude settings from
+        :func:`piecewise_polynomial_thrust_magnitude` (with the default body-fixed thrust direction along the x-axis),
+        and setting the rotation model of the vehicle from :func:`piecewise_polynomial_thrust_orientation`.
+
+
+        Parameters
+        ----------
+        bodies : SystemOfBodies
+            System of bodies containing the vehicle (and central body).
+        body_name : str
+            Name of the vehicle.
+        segment_boundaries : list[float]
+            Times of the segment boundaries (size equal to the number of segments + 1, increasing).
+        segment_coefficients : list[numpy.ndarray]
+            Coefficients of each segment, with row k containing the coefficients of ( t - t_i )^k, and 3 columns (one
+            per component of the thrust vector).
+        thrust_frame : PolynomialThrustFrames, default=inertial_polynomial_thrust_frame
+            Frame in which the thrust vector is defined.
+        central_body : str, default=""
+            Name of the body w.r.t. which the RSW or TNW frame is defined (required for these frames, unused for an
+            inertial frame).
+
+        Returns
+        -------
+        PiecewisePolynomialThrustProfile
+            Piecewise polynomial thrust profile.
+    )";
+
+
+
+    } else if(name == "piecewise_polynomial_thrust_magnitude" && variant==0) {
+            return R"(
+
+        Function to create thrust magnitude settings from a piecewise polynomial thrust profile, with constant specific impulse.
+
+
+        Parameters
+        ----------
+        thrust_profile : PiecewisePolynomialThrustProfile
+            Thrust profile from which the thrust magnitude is computed.
+        specific_impulse : float
+            Constant specific impulse (in s).
+
+        Returns
+        -------
+        ThrustMagnitudeSettings
+            Thrust magnitude settings, to be used to create an engine model with :func:`~tudatpy.numerical_simulation.environment_setup.add_engine_model`.
+    )";
+
+
+
+    } else if(name == "piecewise_polynomial_thrust_orientation" && variant==0) {
+            return R"(
+
+        Function to create rotation model settings that align the body-fixed x-axis of the vehicle with a piecewise polynomial thrust profile.
+
+        Function to create rotation model settings for the vehicle, such that its body-fixed x-axis is aligned with
+        the inertial thrust direction of a piecewise polynomial thrust profile. Combined with an engine with body-fixed
+        thrust direction along the x-axis (the default of
+        :func:`~tudatpy.numerical_simulation.environment_setup.add_engine_model`), the thrust is applied in the
+        direction of the profile.
+
+
+        Parameters
+        ----------
+        thrust_profile : PiecewisePolynomialThrustProfile
+            Thrust profile from which the thrust direction is computed.
+        base_frame : str
+            Base frame of the rotation model.
+        target_frame : str
+            Target (body-fixed) frame of the rotation model.
+
+        Returns
+        -------
+        RotationModelSettings
+            Rotation model settings, to be used with :func:`~tudatpy.numerical_simulation.environment_setup.add_rotation_model`.
+    )";
+
+
+
+    } else if(name == "piecewise_polynomial_thrust_magnitude" && variant==1) {
+            return R"(
+
+        Function to create thrust magnitude settings from a piecewise polynomial thrust profile, with tabulated specific impulse.
+
+        Function to create thrust magnitude settings from a piecewise polynomial thrust profile, with the specific
+        impulse interpolated from a table as a function of time. A table with a single entry gives a constant specific
+        impulse.
+
+
+        Parameters
+        ----------
+        thrust_profile : PiecewisePolynomialThrustProfile
+            Thrust profile from which the thrust magnitude is computed.
+        specific_impulse_table : dict[float, float]
+            Specific impulse (in s) as a function of time.
+        interpolator_settings : InterpolatorSettings, default=None
+            Settings for the interpolation of the specific impulse table (linear interpolation, with the boundary values
+            used outside of the table, if None).
+
+        Returns
+        -------
+        ThrustMagnitudeSettings
+            Thrust magnitude settings, to be used to create an engine model with :func:`~tudatpy.numerical_simulation.environment_setup.add_engine_model`.
+    )";
+
+
+
+    } else if(name == "AerodynamicGuidanceIndependentVariables") {
+         return R"(
+
+        Enumeration of the quantities by which the table of a :class:`TabulatedAerodynamicGuidance` can be indexed.
+     )";
+
+
+
+    } else if(name == "AerodynamicGuidanceIndependentVariables.time_guidance_variable") {
+         return R"(
+
+        Current time.
+     )";
+
+
+
+    } else if(name == "AerodynamicGuidanceIndependentVariables.altitude_guidance_variable") {
+         return R"(
+
+        Altitude of the vehicle, from its flight conditions w.r.t. the central body.
+     )";
+
+
+
+    } else if(name == "AerodynamicGuidanceIndependentVariables.airspeed_guidance_variable") {
+         return R"(
+
+        Airspeed of the vehicle, from its flight conditions w.r.t. the central body.
+     )";
+
+
+
+    } else if(name == "AerodynamicGuidanceIndependentVariables.mach_number_guidance_variable") {
+         return R"(
+
+        Mach number of the vehicle, from its (atmospheric) flight conditions w.r.t. the central body.
+     )";
+
+
+
+    } else if(name == "AerodynamicGuidanceIndependentVariables.specific_energy_guidance_variable") {
+         return R"(
+
+        Specific energy of the vehicle w.r.t. the central body, computed from its airspeed and distance to the central
+        body as :math:`v^2 / 2 - \mu / r`.
+     )";
+
+
+
+    } else if(name == "TabulatedAerodynamicGuidance") {
+         return R"(
+
+        Aerodynamic guidance that interpolates the aerodynamic angles from a table.
+
+        Aerodynamic guidance that interpolates the angle of attack, sideslip angle and bank angle from a table, indexed
+        by one of the :class:`AerodynamicGuidanceIndependentVariables`. The guidance is evaluated entirely in C++, so
+        that a propagation using it (through
+        :func:`~tudatpy.numerical_simulation.environment_setup.rotation_model.aerodynamic_angle_based`) does not call
+        into Python. Instances of this class are created by :func:`tabulated_aerodynamic_guidance`.
+
+        Optionally, the sign of the bank angle is reversed each time the independent variable passes one of the bank
+        reversal values. The reversals are determined from the current value of the independent variable only, so that
+        each evaluation at the same state gives the same angles. For this purpose, time is assumed to increase, and the
+        other independent variables to decrease during the flight (as for an entry), so that a reversal at a value v is
+        active for times at or after v, or for other independent variables below v. With n active reversals, the bank
+        angle of the table is multiplied by (-1)^n.
+     )";
+
+
+
+    } else if(name == "TabulatedAerodynamicGuidance.aerodynamic_angles" && variant==0) {
+            return R"(
+
+        Function to update the guidance, and retrieve the aerodynamic angles.
+
+        Function to update the guidance to the given time and the current flight conditions of the vehicle, and to
+        retrieve the resulting aerodynamic angles (including the active bank reversals).
+
+
+        Parameters
+        ----------
+        current_time : float
+            Time at which the guidance is evaluated.
+
+        Returns
+        -------
+        numpy.ndarray
+            Angle of attack, sideslip angle and bank angle (in radians).
+    )";
+
+
+
+    } else if(name == "TabulatedAerodynamicGuidance.independent_variable") {
+         return R"(
+
+        **read-only**
+
+        Quantity by which the guidance table is indexed.
+
+        :type: AerodynamicGuidanceIndependentVariables
+     )";
+
+
+
+    } else if(name == "TabulatedAerodynamicGuidance.bank_reversal_values") {
+         return R"(
+
+        **read-only**
+
+        Values of the independent variable at which the sign of the bank angle is reversed (sorted).
+
+        :type: list[float]
+     )";
+
+
+
+    } else if(name == "tabulated_aerodynamic_guidance" && variant==0) {
+            return R"(
+
+        Function to create an aerodynamic guidance that interpolates the aerodynamic angles from a table.
+
+        Function to create an aerodynamic guidance that interpolates the angle of attack, sideslip angle and bank angle
+        from a table, indexed by time or by a quantity computed from the current flight conditions of the vehicle
+        w.r.t. the central body (see :class:`TabulatedAerodynamicGuidance`). The guidance is used in a propagation by
+        setting the rotation model of the vehicle with
+        :func:`~tudatpy.numerical_simulation.environment_setup.rotation_model.aerodynamic_angle_based`. Unless the
+        guidance is indexed by time, the vehicle must have flight conditions during the propagation (e.g. created with
+        an aerodynamic acceleration).
+
+        Optionally, the sign of the bank angle is reversed each time the independent variable passes one of the bank
+        reversal values. The reversals are determined from the current value of the independent variable only, so that
+        each evaluation at the same state gives the same angles. For this purpose, time is assumed to increase, and the
+        other independent variables to decrease during the flight (as for an entry), so that a reversal at a value v is
+        active for times at or after v, or for other independent variables below v. With n active reversals, the bank
+        angle of the table is multiplied by (-1)^n.
+
+
+        Parameters
+        ----------
+        bodies : SystemOfBodies
+            System of bodies containing the vehicle and central body.
+        body_name : str
+            Name of the vehicle.
+        central_body_name : str
+            Name of the body w.r.t. which the flight conditions (and specific energy) are computed.
+        independent_variable : AerodynamicGuidanceIndependentVariables
+            Quantity by which the guidance table is indexed.
+        guidance_table : dict[float, numpy.ndarray]
+            Angle of attack, sideslip angle and bank angle (in radians, in that order) as a function of the independent
+            variable; at least two entries are required.
+        bank_reversal_values : list[float], default=[]
+            Values of the independent variable at which the sign of the bank angle is reversed.
+        interpolator_settings : InterpolatorSettings, default=None
+            Settings for the interpolation of the guidance table (linear interpolation, with the boundary values used
+            outside of the table, if None).
+
+        Returns
+        -------
+        TabulatedAerodynamicGuidance
+            Tabulated aerodynamic guidance.
+    )";
+
+
+
+    } else if(name == "aerodynamic_angle_based" && variant==1) {
+            return R"(
+
+        Function for creating rotation model settings based on the aerodynamic angles computed by a guidance object.
+
+        Function for creating rotation model settings based on the aerodynamic angles (angle of attack, sideslip angle,
+        bank angle) computed by an aerodynamic guidance object, w.r.t. a central body. At each evaluation, the guidance
+        is updated to the current time, and its current angles are used. For a guidance object implemented in C++
+        (e.g. created with :func:`~tudatpy.numerical_simulation.propagation.tabulated_aerodynamic_guidance`), the
+        angles are computed without calling into Python; a guidance object derived in Python from
+        ``AerodynamicGuidance`` is called through Python at each evaluation.
+
+
+        Parameters
+        ----------
+        central_body : str
+            Name of the body w.r.t. which the aerodynamic angles are defined.
+        base_frame : str
+            Base frame of the rotation model.
+        target_frame : str
+            Target (body-fixed) frame of the rotation model.
+        aerodynamic_guidance : AerodynamicGuidance
+            Guidance object computing the aerodynamic angles.
+
+        Returns
+        -------
+        RotationModelSettings
+            Rotation model settings, to be used with :func:`~tudatpy.numerical_simulation.environment_setup.add_rotation_model`.
+    )";
+
+
 
     } else {
         return "No documentation found.";
@@ -0,0 +1,697 @@
+/*    Copyright (c) 2010-2022, Delft University of Technology
+ *    All rights reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ */
+
+#ifndef TUDATPY_EVENT_DETECTION_H
+#define TUDATPY_EVENT_DETECTION_H
+
+#include <algorithm>
+#include <cmath>
+#include <functional>
+#include <map>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include <Eigen/Core>
+
+#include "tudat/math/basic/function.h"
+#include "tudat/math/root_finders/createRootFinder.h"
+#include "tudat/simulation/propagation_setup.h"
+
+namespace tudatpy
+{
+
+//! Directions of the zero crossings of an event function that are detected as events
+enum EventCrossingDirections
+{
+    any_crossing,
+    increasing_crossing,
+    decreasing_crossing
+};
+
+//! Settings for an event that is detected and located during a single-arc propagation
+/*!
+ * Settings for an event that is detected and located during a single-arc propagation. An event occurs when the event
+ * function, which is computed from a list of dependent variables, crosses zero. The dependent variables are evaluated
+ * with the environment of the propagation, but do not have to be saved with the results.
+ */
+class EventSettings
+{
+public:
+
+    //! Constructor
+    /*!
+     * Constructor
+     * \param eventName Name of the event, used to identify it in the detected events
+     * \param dependentVariables Dependent variables from which the event function is computed
+     * \param eventFunction Function computing the value of the event function from the dependent variables (concatenated
+     * in the order in which they are provided)
+     * \param crossingDirection Directions (in time) of the zero crossings that are detected as events
+     * \param rootFinderSettings Settings for the root finder used to locate the events (if nullptr, bisection to an
+     * absolute tolerance of 1 microsecond is used). Since the derivative of the event function is not available, only
+     * root finders that do not use derivatives (bisection, secant) may be used.
+     */
+    EventSettings( const std::string& eventName,
+                   const std::vector< std::shared_ptr< tudat::propagators::SingleDependentVariableSaveSettings > >& dependentVariables,
+                   const std::function< double( const Eigen::VectorXd& ) > eventFunction,
+                   const EventCrossingDirections crossingDirection = any_crossing,
+                   const std::shared_ptr< tudat::root_finders::RootFinderSettings > rootFinderSettings = nullptr ):
+        eventName_( eventName ), dependentVariables_( dependentVariables ), eventFunction_( eventFunction ),
+        crossingDirection_( crossingDirection ), rootFinderSettings_( rootFinderSettings )
+    {
+        if( dependentVariables_.size( ) == 0 )
+        {
+            throw std::runtime_error( "Error when creating event settings for " + eventName_ +
+                                      ", no dependent variables provided" );
+        }
+        if( rootFinderSettings_ == nullptr )
+        {
+            rootFinderSettings_ = tudat::root_finders::bisectionRootFinderSettings(
+                        TUDAT_NAN, 1.0E-6, TUDAT_NAN, 1000, tudat::root_finders::accept_result_with_warning );
+        }
+    }
+
+    std::string getEventName( )
+    {
+        return eventName_;
+    }
+
+    std::vector< std::shared_ptr< tudat::propagators::SingleDependentVariableSaveSettings > > getDependentVariables( )
+    {
+        return dependentVariables_;
+    }
+
+    std::function< double( const Eigen::VectorXd& ) > getEventFunction( )
+    {
+        return eventFunction_;
+    }
+
+    EventCrossingDirections getCrossingDirection( )
+    {
+        return crossingDirection_;
+    }
+
+    std::shared_ptr< tudat::root_finders::RootFinderSettings > getRootFinderSettings( )
+    {
+        return rootFinderSettings_;
+    }
+
+protected:
+
+    std::string eventName_;
+
+    std::vector< std::shared_ptr< tudat::propagators::SingleDependentVariableSaveSettings > > dependentVariables_;
+
+    std::function< double( const Eigen::VectorXd& ) > eventFunction_;
+
+    EventCrossingDirections crossingDirection_;
+
+    std::shared_ptr< tudat::root_finders::RootFinderSettings > rootFinderSettings_;
+};
+
+//! Event located during a single-arc propagation
+class DetectedEvent
+{
+public:
+
+    //! Constructor
+    /*!
+     * Constructor
+     * \param eventName Name of the event
+     * \param epoch Epoch at which the event function crosses zero
+     * \param isIncreasing Boolean denoting whether the event function is increasing (in time) at the crossing
+     * \param state Propagated (processed, e.g. Cartesian) state at the event epoch
+     */
+    DetectedEvent( const std::string& eventName,
+                   const double epoch,
+                   const bool isIncreasing,
+                   const Eigen::VectorXd& state ):
+        eventName_( eventName ), epoch_( epoch ), isIncreasing_( isIncreasing ), state_( state ){ }
+
+    std::string getEventName( )
+    {
+        return eventName_;
+    }
+
+    double getEpoch( )
+    {
+        return epoch_;
+    }
+
+    bool getIsIncreasing( )
+    {
+        return isIncreasing_;
+    }
+
+    Eigen::VectorXd getState( )
+    {
+        return state_;
+    }
+
+protected:
+
+    std::string eventName_;
+
+    double epoch_;
+
+    bool isIncreasing_;
+
+    Eigen::VectorXd state_;
+};
+
+//! Function to retrieve the epochs of the detected events, per event name, in the order of detection
+inline std::map< std::string, std::vector< double > > getEventEpochs(
+        const std::vector< std::shared_ptr< DetectedEvent > >& detectedEvents )
+{
+    std::map< std::string, std::vector< double > > eventEpochs;
+    for( unsigned int i = 0; i < detectedEvents.size( ); i++ )
+    {
+        eventEpochs[ detectedEvents.at( i )->getEventName( ) ].push_back( detectedEvents.at( i )->getEpoch( ) );
+    }
+    return eventEpochs;
+}
+
+//! Class to detect and locate the events of a single-arc propagation, within each integration step
+/*!
+ * Class to detect and locate the events of a single-arc propagation, within each integration step. After each step,
+ * the event functions are evaluated at the end and the middle of the step, and compared to their values at the start of
+ * the step. If the quadratic polynomial through these three values has an extremum within the step (i.e. the derivative
+ * of the event function changes sign), the event function is also evaluated at the extremum, so that two crossings
+ * within a single step (e.g. a grazing eclipse) are detected. Crossings are bracketed between these samples, and
+ * located with a root finder in two stages: first on the state interpolated within the step (which is cheap), and then
+ * on the state integrated from the start of the step, in a narrow bracket around the first estimate, so that the event
+ * epoch is not affected by the interpolation error. Crossings of an event function that are not resolved by these
+ * samples (e.g. more than two crossings within a single step) may still be missed.
+ */
+template< typename StateScalarType = double, typename TimeType = double >
+class EventDetector
+{
+public:
+
+    //! Constructor
+    /*!
+     * Constructor
+     * \param eventSettings Settings for the events that are to be detected
+     * \param bodies System of bodies used in the propagation
+     * \param stateDerivativeModels State derivative models of the propagation
+     */
+    EventDetector( const std::vector< std::shared_ptr< EventSettings > >& eventSettings,
+                   const tudat::simulation_setup::SystemOfBodies& bodies,
+                   const std::unordered_map< tudat::propagators::IntegratedStateType,
+                   std::vector< std::shared_ptr< tudat::propagators::SingleStateTypeDerivative< StateScalarType, TimeType > > > >&
+                   stateDerivativeModels ):
+        eventSettings_( eventSettings )
+    {
+        for( unsigned int i = 0; i < eventSettings_.size( ); i++ )
+        {
+            dependentVariableFunctions_.push_back(
+                        tudat::propagators::createDependentVariableListFunction< TimeType, StateScalarType >(
+                            eventSettings_.at( i )->getDependentVariables( ), bodies, stateDerivativeModels ).first );
+        }
+        previousEventValues_ = Eigen::VectorXd::Constant( eventSettings_.size( ), TUDAT_NAN );
+    }
+
+    //! Function to compute the values of all event functions, using the current environment
+    Eigen::VectorXd computeEventValues( )
+    {
+        Eigen::VectorXd eventValues( eventSettings_.size( ) );
+        for( unsigned int i = 0; i < eventSettings_.size( ); i++ )
+        {
+            eventValues( i ) = computeEventValue( i );
+        }
+        return eventValues;
+    }
+
+    //! Function to set the values of the event functions at the current time, from which the next step starts
+    void resetEventValues( )
+    {
+        previousEventValues_ = computeEventValues( );
+    }
+
+    //! Function to detect and locate the events within an integration step
+    /*!
+     * Function to detect and locate the events within an integration step. The environment must be updated to the end
+     * of the step when this function is called; it is left at an arbitrary epoch within the step afterwards.
+     * \param previousTime Time at the start of the step
+     * \param newTime Time at the end of the step
+     * \param updateEnvironmentToInterpolatedState Function updating the environment to the given epoch within the step,
+     * using the state interpolated within the step
+     * \param updateEnvironmentToIntegratedState Function updating the environment to the given epoch within the step,
+     * using the state integrated from the start of the step
+     * \param getOutputState Function returning the (processed) state at the given epoch within the step
+     * \return Events located within the step, sorted in the direction of propagation
+     */
+    std::vector< std::shared_ptr< DetectedEvent > > locateEventsInStep(
+            const TimeType previousTime,
+            const TimeType newTime,
+            const std::function< void( const double ) > updateEnvironmentToInterpolatedState,
+            const std::function< void( const double ) > updateEnvironmentToIntegratedState,
+            const std::function< Eigen::VectorXd( const double ) > getOutputState )
+    {
+        const Eigen::VectorXd newEventValues = computeEventValues( );
+        const bool isForwardPropagation = ( newTime >= previousTime );
+
+        // Event function values at the earlier end, middle and later end of the step
+        const double earlierTime = static_cast< double >( isForwardPropagation ? previousTime : newTime );
+        const double laterTime = static_cast< double >( isForwardPropagation ? newTime : previousTime );
+        const double middleTime = 0.5 * ( earlierTime + laterTime );
+        const Eigen::VectorXd earlierEventValues = isForwardPropagation ? previousEventValues_ : newEventValues;
+        const Eigen::VectorXd laterEventValues = isForwardPropagation ? newEventValues : previousEventValues_;
+        updateEnvironmentToInterpolatedState( middleTime );
+        const Eigen::VectorXd middleEventValues = computeEventValues( );
+
+        std::vector< std::shared_ptr< DetectedEvent > > locatedEvents;
+        for( unsigned int i = 0; i < eventSettings_.size( ); i++ )
+        {
+            std::vector< double > sampleTimes = { earlierTime, middleTime, laterTime };
+            std::vector< double > sampleValues = { earlierEventValues( i ), middleEventValues( i ), laterEventValues( i ) };
+
+            double extremumTime;
+            if( findExtremumInStep( sampleTimes, sampleValues, extremumTime ) )
+            {
+                updateEnvironmentToInterpolatedState( extremumTime );
+                const unsigned int insertionIndex = ( extremumTime < middleTime ) ? 1 : 2;
+                sampleTimes.insert( sampleTimes.begin( ) + insertionIndex, extremumTime );
+                sampleValues.insert( sampleValues.begin( ) + insertionIndex, computeEventValue( i ) );
+            }
+
+            for( unsigned int j = 0; j < sampleTimes.size( ) - 1; j++ )
+            {
+                if( isCrossingDetected( sampleValues.at( j ), sampleValues.at( j + 1 ),
+                                        eventSettings_.at( i )->getCrossingDirection( ) ) )
+                {
+                    double eventEpoch = locateEvent( i, sampleTimes.at( j ), sampleTimes.at( j + 1 ),
+                                                     updateEnvironmentToInterpolatedState );
+                    eventEpoch = refineEventEpoch( i, eventEpoch, sampleTimes.at( j ), sampleTimes.at( j + 1 ),
+                                                   sampleValues.at( j ) < 0.0, updateEnvironmentToIntegratedState );
+                    locatedEvents.push_back( std::make_shared< DetectedEvent >(
+                                                 eventSettings_.at( i )->getEventName( ), eventEpoch,
+                                                 sampleValues.at( j ) < 0.0, getOutputState( eventEpoch ) ) );
+                }
+            }
+        }
+        previousEventValues_ = newEventValues;
+
+        std::sort( locatedEvents.begin( ), locatedEvents.end( ),
+                   [ = ]( const std::shared_ptr< DetectedEvent > event1, const std::shared_ptr< DetectedEvent > event2 )
+        {
+            return isForwardPropagation ? ( event1->getEpoch( ) < event2->getEpoch( ) ) :
+                                          ( event1->getEpoch( ) > event2->getEpoch( ) );
+        } );
+        return locatedEvents;
+    }
+
+    std::vector< std::shared_ptr< EventSettings > > getEventSettings( )
+    {
+        return eventSettings_;
+    }
+
+protected:
+
+    //! Function to compute the value of the event function with the given index, using the current environment
+    double computeEventValue( const unsigned int eventIndex )
+    {
+        return eventSettings_.at( eventIndex )->getEventFunction( )( dependentVariableFunctions_.at( eventIndex )( ) );
+    }
+
+    //! Function to check whether a zero crossing in the requested direction occurs between two event function values
+    bool isCrossingDetected( const double earlierValue, const double laterValue,
+                             const EventCrossingDirections crossingDirection )
+    {
+        if( std::isnan( earlierValue ) || std::isnan( laterValue ) )
+        {
+            return false;
+        }
+
+        // A crossing is only detected if the event function is non-zero at the earlier end of the step, so that an event
+        // located at the boundary between two steps is not detected twice
+        const bool isIncreasingCrossing = ( earlierValue < 0.0 && laterValue >= 0.0 );
+        const bool isDecreasingCrossing = ( earlierValue > 0.0 && laterValue <= 0.0 );
+        switch( crossingDirection )
+        {
+        case any_crossing:
+            return isIncreasingCrossing || isDecreasingCrossing;
+        case increasing_crossing:
+            return isIncreasingCrossing;
+        case decreasing_crossing:
+            return isDecreasingCrossing;
+        default:
+            throw std::runtime_error( "Error when detecting event, crossing direction not recognized" );
+        }
+    }
+
+    //! Function to find the extremum within a step of the quadratic polynomial through three event function values
+    /*!
+     * Function to find the extremum within a step of the quadratic polynomial through the event function values at the
+     * earlier end, middle and later end of the step, at which the derivative of the event function changes sign.
+     * \param sampleTimes Earlier end, middle and later end of the step
+     * \param sampleValues Event function values at the sample times
+     * \param extremumTime Time of the extremum (returned by reference)
+     * \return True if the polynomial has an extremum within the step (other than at its middle)
+     */
+    bool findExtremumInStep( const std::vector< double >& sampleTimes,
+                             const std::vector< double >& sampleValues,
+                             double& extremumTime )
+    {
+        // Polynomial value( s ) = sampleValues[ 0 ] + linearCoefficient * s + quadraticCoefficient * s^2, with s the
+        // normalized time (0 at the earlier end, 1 at the later end of the step)
+        const double quadraticCoefficient = 2.0 * ( sampleValues.at( 2 ) - 2.0 * sampleValues.at( 1 ) + sampleValues.at( 0 ) );
+        const double linearCoefficient = sampleValues.at( 2 ) - sampleValues.at( 0 ) - quadraticCoefficient;
+        if( !( quadraticCoefficient != 0.0 ) )
+        {
+            return false;
+        }
+
+        const double normalizedExtremumTime = -linearCoefficient / ( 2.0 * quadraticCoefficient );
+        if( !( normalizedExtremumTime > 0.0 && normalizedExtremumTime < 1.0 ) || normalizedExtremumTime == 0.5 )
+        {
+            return false;
+        }
+        extremumTime = sampleTimes.at( 0 ) + normalizedExtremumTime * ( sampleTimes.at( 2 ) - sampleTimes.at( 0 ) );
+        return ( extremumTime > sampleTimes.at( 0 ) && extremumTime < sampleTimes.at( 2 ) && extremumTime != sampleTimes.at( 1 ) );
+    }
+
+    //! Function to locate the zero crossing of the event function with the given index between two epochs
+    double locateEvent( const unsigned int eventIndex,
+                        const double lowerBound,
+                        const double upperBound,
+                        const std::function< void( const double ) > updateEnvironment )
+    {
+        const double initialGuess = 0.5 * ( lowerBound + upperBound );
+
+        std::function< double( const double ) > eventFunctionOfTime = [ = ]( const double time )
+        {
+            updateEnvironment( time );
+            return computeEventValue( eventIndex );
+        };
+
+        const std::shared_ptr< tudat::root_finders::RootFinder< double > > rootFinder =
+                tudat::root_finders::createRootFinder< double >(
+                    eventSettings_.at( eventIndex )->getRootFinderSettings( ), lowerBound, upperBound, initialGuess );
+        const double eventEpoch = rootFinder->execute(
+                    std::make_shared< tudat::basic_mathematics::FunctionProxy< double, double > >( eventFunctionOfTime ),
+                    initialGuess );
+        return std::min( std::max( eventEpoch, lowerBound ), upperBound );
+    }
+
+    //! Function to refine the epoch of an event, using the state integrated from the start of the step
+    /*!
+     * Function to refine the epoch of an event located on the state interpolated within the step, using the state
+     * integrated from the start of the step. Starting from the interpolated estimate, a bracket of the zero crossing of
+     * the event function (computed from the integrated state) is searched, with a width that is increased geometrically
+     * up to the bounds of the original bracket, after which the crossing is located within it. If the integrated event
+     * function does not cross zero within the original bracket, the interpolated estimate is returned.
+     * \param eventIndex Index of the event
+     * \param interpolatedEventEpoch Epoch of the event, located on the interpolated state
+     * \param lowerBound Lower bound of the original bracket of the crossing
+     * \param upperBound Upper bound of the original bracket of the crossing
+     * \param isIncreasing Boolean denoting whether the event function is increasing at the crossing
+     * \param updateEnvironment Function updating the environment to the given epoch, using the integrated state
+     * \return Refined epoch of the event
+     */
+    double refineEventEpoch( const unsigned int eventIndex,
+                             const double interpolatedEventEpoch,
+                             const double lowerBound,
+                             const double upperBound,
+                             const bool isIncreasing,
+                             const std::function< void( const double ) > updateEnvironment )
+    {
+        std::function< double( const double ) > eventFunctionOfTime = [ = ]( const double time )
+        {
+            updateEnvironment( time );
+            return computeEventValue( eventIndex );
+        };
+
+        const double valueAtEstimate = eventFunctionOfTime( interpolatedEventEpoch );
+        if( valueAtEstimate == 0.0 )
+        {
+            return interpolatedEventEpoch;
+        }
+
+        // The crossing is after the estimate if the event function has not changed sign at the estimate
+        const bool isCrossingAfterEstimate = ( valueAtEstimate < 0.0 ) == isIncreasing;
+        const double searchBound = isCrossingAfterEstimate ? upperBound : lowerBound;
+        double bracketWidth = initialRefinementBracketWidth * ( upperBound - lowerBound );
+        double bracketEnd = interpolatedEventEpoch;
+        bool isCrossingBracketed = false;
+        while( !isCrossingBracketed && bracketEnd != searchBound )
+        {
+            bracketEnd = isCrossingAfterEstimate ? std::min( interpolatedEventEpoch + bracketWidth, upperBound ) :
+                                                   std::max( interpolatedEventEpoch - bracketWidth, lowerBound );
+            const double valueAtBracketEnd = eventFunctionOfTime( bracketEnd );
+            isCrossingBracketed = ( valueAtBracketEnd == 0.0 ) || ( ( valueAtBracketEnd < 0.0 ) != ( valueAtEstimate < 0.0 ) );
+            bracketWidth *= refinementBracketGrowthFactor;
+        }
+
+        if( !isCrossingBracketed )
+        {
+            return interpolatedEventEpoch;
+        }
+        return locateEvent( eventIndex, std::min( interpolatedEventEpoch, bracketEnd ),
+                            std::max( interpolatedEventEpoch, bracketEnd ), updateEnvironment );
+    }
+
+    //! Width of the first bracket searched when refining an event epoch, relative to the width of the original bracket
+    static constexpr double initialRefinementBracketWidth = 1.0E-6;
+
+    //! Factor by which the width of the bracket is increased in each iteration when refining an event epoch
+    static constexpr double refinementBracketGrowthFactor = 32.0;
+
+    std::vector< std::shared_ptr< EventSettings > > eventSettings_;
+
+    //! Functions computing the dependent variables of each event
+    std::vector< std::function< Eigen::VectorXd( ) > > dependentVariableFunctions_;
+
+    //! Values of the event functions at the start of the next step
+    Eigen::VectorXd previousEventValues_;
+};
+
+//! Function to create settings for an event with a user-defined event function of a list of dependent variables
+inline std::shared_ptr< EventSettings > customEvent(
+        const std::string& eventName,
+        const std::vector< std::shared_ptr< tudat::propagators::SingleDependentVariableSaveSettings > >& dependentVariables,
+        const std::function< double( const Eigen::VectorXd& ) > eventFunction,
+        const EventCrossingDirections crossingDirection = any_crossing,
+        const std::shared_ptr< tudat::root_finders::RootFinderSettings > rootFinderSettings = nullptr )
+{
+    return std::make_shared< EventSettings >(
+                eventName, dependentVariables, eventFunction, crossingDirection, rootFinderSettings );
+}
+
+//! Function to create settings for an event at which a component of a dependent variable crosses a threshold
+/*!
+ * Function to create settings for an event at which a component of a dependent variable crosses a threshold
+ * \param eventName Name of the event
+ * \param dependentVariable Dependent variable that is compared to the threshold
+ * \param threshold Value of the dependent variable at the event
+ * \param crossingDirection Directions (in time) of the crossings that are detected as events
+ * \param componentIndex Index of the component of the dependent variable that is compared to the threshold
+ * \param rootFinderSettings Settings for the root finder used to locate the events
+ * \return Event settings
+ */
+inline std::shared_ptr< EventSettings > dependentVariableEvent(
+        const std::string& eventName,
+        const std::shared_ptr< tudat::propagators::SingleDependentVariableSaveSettings > dependentVariable,
+        const double threshold,
+        const EventCrossingDirections crossingDirection = any_crossing,
+        const int componentIndex = 0,
+        const std::shared_ptr< tudat::root_finders::RootFinderSettings > rootFinderSettings = nullptr )
+{
+    if( componentIndex < 0 )
+    {
+        throw std::runtime_error( "Error when creating dependent variable event " + eventName +
+                                  ", component index must be non-negative" );
+    }
+
+    return std::make_shared< EventSettings >(
+                eventName, std::vector< std::shared_ptr< tudat::propagators::SingleDependentVariableSaveSettings > >(
+                    { dependentVariable } ),
+                [ = ]( const Eigen::VectorXd& dependentVariables )
+    {
+        if( componentIndex >= dependentVariables.rows( ) )
+        {
+            throw std::runtime_error( "Error when evaluating dependent variable event " + eventName +
+                                      ", component index exceeds size of dependent variable" );
+        }
+        return dependentVariables( componentIndex ) - threshold;
+    }, crossingDirection, rootFinderSettings );
+}
+
+//! Function to create settings for apsis passages of a body with respect to a central body
+/*!
+ * Function to create settings for apsis passages of a body with respect to a central body, at which the radial velocity
+ * crosses zero. The event function (dot product of relative position and velocity) is increasing at periapsis, and
+ * decreasing at apoapsis.
+ * \param eventName Name of the event
+ * \param bodyName Name of the orbiting body
+ * \param centralBodyName Name of the central body
+ * \param crossingDirection Directions of the crossings that are detected (increasing_crossing for periapsis only,
+ * decreasing_crossing for apoapsis only)
+ * \param rootFinderSettings Settings for the root finder used to locate the events
+ * \return Event settings
+ */
+inline std::shared_ptr< EventSettings > apsisEvent(
+        const std::string& eventName,
+        const std::string& bodyName,
+        const std::string& centralBodyName,
+        const EventCrossingDirections crossingDirection = any_crossing,
+        const std::shared_ptr< tudat::root_finders::RootFinderSettings > rootFinderSettings = nullptr )
+{
+    return std::make_shared< EventSettings >(
+                eventName, std::vector< std::shared_ptr< tudat::propagators::SingleDependentVariableSaveSettings > >(
+                    { tudat::propagators::relativePositionDependentVariable( bodyName, centralBodyName ),
+                      tudat::propagators::relativeVelocityDependentVariable( bodyName, centralBodyName ) } ),
+                []( const Eigen::VectorXd& dependentVariables )
+    {
+        return dependentVariables.segment( 0, 3 ).dot( dependentVariables.segment( 3, 3 ) );
+    }, crossingDirection, rootFinderSettings );
+}
+
+//! Function to create settings for node crossings of a body with respect to a central body
+/*!
+ * Function to create settings for node crossings of a body with respect to a central body, at which the component of
+ * the relative position along the z-axis of the global frame orientation crosses zero. The event function is increasing
+ * at the ascending node, and decreasing at the descending node.
+ * \param eventName Name of the event
+ * \param bodyName Name of the orbiting body
+ * \param centralBodyName Name of the central body
+ * \param crossingDirection Directions of the crossings that are detected (increasing_crossing for ascending nodes only,
+ * decreasing_crossing for descending nodes only)
+ * \param rootFinderSettings Settings for the root finder used to locate the events
+ * \return Event settings
+ */
+inline std::shared_ptr< EventSettings > nodeEvent(
+        const std::string& eventName,
+        const std::string& bodyName,
+        const std::string& centralBodyName,
+        const EventCrossingDirections crossingDirection = any_crossing,
+        const std::shared_ptr< tudat::root_finders::RootFinderSettings > rootFinderSettings = nullptr )
+{
+    return std::make_shared< EventSettings >(
+                eventName, std::vector< std::shared_ptr< tudat::propagators::SingleDependentVariableSaveSettings > >(
+                    { tudat::propagators::relativePositionDependentVariable( bodyName, centralBodyName ) } ),
+                []( const Eigen::VectorXd& dependentVariables )
+    {
+        return dependentVariables( 2 );
+    }, crossingDirection, rootFinderSettings );
+}
+
+//! Function to create settings for eclipse entries and exits of a body
+/*!
+ * Function to create settings for eclipse entries and exits of a body, using a conical shadow model with spherical
+ * occulting and source bodies (with the average radii of their shape models). The event function is the angular
+ * separation between the apparent discs of the source and occulting body, as seen from the body, minus its value at
+ * the start of the penumbra (sum of the apparent radii) or umbra (difference of the apparent radii). The event function
+ * is decreasing at eclipse entry, and increasing at eclipse exit.
+ * \param eventName Name of the event
+ * \param bodies System of bodies, from which the radii of the occulting and source body are retrieved
+ * \param bodyName Name of the body for which the eclipses are detected
+ * \param occultingBodyName Name of the occulting body
+ * \param sourceBodyName Name of the source body
+ * \param useUmbra Boolean denoting whether the entry and exit of the umbra (instead of the penumbra) are detected
+ * \param crossingDirection Directions of the crossings that are detected (decreasing_crossing for entries only,
+ * increasing_crossing for exits only)
+ * \param rootFinderSettings Settings for the root finder used to locate the events
+ * \return Event settings
+ */
+inline std::shared_ptr< EventSettings > eclipseEvent(
+        const std::string& eventName,
+        const tudat::simulation_setup::SystemOfBodies& bodies,
+        const std::string& bodyName,
+        const std::string& occultingBodyName,
+        const std::string& sourceBodyName = "Sun",
+        const bool useUmbra = false,
+        const EventCrossingDirections crossingDirection = any_crossing,
+        const std::shared_ptr< tudat::root_finders::RootFinderSettings > rootFinderSettings = nullptr )
+{
+    if( bodies.at( occultingBodyName )->getShapeModel( ) == nullptr ||
+            bodies.at( sourceBodyName )->getShapeModel( ) == nullptr )
+    {
+        throw std::runtime_error( "Error when creating eclipse event " + eventName +
+                                  ", occulting and source body must have a shape model" );
+    }
+    const double occultingBodyRadius = bodies.at( occultingBodyName )->getShapeModel( )->getAverageRadius( );
+    const double sourceBodyRadius = bodies.at( sourceBodyName )->getShapeModel( )->getAverageRadius( );
+
+    return std::make_shared< EventSettings >(
+                eventName, std::vector< std::shared_ptr< tudat::propagators::SingleDependentVariableSaveSettings > >(
+                    { tudat::propagators::relativePositionDependentVariable( sourceBodyName, bodyName ),
+                      tudat::propagators::relativePositionDependentVariable( occultingBodyName, bodyName ) } ),
+                [ = ]( const Eigen::VectorXd& dependentVariables )
+    {
+        const Eigen::Vector3d sourcePosition = dependentVariables.segment( 0, 3 );
+        const Eigen::Vector3d occultingBodyPosition = dependentVariables.segment( 3, 3 );
+        const double sourceDistance = sourcePosition.norm( );
+        const double occultingBodyDistance = occultingBodyPosition.norm( );
+
+        const double apparentSourceRadius = std::asin( std::min( sourceBodyRadius / sourceDistance, 1.0 ) );
+        const double apparentOccultingBodyRadius = std::asin( std::min( occultingBodyRadius / occultingBodyDistance, 1.0 ) );
+        const double apparentSeparation = std::acos( std::max( std::min(
+                sourcePosition.dot( occultingBodyPosition ) / ( sourceDistance * occultingBodyDistance ), 1.0 ), -1.0 ) );
+
+        return useUmbra ? ( apparentSeparation - ( apparentOccultingBodyRadius - apparentSourceRadius ) ) :
+                          ( apparentSeparation - ( apparentOccultingBodyRadius + apparentSourceRadius ) );
+    }, crossingDirection, rootFinderSettings );
+}
+
+//! Function to create settings for the rise and set of a body as seen from a ground station
+/*!
+ * Function to create settings for the rise and set of a body as seen from a ground station, at which the elevation of
+ * the body above the local horizon of the station crosses a minimum elevation. The local vertical is taken along the
+ * nominal (body-fixed) position vector of the station. The event function (elevation minus minimum elevation) is
+ * increasing at rise, and decreasing at set.
+ * \param eventName Name of the event
+ * \param bodies System of bodies, from which the ground station is retrieved
+ * \param bodyName Name of the body for which the rise and set are detected
+ * \param stationBodyName Name of the body on which the ground station is located
+ * \param stationName Name of the ground station
+ * \param minimumElevation Elevation (in radians) at rise and set
+ * \param crossingDirection Directions of the crossings that are detected (increasing_crossing for rise only,
+ * decreasing_crossing for set only)
+ * \param rootFinderSettings Settings for the root finder used to locate the events
+ * \return Event settings
+ */
+inline std::shared_ptr< EventSettings > elevationEvent(
+        const std::string& eventName,
+        const tudat::simulation_setup::SystemOfBodies& bodies,
+        const std::string& bodyName,
+        const std::string& stationBodyName,
+        const std::string& stationName,
+        const double minimumElevation = 0.0,
+        const EventCrossingDirections crossingDirection = any_crossing,
+        const std::shared_ptr< tudat::root_finders::RootFinderSettings > rootFinderSettings = nullptr )
+{
+    const Eigen::Vector3d stationPosition = bodies.at( stationBodyName )->getGroundStation( stationName )->
+            getNominalStationState( )->getNominalCartesianPosition( );
+    const Eigen::Vector3d localVerticalDirection = stationPosition.normalized( );
+
+    return std::make_shared< EventSettings >(
+                eventName, std::vector< std::shared_ptr< tudat::propagators::SingleDependentVariableSaveSettings > >(
+                    { tudat::propagators::relativePositionDependentVariable( bodyName, stationBodyName ),
+                      tudat::propagators::inertialToBodyFixedRotationMatrixVariable( stationBodyName ) } ),
+                [ = ]( const Eigen::VectorXd& dependentVariables )
+    {
+        // Rotation matrix is saved row by row
+        Eigen::Matrix3d inertialToBodyFixedRotation;
+        for( unsigned int i = 0; i < 3; i++ )
+        {
+            inertialToBodyFixedRotation.row( i ) = dependentVariables.segment( 3 + 3 * i, 3 ).transpose( );
+        }
+        const Eigen::Vector3d lineOfSight =
+                inertialToBodyFixedRotation * dependentVariables.segment( 0, 3 ) - stationPosition;
+        return std::asin( lineOfSight.dot( localVerticalDirection ) / lineOfSight.norm( ) ) - minimumElevation;
+    }, crossingDirection, rootFinderSettings );
+}
+
+} // namespace tudatpy
+
+#endif // TUDATPY_EVENT_DETECTION_H
@@ -0,0 +1,236 @@
+/*    Copyright (c) 2010-2022, Delft University of Technology
+ *    All rights reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ */
+
+#ifndef TUDATPY_NATIVE_CALLBACKS_H
+#define TUDATPY_NATIVE_CALLBACKS_H
+
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include <Eigen/Core>
+
+#include "tudat/simulation/propagation_setup.h"
+
+namespace tudatpy
+{
+
+/*!
+ * Function signatures (C ABI) of native callbacks, which may be used instead of Python functions for custom models.
+ * A native callback is passed to the setup functions as the address of a C function (e.g. the address attribute of a
+ * numba cfunc, or the address of a ctypes function pointer), together with an optional user data address. The ABI is:
+ *
+ *  - all callbacks use the C calling convention, with the argument types given below (double: 64-bit IEEE float,
+ *    std::int32_t: 32-bit signed integer, pointers of the native size)
+ *  - the last argument of each callback is the user data address given to the setup function (nullptr if none is
+ *    given), which is passed on unchanged, so that a callback can access its own parameters or state (e.g. a numpy
+ *    array, through its ctypes.data address). The memory at this address must remain valid as long as the callback is
+ *    used, and is not managed by tudatpy
+ *  - output arrays are allocated by the caller (contiguous, of the given size), and must be completely filled by the
+ *    callback; input arrays must not be modified
+ *  - callbacks are called directly from the propagation, without acquiring the GIL, and must therefore not call into
+ *    the Python interpreter. In concurrent propagations they may be called from multiple threads at the same time, so
+ *    that any state at the user data address must be synchronized by the callback itself
+ */
+
+//! Custom acceleration: fills the acceleration (3 entries) at the given time
+typedef void ( *NativeAccelerationFunction )( double time, double* acceleration, void* userData );
+
+//! Scalar function of time (e.g. thrust magnitude, specific impulse)
+typedef double ( *NativeScalarFunctionOfTime )( double time, void* userData );
+
+/*!
+ * Custom dependent variable: fills the dependent variable (of the given size), using the current environment. The
+ * dependent variables of Tudat are evaluated without the current time; a callback that needs it can obtain it through
+ * its user data (e.g. from a value written by another callback, such as a custom acceleration, which is evaluated at the
+ * same time before the dependent variables).
+ */
+typedef void ( *NativeDependentVariableFunction )(
+        double* dependentVariable, std::int32_t dependentVariableSize, void* userData );
+
+//! Custom termination condition: returns a non-zero value if the propagation is to be terminated at the given time
+typedef std::int32_t ( *NativeTerminationFunction )( double time, void* userData );
+
+//! Custom state derivative: fills the state derivative (of the given size) for the given time and state
+typedef void ( *NativeStateDerivativeFunction )(
+        double time, const double* state, double* stateDerivative, std::int32_t stateSize, void* userData );
+
+//! Function to convert the address of a native callback to a function pointer of the given type
+template< typename FunctionPointerType >
+FunctionPointerType getNativeFunctionPointer( const std::uintptr_t functionAddress, const std::string& functionDescription )
+{
+    if( functionAddress == 0 )
+    {
+        throw std::runtime_error( "Error when creating " + functionDescription +
+                                  " from native function, function address is zero" );
+    }
+    return reinterpret_cast< FunctionPointerType >( functionAddress );
+}
+
+//! Function to convert the user data address of a native callback to the pointer passed to the callback
+inline void* getNativeUserData( const std::uintptr_t userDataAddress )
+{
+    return reinterpret_cast< void* >( userDataAddress );
+}
+
+//! Function to create a custom acceleration function from the address of a NativeAccelerationFunction
+inline std::function< Eigen::Vector3d( const double ) > createNativeAccelerationFunction(
+        const std::uintptr_t accelerationFunctionAddress,
+        const std::uintptr_t userDataAddress = 0 )
+{
+    const NativeAccelerationFunction accelerationFunction = getNativeFunctionPointer< NativeAccelerationFunction >(
+                accelerationFunctionAddress, "custom acceleration" );
+    void* const userData = getNativeUserData( userDataAddress );
+    return [ = ]( const double time )
+    {
+        Eigen::Vector3d acceleration;
+        accelerationFunction( time, acceleration.data( ), userData );
+        return acceleration;
+    };
+}
+
+//! Function to create a scalar function of time from the address of a NativeScalarFunctionOfTime
+inline std::function< double( const double ) > createNativeScalarFunctionOfTime(
+        const std::uintptr_t functionAddress, const std::string& functionDescription,
+        const std::uintptr_t userDataAddress = 0 )
+{
+    const NativeScalarFunctionOfTime scalarFunction = getNativeFunctionPointer< NativeScalarFunctionOfTime >(
+                functionAddress, functionDescription );
+    void* const userData = getNativeUserData( userDataAddress );
+    return [ = ]( const double time )
+    {
+        return scalarFunction( time, userData );
+    };
+}
+
+//! Function to create a custom dependent variable function from the address of a NativeDependentVariableFunction
+inline std::function< Eigen::VectorXd( ) > createNativeDependentVariableFunction(
+        const std::uintptr_t dependentVariableFunctionAddress, const int dependentVariableSize,
+        const std::uintptr_t userDataAddress = 0 )
+{
+    const NativeDependentVariableFunction dependentVariableFunction =
+            getNativeFunctionPointer< NativeDependentVariableFunction >(
+                dependentVariableFunctionAddress, "custom dependent variable" );
+    void* const userData = getNativeUserData( userDataAddress );
+    return [ = ]( )
+    {
+        Eigen::VectorXd dependentVariable( dependentVariableSize );
+        dependentVariableFunction( dependentVariable.data( ), static_cast< std::int32_t >( dependentVariableSize ), userData );
+        return dependentVariable;
+    };
+}
+
+//! Function to create a custom termination function from the address of a NativeTerminationFunction
+inline std::function< bool( const double ) > createNativeTerminationFunction(
+        const std::uintptr_t terminationFunctionAddress,
+        const std::uintptr_t userDataAddress = 0 )
+{
+    const NativeTerminationFunction terminationFunction = getNativeFunctionPointer< NativeTerminationFunction >(
+                terminationFunctionAddress, "custom termination condition" );
+    void* const userData = getNativeUserData( userDataAddress );
+    return [ = ]( const double time )
+    {
+        return terminationFunction( time, userData ) != 0;
+    };
+}
+
+//! Function to create a custom state derivative function from the address of a NativeStateDerivativeFunction
+template< typename TimeType = double >
+std::function< Eigen::VectorXd( const TimeType, const Eigen::VectorXd& ) > createNativeStateDerivativeFunction(
+        const std::uintptr_t stateDerivativeFunctionAddress,
+        const std::uintptr_t userDataAddress = 0 )
+{
+    const NativeStateDerivativeFunction stateDerivativeFunction = getNativeFunctionPointer< NativeStateDerivativeFunction >(
+                stateDerivativeFunctionAddress, "custom state derivative" );
+    void* const userData = getNativeUserData( userDataAddress );
+    return [ = ]( const TimeType time, const Eigen::VectorXd& state )
+    {
+        Eigen::VectorXd stateDerivative( state.rows( ) );
+        stateDerivativeFunction( static_cast< double >( time ), state.data( ), stateDerivative.data( ),
+                                 static_cast< std::int32_t >( state.rows( ) ), userData );
+        return stateDerivative;
+    };
+}
+
+//! Function to create custom acceleration settings, with the acceleration computed by a native callback
+inline std::shared_ptr< tudat::simulation_setup::AccelerationSettings > nativeCustomAccelerationSettings(
+        const std::uintptr_t accelerationFunctionAddress,
+        const std::uintptr_t userDataAddress = 0 )
+{
+    return tudat::simulation_setup::customAccelerationSettings(
+                createNativeAccelerationFunction( accelerationFunctionAddress, userDataAddress ) );
+}
+
+//! Function to create custom thrust magnitude settings, with the thrust magnitude and specific impulse computed by native callbacks
+inline std::shared_ptr< tudat::simulation_setup::ThrustMagnitudeSettings > nativeCustomThrustMagnitudeSettings(
+        const std::uintptr_t thrustMagnitudeFunctionAddress,
+        const std::uintptr_t specificImpulseFunctionAddress,
+        const std::uintptr_t userDataAddress = 0 )
+{
+    return tudat::simulation_setup::fromFunctionThrustMagnitudeSettings(
+                createNativeScalarFunctionOfTime( thrustMagnitudeFunctionAddress, "custom thrust magnitude", userDataAddress ),
+                createNativeScalarFunctionOfTime( specificImpulseFunctionAddress, "custom specific impulse", userDataAddress ) );
+}
+
+//! Function to create custom thrust magnitude settings, with the thrust magnitude computed by a native callback
+inline std::shared_ptr< tudat::simulation_setup::ThrustMagnitudeSettings > nativeCustomThrustMagnitudeFixedIspSettings(
+        const std::uintptr_t thrustMagnitudeFunctionAddress,
+        const double specificImpulse,
+        const std::uintptr_t userDataAddress = 0 )
+{
+    return tudat::simulation_setup::fromFunctionThrustMagnitudeFixedIspSettings(
+                createNativeScalarFunctionOfTime( thrustMagnitudeFunctionAddress, "custom thrust magnitude", userDataAddress ),
+                specificImpulse );
+}
+
+//! Function to create custom dependent variable settings, with the dependent variable computed by a native callback
+inline std::shared_ptr< tudat::propagators::SingleDependentVariableSaveSettings > nativeCustomDependentVariable(
+        const std::uintptr_t dependentVariableFunctionAddress,
+        const int dependentVariableSize,
+        const std::uintptr_t userDataAddress = 0 )
+{
+    return tudat::propagators::customDependentVariable(
+                createNativeDependentVariableFunction( dependentVariableFunctionAddress, dependentVariableSize, userDataAddress ),
+                dependentVariableSize );
+}
+
+//! Function to create custom termination settings, with the termination condition evaluated by a native callback
+inline std::shared_ptr< tudat::propagators::PropagationTerminationSettings > nativeCustomTerminationSettings(
+        const std::uintptr_t terminationFunctionAddress,
+        const std::uintptr_t userDataAddress = 0 )
+{
+    return tudat::propagators::popagationCustomTerminationSettings(
+                createNativeTerminationFunction( terminationFunctionAddress, userDataAddress ) );
+}
+
+//! Function to create propagator settings for a custom state, with the state derivative computed by a native callback
+template< typename StateScalarType = double, typename TimeType = double >
+std::shared_ptr< tudat::propagators::SingleArcPropagatorSettings< StateScalarType, TimeType > > nativeCustomStatePropagatorSettings(
+        const std::uintptr_t stateDerivativeFunctionAddress,
+        const Eigen::VectorXd& initialState,
+        const TimeType& initialTime,
+        const std::shared_ptr< tudat::numerical_integrators::IntegratorSettings< TimeType > > integratorSettings,
+        const std::shared_ptr< tudat::propagators::PropagationTerminationSettings > terminationSettings,
+        const std::vector< std::shared_ptr< tudat::propagators::SingleDependentVariableSaveSettings > >& dependentVariablesToSave,
+        const std::shared_ptr< tudat::propagators::SingleArcPropagatorProcessingSettings > outputProcessingSettings,
+        const std::uintptr_t userDataAddress = 0 )
+{
+    return tudat::propagators::customStatePropagatorSettings< StateScalarType, TimeType >(
+                createNativeStateDerivativeFunction< TimeType >( stateDerivativeFunctionAddress, userDataAddress ),
+                initialState, initialTime, integratorSettings, terminationSettings,
+                dependentVariablesToSave, outputProcessingSettings );
+}
+
+} // namespace tudatpy
+
+#endif // TUDATPY_NATIVE_CALLBACKS_H
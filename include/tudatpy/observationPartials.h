@@ -0,0 +1,354 @@
+/*    Copyright (c) 2010-2022, Delft University of Technology
+ *    All rights reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ */
+
+#ifndef TUDATPY_OBSERVATION_PARTIALS_H
+#define TUDATPY_OBSERVATION_PARTIALS_H
+
+#include <algorithm>
+#include <map>
+#include <memory>
+#include <set>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <Eigen/Core>
+
+#include "tudat/simulation/estimation_setup.h"
+
+#include "tudatpy/parallelExecution.h"
+#include "tudatpy/synchronizedEnvironment.h"
+
+namespace tudatpy
+{
+
+//! Single observation set (or range of its observation times) of a collection, with its location in the observation vector
+template< typename ObservationScalarType = double, typename TimeType = double >
+struct ObservationSetEntry
+{
+    ObservationSetEntry( const tudat::observation_models::ObservableType observableType,
+                         const tudat::observation_models::LinkEnds& linkEnds,
+                         const std::shared_ptr< tudat::observation_models::SingleObservationSet< ObservationScalarType, TimeType > >
+                         observationSet,
+                         const int startIndex,
+                         const int numberOfObservations,
+                         const int firstTimeIndex = 0,
+                         const int numberOfTimes = -1 ):
+        observableType_( observableType ), linkEnds_( linkEnds ), observationSet_( observationSet ),
+        startIndex_( startIndex ), numberOfObservations_( numberOfObservations ), firstTimeIndex_( firstTimeIndex ),
+        numberOfTimes_( ( numberOfTimes < 0 ) ? static_cast< int >( observationSet->getObservationTimes( ).size( ) ) :
+                                                numberOfTimes ){ }
+
+    tudat::observation_models::ObservableType observableType_;
+
+    tudat::observation_models::LinkEnds linkEnds_;
+
+    std::shared_ptr< tudat::observation_models::SingleObservationSet< ObservationScalarType, TimeType > > observationSet_;
+
+    //! Index of the first observation of the set in the concatenated observation vector of the collection
+    int startIndex_;
+
+    //! Number of observation entries (observations times observable size) of the set
+    int numberOfObservations_;
+
+    //! Index of the first observation time of the set that is included in this entry
+    int firstTimeIndex_;
+
+    //! Number of observation times of the set that are included in this entry
+    int numberOfTimes_;
+};
+
+//! Function to list the observation sets of an observation collection, with their location in its observation vector
+template< typename ObservationScalarType = double, typename TimeType = double >
+std::vector< ObservationSetEntry< ObservationScalarType, TimeType > > getObservationSetEntries(
+        const std::shared_ptr< tudat::observation_models::ObservationCollection< ObservationScalarType, TimeType > >
+        observationCollection )
+{
+    const std::map< tudat::observation_models::LinkEnds, int > linkEndIds = observationCollection->getLinkEndIdentifierMap( );
+    const std::map< tudat::observation_models::ObservableType, std::map< int, std::vector< std::pair< int, int > > > >
+            observationSetStartAndSize = observationCollection->getObservationSetStartAndSizePerLinkEndIndex( );
+
+    std::vector< ObservationSetEntry< ObservationScalarType, TimeType > > observationSetEntries;
+    for( auto observableIterator : observationCollection->getSortedObservationSets( ) )
+    {
+        for( auto linkEndIterator : observableIterator.second )
+        {
+            const std::vector< std::pair< int, int > >& startAndSizeList =
+                    observationSetStartAndSize.at( observableIterator.first ).at( linkEndIds.at( linkEndIterator.first ) );
+            for( unsigned int i = 0; i < linkEndIterator.second.size( ); i++ )
+            {
+                observationSetEntries.push_back( ObservationSetEntry< ObservationScalarType, TimeType >(
+                                                     observableIterator.first, linkEndIterator.first,
+                                                     linkEndIterator.second.at( i ),
+                                                     startAndSizeList.at( i ).first, startAndSizeList.at( i ).second ) );
+            }
+        }
+    }
+    return observationSetEntries;
+}
+
+//! Function to split the observation sets of a collection into ranges of observation times of limited size
+/*!
+ * Function to split the observation sets of a collection into ranges of consecutive observation times, each with at most
+ * maximumNumberOfObservations observation entries (but at least one observation time), so that the partials of a large
+ * observation set can be computed, and discarded, one range at a time. The ranges of a set are listed in order, so that
+ * their locations in the concatenated observation vector are contiguous.
+ * \param observationSetEntries Observation sets of the collection (see getObservationSetEntries)
+ * \param maximumNumberOfObservations Maximum number of observation entries per range
+ * \return Ranges of observation times of all observation sets
+ */
+template< typename ObservationScalarType = double, typename TimeType = double >
+std::vector< ObservationSetEntry< ObservationScalarType, TimeType > > splitObservationSetEntries(
+        const std::vector< ObservationSetEntry< ObservationScalarType, TimeType > >& observationSetEntries,
+        const int maximumNumberOfObservations )
+{
+    std::vector< ObservationSetEntry< ObservationScalarType, TimeType > > splitEntries;
+    for( unsigned int i = 0; i < observationSetEntries.size( ); i++ )
+    {
+        const ObservationSetEntry< ObservationScalarType, TimeType >& currentEntry = observationSetEntries.at( i );
+        if( currentEntry.numberOfTimes_ == 0 || currentEntry.numberOfObservations_ <= maximumNumberOfObservations )
+        {
+            splitEntries.push_back( currentEntry );
+            continue;
+        }
+
+        const int observableSize = currentEntry.numberOfObservations_ / currentEntry.numberOfTimes_;
+        const int timesPerRange = std::max( maximumNumberOfObservations / observableSize, 1 );
+        for( int firstTime = 0; firstTime < currentEntry.numberOfTimes_; firstTime += timesPerRange )
+        {
+            const int numberOfTimes = std::min( timesPerRange, currentEntry.numberOfTimes_ - firstTime );
+            splitEntries.push_back( ObservationSetEntry< ObservationScalarType, TimeType >(
+                                        currentEntry.observableType_, currentEntry.linkEnds_, currentEntry.observationSet_,
+                                        currentEntry.startIndex_ + firstTime * observableSize,
+                                        numberOfTimes * observableSize,
+                                        currentEntry.firstTimeIndex_ + firstTime, numberOfTimes ) );
+        }
+    }
+    return splitEntries;
+}
+
+//! Function to compute the residuals and observation partials of a single observation set
+/*!
+ * Function to compute the residuals and observation partials of a single observation set (or of the range of its
+ * observation times given by the entry), using the observation managers of an estimator (evaluated at its current
+ * parameter estimate), in the same manner as OrbitDeterminationManager::estimateParameters
+ * \param orbitDeterminationManager Estimator of which the observation managers are used
+ * \param observationSetEntry Observation set for which the residuals and partials are computed
+ * \param residuals Residuals (observed minus computed) of the set (returned by reference)
+ * \param partials Partials of the observations of the set w.r.t. the estimated parameters (returned by reference)
+ */
+template< typename ObservationScalarType = double, typename TimeType = double >
+void computeObservationSetResidualsAndPartials(
+        const std::shared_ptr< tudat::simulation_setup::OrbitDeterminationManager< ObservationScalarType, TimeType > >
+        orbitDeterminationManager,
+        const ObservationSetEntry< ObservationScalarType, TimeType >& observationSetEntry,
+        Eigen::VectorXd& residuals,
+        Eigen::MatrixXd& partials )
+{
+    const std::shared_ptr< tudat::observation_models::SingleObservationSet< ObservationScalarType, TimeType > >
+            observationSet = observationSetEntry.observationSet_;
+    const std::vector< TimeType > allObservationTimes = observationSet->getObservationTimes( );
+    const std::vector< TimeType > observationTimes(
+                allObservationTimes.begin( ) + observationSetEntry.firstTimeIndex_,
+                allObservationTimes.begin( ) + observationSetEntry.firstTimeIndex_ + observationSetEntry.numberOfTimes_ );
+    const std::pair< Eigen::Matrix< ObservationScalarType, Eigen::Dynamic, 1 >, Eigen::MatrixXd > observationsWithPartials =
+            orbitDeterminationManager->getObservationManagers( ).at( observationSetEntry.observableType_ )->
+            computeObservationsWithPartials(
+                observationTimes, observationSetEntry.linkEnds_,
+                observationSet->getReferenceLinkEnd( ), observationSet->getAncilliarySettings( ) );
+
+    // Observation entries of the range in the observation vector of the set
+    const int observableSize = ( observationSetEntry.numberOfTimes_ > 0 ) ?
+                observationSetEntry.numberOfObservations_ / observationSetEntry.numberOfTimes_ : 0;
+    residuals = ( observationSet->getObservationsVector( ).segment(
+                      observationSetEntry.firstTimeIndex_ * observableSize, observationSetEntry.numberOfObservations_ ) -
+                  observationsWithPartials.first ).template cast< double >( );
+    partials = observationsWithPartials.second;
+}
+
+//! Function to check that no two estimators use the same body objects, so that they can be evaluated concurrently
+template< typename ObservationScalarType = double, typename TimeType = double >
+void checkEstimatorsUseSeparateBodies(
+        const std::vector< std::shared_ptr< tudat::simulation_setup::OrbitDeterminationManager< ObservationScalarType, TimeType > > >&
+        orbitDeterminationManagers )
+{
+    std::set< tudat::simulation_setup::Body* > bodiesInUse;
+    for( unsigned int i = 0; i < orbitDeterminationManagers.size( ); i++ )
+    {
+        tudat::simulation_setup::SystemOfBodies bodies = orbitDeterminationManagers.at( i )->getBodies( );
+        for( auto bodyIterator : bodies.getMap( ) )
+        {
+            if( !bodiesInUse.insert( bodyIterator.second.get( ) ).second )
+            {
+                throw std::runtime_error( "Error when computing observation partials in parallel, body " + bodyIterator.first +
+                                          " is used by more than one estimator; each estimator must use its own system "
+                                          "of bodies" );
+            }
+        }
+    }
+}
+
+//! Function to make the SPICE-based models of the bodies of a list of estimators safe for concurrent use
+/*!
+ * Function to make the SPICE-based ephemerides and rotation models of the bodies of a list of estimators safe for
+ * concurrent use (see synchronizeSpiceAccess), since the (non-reentrant) CSPICE library is shared by all estimators,
+ * even if each of them uses its own system of bodies. Must be called before the estimators are evaluated concurrently;
+ * the original models must be put back with restoreSpiceAccessOfEstimators once the concurrent evaluation has finished.
+ * \param orbitDeterminationManagers Estimators of which the bodies are to be synchronized
+ * \return Models that have been replaced by this call (one entry per estimator)
+ */
+template< typename ObservationScalarType = double, typename TimeType = double >
+std::vector< SpiceAccessSynchronization > synchronizeSpiceAccessOfEstimators(
+        const std::vector< std::shared_ptr< tudat::simulation_setup::OrbitDeterminationManager< ObservationScalarType, TimeType > > >&
+        orbitDeterminationManagers )
+{
+    std::vector< SpiceAccessSynchronization > spiceAccessSynchronizations;
+    for( unsigned int i = 0; i < orbitDeterminationManagers.size( ); i++ )
+    {
+        tudat::simulation_setup::SystemOfBodies bodies = orbitDeterminationManagers.at( i )->getBodies( );
+        spiceAccessSynchronizations.push_back( synchronizeSpiceAccess( bodies ) );
+    }
+    return spiceAccessSynchronizations;
+}
+
+//! Function to put back the SPICE-based models of the bodies of a list of estimators (see restoreSpiceAccess)
+inline void restoreSpiceAccessOfEstimators( const std::vector< SpiceAccessSynchronization >& spiceAccessSynchronizations )
+{
+    for( unsigned int i = 0; i < spiceAccessSynchronizations.size( ); i++ )
+    {
+        restoreSpiceAccess( spiceAccessSynchronizations.at( i ) );
+    }
+}
+
+//! Function to reset the parameter estimate of a list of estimators concurrently, reintegrating their variational equations
+template< typename ObservationScalarType = double, typename TimeType = double >
+void resetParameterEstimatesInParallel(
+        const std::vector< std::shared_ptr< tudat::simulation_setup::OrbitDeterminationManager< ObservationScalarType, TimeType > > >&
+        orbitDeterminationManagers,
+        const Eigen::Matrix< ObservationScalarType, Eigen::Dynamic, 1 >& parameterEstimate )
+{
+    const std::vector< SpiceAccessSynchronization > spiceAccessSynchronizations =
+            synchronizeSpiceAccessOfEstimators( orbitDeterminationManagers );
+    try
+    {
+        executeTasksInParallel(
+                    orbitDeterminationManagers.size( ), static_cast< int >( orbitDeterminationManagers.size( ) ),
+                    [ & ]( const std::size_t estimatorIndex, const unsigned int )
+        {
+            orbitDeterminationManagers.at( estimatorIndex )->resetParameterEstimate( parameterEstimate, true );
+        } );
+    }
+    catch( ... )
+    {
+        restoreSpiceAccessOfEstimators( spiceAccessSynchronizations );
+        throw;
+    }
+    restoreSpiceAccessOfEstimators( spiceAccessSynchronizations );
+}
+
+//! Function to compute the residuals and observation partials of all observation sets of a collection concurrently
+/*!
+ * Function to compute the residuals and observation partials of all observation sets of a collection concurrently,
+ * with one task per SingleObservationSet. Each worker thread uses the observation managers of its own estimator, so that
+ * the estimators must be equivalent (same observation settings, parameters and propagator settings), but must each use
+ * their own system of bodies (e.g. created by the same function, or by cloneSystemOfBodies). The SPICE-based models of
+ * these bodies are replaced by synchronized wrappers (see synchronizeSpiceAccessOfEstimators) while the partials are
+ * computed, and put back afterwards. The number of worker
+ * threads is equal to the number of estimators.
+ *
+ * The residuals and partials of each observation set are written to the rows of that set in the concatenated
+ * observation vector of the collection, and are computed by the same sequence of operations whichever thread
+ * evaluates them; the results are therefore identical for any number of threads.
+ * \param orbitDeterminationManagers Estimators used by the worker threads (one per thread)
+ * \param observationCollection Observations for which the residuals and partials are computed
+ * \param parameterEstimate Parameter values at which the residuals and partials are computed. If empty, the current
+ * parameter values of the estimators are used, otherwise each estimator is reset to these values (and its
+ * variational equations reintegrated, concurrently) first.
+ * \param residuals Residuals (observed minus computed) of all observations (returned by reference)
+ * \param designMatrix Partials of all observations w.r.t. the estimated parameters (returned by reference)
+ */
+template< typename ObservationScalarType = double, typename TimeType = double >
+void computeResidualsAndPartialsInParallel(
+        const std::vector< std::shared_ptr< tudat::simulation_setup::OrbitDeterminationManager< ObservationScalarType, TimeType > > >&
+        orbitDeterminationManagers,
+        const std::shared_ptr< tudat::observation_models::ObservationCollection< ObservationScalarType, TimeType > >
+        observationCollection,
+        const Eigen::Matrix< ObservationScalarType, Eigen::Dynamic, 1 >& parameterEstimate,
+        Eigen::VectorXd& residuals,
+        Eigen::MatrixXd& designMatrix )
+{
+    if( orbitDeterminationManagers.size( ) == 0 )
+    {
+        throw std::runtime_error( "Error when computing observation partials in parallel, no estimators provided" );
+    }
+    checkEstimatorsUseSeparateBodies( orbitDeterminationManagers );
+
+    const int numberOfParameters =
+            orbitDeterminationManagers.at( 0 )->getParametersToEstimate( )->getEstimatedParameterSetSize( );
+    for( unsigned int i = 1; i < orbitDeterminationManagers.size( ); i++ )
+    {
+        if( orbitDeterminationManagers.at( i )->getParametersToEstimate( )->getEstimatedParameterSetSize( ) !=
+                numberOfParameters )
+        {
+            throw std::runtime_error( "Error when computing observation partials in parallel, estimators have different "
+                                      "numbers of parameters" );
+        }
+    }
+
+    if( parameterEstimate.rows( ) > 0 )
+    {
+        if( parameterEstimate.rows( ) != numberOfParameters )
+        {
+            throw std::runtime_error( "Error when computing observation partials in parallel, size of parameter estimate (" +
+                                      std::to_string( parameterEstimate.rows( ) ) + ") is inconsistent with estimated "
+                                      "parameters (" + std::to_string( numberOfParameters ) + ")" );
+        }
+        resetParameterEstimatesInParallel( orbitDeterminationManagers, parameterEstimate );
+    }
+
+    const std::vector< ObservationSetEntry< ObservationScalarType, TimeType > > observationSetEntries =
+            getObservationSetEntries( observationCollection );
+    const int totalNumberOfObservations = observationCollection->getTotalObservableSize( );
+    residuals = Eigen::VectorXd::Zero( totalNumberOfObservations );
+    designMatrix = Eigen::MatrixXd::Zero( totalNumberOfObservations, numberOfParameters );
+
+    const std::vector< SpiceAccessSynchronization > spiceAccessSynchronizations =
+            synchronizeSpiceAccessOfEstimators( orbitDeterminationManagers );
+    try
+    {
+        executeTasksInParallel(
+                    observationSetEntries.size( ), static_cast< int >( orbitDeterminationManagers.size( ) ),
+                    [ & ]( const std::size_t setIndex, const unsigned int threadIndex )
+        {
+            const ObservationSetEntry< ObservationScalarType, TimeType >& observationSetEntry =
+                    observationSetEntries.at( setIndex );
+            Eigen::VectorXd setResiduals;
+            Eigen::MatrixXd setPartials;
+            computeObservationSetResidualsAndPartials(
+                        orbitDeterminationManagers.at( threadIndex ), observationSetEntry, setResiduals, setPartials );
+
+            // Each set writes only to its own rows, so that no synchronization is needed
+            residuals.segment( observationSetEntry.startIndex_, observationSetEntry.numberOfObservations_ ) = setResiduals;
+            designMatrix.block( observationSetEntry.startIndex_, 0, observationSetEntry.numberOfObservations_,
+                                numberOfParameters ) = setPartials;
+        } );
+    }
+    catch( ... )
+    {
+        restoreSpiceAccessOfEstimators( spiceAccessSynchronizations );
+        throw;
+    }
+    restoreSpiceAccessOfEstimators( spiceAccessSynchronizations );
+}
+
+} // namespace tudatpy
+
+#endif // TUDATPY_OBSERVATION_PARTIALS_H
@@ -0,0 +1,110 @@
+/*    Copyright (c) 2010-2022, Delft University of Technology
+ *    All rights reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ */
+
+#ifndef TUDATPY_PARALLEL_EXECUTION_H
+#define TUDATPY_PARALLEL_EXECUTION_H
+
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace tudatpy
+{
+
+//! Function to determine the number of worker threads to use for a set of tasks
+/*!
+ * Function to determine the number of worker threads to use for a set of tasks
+ * \param requestedNumberOfThreads Number of threads requested by the user. If this value is zero or negative, the
+ * number of hardware threads reported by the system is used.
+ * \param numberOfTasks Number of independent tasks that are to be executed
+ * \return Number of worker threads (at least one, at most the number of tasks)
+ */
+inline unsigned int getNumberOfWorkerThreads( const int requestedNumberOfThreads,
+                                              const std::size_t numberOfTasks )
+{
+    unsigned int numberOfThreads = ( requestedNumberOfThreads > 0 ) ?
+                static_cast< unsigned int >( requestedNumberOfThreads ) : std::thread::hardware_concurrency( );
+    if( numberOfTasks < numberOfThreads )
+    {
+        numberOfThreads = static_cast< unsigned int >( numberOfTasks );
+    }
+    return std::max( numberOfThreads, 1U );
+}
+
+//! Function to execute a list of independent tasks on a pool of worker threads
+/*!
+ * Function to execute a list of independent tasks on a pool of worker threads. Tasks are not distributed over the
+ * threads beforehand, but are claimed one at a time from a shared counter, so that a thread that finishes its tasks
+ * early continues with the tasks that remain (which balances the load for tasks of strongly varying duration). The
+ * calling thread is used as one of the workers. If a task throws an exception, no new tasks are started, and the
+ * first exception that was caught is rethrown on the calling thread once all workers have finished.
+ * \param numberOfTasks Number of tasks to execute
+ * \param requestedNumberOfThreads Number of threads to use (see getNumberOfWorkerThreads)
+ * \param taskFunction Function executing a single task, called as taskFunction( taskIndex, threadIndex ), with
+ * threadIndex in [0, number of worker threads)
+ */
+template< typename TaskFunction >
+void executeTasksInParallel( const std::size_t numberOfTasks,
+                             const int requestedNumberOfThreads,
+                             TaskFunction taskFunction )
+{
+    const unsigned int numberOfThreads = getNumberOfWorkerThreads( requestedNumberOfThreads, numberOfTasks );
+
+    std::atomic< std::size_t > nextTaskIndex( 0 );
+    std::atomic< bool > exceptionCaught( false );
+    std::exception_ptr firstException;
+    std::mutex exceptionMutex;
+
+    auto workerFunction = [ & ]( const unsigned int threadIndex )
+    {
+        std::size_t currentTaskIndex;
+        while( !exceptionCaught && ( currentTaskIndex = nextTaskIndex++ ) < numberOfTasks )
+        {
+            try
+            {
+                taskFunction( currentTaskIndex, threadIndex );
+            }
+            catch( ... )
+            {
+                std::lock_guard< std::mutex > lock( exceptionMutex );
+                if( !exceptionCaught )
+                {
+                    firstException = std::current_exception( );
+                    exceptionCaught = true;
+                }
+            }
+        }
+    };
+
+    std::vector< std::thread > workerThreads;
+    workerThreads.reserve( numberOfThreads - 1 );
+    for( unsigned int i = 1; i < numberOfThreads; i++ )
+    {
+        workerThreads.emplace_back( workerFunction, i );
+    }
+    workerFunction( 0 );
+
+    for( unsigned int i = 0; i < workerThreads.size( ); i++ )
+    {
+        workerThreads.at( i ).join( );
+    }
+
+    if( firstException )
+    {
+        std::rethrow_exception( firstException );
+    }
+}
+
+} // namespace tudatpy
+
+#endif // TUDATPY_PARALLEL_EXECUTION_H
@@ -0,0 +1,408 @@
+/*    Copyright (c) 2010-2022, Delft University of Technology
+ *    All rights reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ */
+
+#ifndef TUDATPY_PIECEWISE_POLYNOMIAL_THRUST_H
+#define TUDATPY_PIECEWISE_POLYNOMIAL_THRUST_H
+
+#include <algorithm>
+#include <functional>
+#include <map>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include <Eigen/Core>
+
+#include "tudat/astro/reference_frames/referenceFrameTransformations.h"
+#include "tudat/math/interpolators/createInterpolator.h"
+#include "tudat/simulation/environment_setup/body.h"
+#include "tudat/simulation/environment_setup/createRotationModel.h"
+#include "tudat/simulation/propagation_setup/thrustSettings.h"
+
+namespace tudatpy
+{
+
+//! Piecewise polynomial function of time, with separate coefficients for each segment
+/*!
+ * Piecewise polynomial function of time, with separate coefficients for each segment. In segment i (between the segment
+ * boundaries t_i and t_i+1), the function is evaluated as sum_k c_ik ( t - t_i )^k, with c_ik the k-th row of the
+ * coefficient matrix of the segment (one column per component). Outside of the segments, the function is zero. The
+ * segment containing the evaluation time is found by checking the segment found in the previous evaluation (and the one
+ * after it) first, and by a binary search otherwise. The function can be evaluated into an existing vector (e.g. an
+ * Eigen::Vector3d for a thrust vector), so that no memory is allocated per evaluation.
+ */
+class PiecewisePolynomialFunction
+{
+public:
+
+    //! Constructor
+    /*!
+     * Constructor
+     * \param segmentBoundaries Times of the segment boundaries (size equal to number of segments + 1, increasing)
+     * \param segmentCoefficients Coefficients of each segment, with row k containing the coefficients of ( t - t_i )^k
+     * and one column per component (the polynomial order may differ between segments)
+     */
+    PiecewisePolynomialFunction( const std::vector< double >& segmentBoundaries,
+                                 const std::vector< Eigen::MatrixXd >& segmentCoefficients ):
+        segmentBoundaries_( segmentBoundaries ), segmentCoefficients_( segmentCoefficients ), lastSegmentIndex_( 0 )
+    {
+        if( segmentCoefficients_.size( ) == 0 || segmentBoundaries_.size( ) != segmentCoefficients_.size( ) + 1 )
+        {
+            throw std::runtime_error( "Error when creating piecewise polynomial, number of segment boundaries (" +
+                                      std::to_string( segmentBoundaries_.size( ) ) +
+                                      ") must be equal to the number of segments (" +
+                                      std::to_string( segmentCoefficients_.size( ) ) + ") + 1" );
+        }
+        for( unsigned int i = 0; i < segmentCoefficients_.size( ); i++ )
+        {
+            if( !( segmentBoundaries_.at( i + 1 ) > segmentBoundaries_.at( i ) ) )
+            {
+                throw std::runtime_error( "Error when creating piecewise polynomial, segment boundaries must be increasing" );
+            }
+            if( segmentCoefficients_.at( i ).rows( ) == 0 ||
+                    segmentCoefficients_.at( i ).cols( ) != segmentCoefficients_.at( 0 ).cols( ) )
+            {
+                throw std::runtime_error( "Error when creating piecewise polynomial, coefficients of segment " +
+                                          std::to_string( i ) + " are inconsistent with those of the first segment" );
+            }
+        }
+    }
+
+    //! Function to evaluate the function at the given time
+    Eigen::VectorXd evaluate( const double time )
+    {
+        Eigen::VectorXd value( getNumberOfComponents( ) );
+        evaluate( time, value );
+        return value;
+    }
+
+    //! Function to evaluate the function at the given time, into an existing vector
+    /*!
+     * Function to evaluate the function at the given time, into an existing vector
+     * \param time Time at which the function is evaluated
+     * \param value Vector in which the value is returned, with one entry per component (not resized)
+     */
+    void evaluate( const double time, Eigen::Ref< Eigen::VectorXd > value )
+    {
+        if( value.rows( ) != static_cast< long >( getNumberOfComponents( ) ) )
+        {
+            throw std::runtime_error( "Error when evaluating piecewise polynomial, size of output (" +
+                                      std::to_string( value.rows( ) ) + ") is inconsistent with number of components (" +
+                                      std::to_string( getNumberOfComponents( ) ) + ")" );
+        }
+
+        value.setZero( );
+        if( time < segmentBoundaries_.front( ) || time > segmentBoundaries_.back( ) )
+        {
+            return;
+        }
+
+        const unsigned int segmentIndex = findSegment( time );
+        const Eigen::MatrixXd& coefficients = segmentCoefficients_.at( segmentIndex );
+        const double localTime = time - segmentBoundaries_.at( segmentIndex );
+
+        // Horner evaluation, starting at the highest order
+        for( int k = static_cast< int >( coefficients.rows( ) ) - 1; k >= 0; k-- )
+        {
+            value = value * localTime + coefficients.row( k ).transpose( );
+        }
+    }
+
+    unsigned int getNumberOfComponents( )
+    {
+        return static_cast< unsigned int >( segmentCoefficients_.at( 0 ).cols( ) );
+    }
+
+    double getStartTime( )
+    {
+        return segmentBoundaries_.front( );
+    }
+
+    double getEndTime( )
+    {
+        return segmentBoundaries_.back( );
+    }
+
+private:
+
+    //! Function to find the index of the segment containing the given time (which must be in the domain)
+    unsigned int findSegment( const double time )
+    {
+        const unsigned int numberOfSegments = static_cast< unsigned int >( segmentCoefficients_.size( ) );
+        for( unsigned int segmentIndex = lastSegmentIndex_;
+             segmentIndex < std::min( lastSegmentIndex_ + 2, numberOfSegments ); segmentIndex++ )
+        {
+            if( time >= segmentBoundaries_.at( segmentIndex ) &&
+                    ( time < segmentBoundaries_.at( segmentIndex + 1 ) || segmentIndex == numberOfSegments - 1 ) )
+            {
+                lastSegmentIndex_ = segmentIndex;
+                return segmentIndex;
+            }
+        }
+
+        unsigned int segmentIndex = static_cast< unsigned int >(
+                    std::upper_bound( segmentBoundaries_.begin( ), segmentBoundaries_.end( ), time ) -
+                    segmentBoundaries_.begin( ) );
+        segmentIndex = std::min( ( segmentIndex == 0 ) ? 0 : segmentIndex - 1, numberOfSegments - 1 );
+
+        lastSegmentIndex_ = segmentIndex;
+        return segmentIndex;
+    }
+
+    std::vector< double > segmentBoundaries_;
+
+    std::vector< Eigen::MatrixXd > segmentCoefficients_;
+
+    unsigned int lastSegmentIndex_;
+};
+
+//! Frames in which the thrust vector of a PiecewisePolynomialThrustProfile can be defined
+enum PolynomialThrustFrames
+{
+    inertial_polynomial_thrust_frame,
+    rsw_polynomial_thrust_frame,
+    tnw_polynomial_thrust_frame
+};
+
+//! Thrust vector profile defined by a piecewise polynomial, in an inertial, RSW or TNW frame
+/*!
+ * Thrust vector profile defined by a piecewise polynomial (see PiecewisePolynomialFunction) with three components, in an
+ * inertial, RSW or TNW frame. The RSW and TNW frames are defined by the current state of the vehicle w.r.t. a central
+ * body. The thrust magnitude and inertial thrust direction are computed entirely in C++, and are used through the
+ * thrust magnitude settings and the (thrust direction-based) rotation model settings of the vehicle. Since both are
+ * evaluated at the same times, the most recent thrust vector is stored and reused.
+ */
+class PiecewisePolynomialThrustProfile
+{
+public:
+
+    //! Constructor
+    /*!
+     * Constructor
+     * \param thrustFunction Thrust vector (in N) in the thrust frame, as a function of time
+     * \param thrustFrame Frame in which the thrust vector is defined
+     * \param vehicle Body that is thrusting
+     * \param centralBody Body w.r.t. which the RSW or TNW frame is defined (unused for an inertial frame)
+     */
+    PiecewisePolynomialThrustProfile( const std::shared_ptr< PiecewisePolynomialFunction > thrustFunction,
+                                      const PolynomialThrustFrames thrustFrame,
+                                      const std::shared_ptr< tudat::simulation_setup::Body > vehicle,
+                                      const std::shared_ptr< tudat::simulation_setup::Body > centralBody ):
+        thrustFunction_( thrustFunction ), thrustFrame_( thrustFrame ),
+        vehicle_( vehicle ), centralBody_( centralBody ),
+        currentTime_( TUDAT_NAN ), currentThrustInThrustFrame_( Eigen::Vector3d::Zero( ) )
+    {
+        if( thrustFunction_->getNumberOfComponents( ) != 3 )
+        {
+            throw std::runtime_error( "Error when creating piecewise polynomial thrust profile, thrust must have 3 components, found " +
+                                      std::to_string( thrustFunction_->getNumberOfComponents( ) ) );
+        }
+        if( thrustFrame_ != inertial_polynomial_thrust_frame && ( vehicle == nullptr || centralBody == nullptr ) )
+        {
+            throw std::runtime_error( "Error when creating piecewise polynomial thrust profile, vehicle and central body are required for RSW or TNW thrust frame" );
+        }
+    }
+
+    //! Function to retrieve the thrust magnitude at the given time
+    double getThrustMagnitude( const double time )
+    {
+        update( time );
+        return currentThrustInThrustFrame_.norm( );
+    }
+
+    //! Function to retrieve the thrust direction in the inertial frame at the given time
+    /*!
+     * Function to retrieve the thrust direction in the inertial frame at the given time. If the thrust is zero, the
+     * direction of the first axis of the thrust frame is returned, so that the orientation of the vehicle remains
+     * defined.
+     * \param time Current time
+     * \return Thrust direction in the inertial frame
+     */
+    Eigen::Vector3d getInertialThrustDirection( const double time )
+    {
+        update( time );
+
+        Eigen::Vector3d thrustDirection = Eigen::Vector3d::UnitX( );
+        if( currentThrustInThrustFrame_.norm( ) > 0.0 )
+        {
+            thrustDirection = currentThrustInThrustFrame_.normalized( );
+        }
+
+        switch( thrustFrame_ )
+        {
+        case inertial_polynomial_thrust_frame:
+            return thrustDirection;
+        case rsw_polynomial_thrust_frame:
+            return tudat::reference_frames::getRswSatelliteCenteredToInertialFrameRotationMatrix(
+                        getRelativeState( ) ) * thrustDirection;
+        case tnw_polynomial_thrust_frame:
+            return tudat::reference_frames::getTnwToInertialRotation( getRelativeState( ), true ) * thrustDirection;
+        default:
+            throw std::runtime_error( "Error in piecewise polynomial thrust profile, thrust frame " +
+                                      std::to_string( thrustFrame_ ) + " not recognized" );
+        }
+    }
+
+    PolynomialThrustFrames getThrustFrame( )
+    {
+        return thrustFrame_;
+    }
+
+    std::shared_ptr< PiecewisePolynomialFunction > getThrustFunction( )
+    {
+        return thrustFunction_;
+    }
+
+private:
+
+    void update( const double time )
+    {
+        if( !( time == currentTime_ ) )
+        {
+            thrustFunction_->evaluate( time, currentThrustInThrustFrame_ );
+            currentTime_ = time;
+        }
+    }
+
+    Eigen::Vector6d getRelativeState( )
+    {
+        const std::shared_ptr< tudat::simulation_setup::Body > vehicle = vehicle_.lock( );
+        const std::shared_ptr< tudat::simulation_setup::Body > centralBody = centralBody_.lock( );
+        if( vehicle == nullptr || centralBody == nullptr )
+        {
+            throw std::runtime_error( "Error in piecewise polynomial thrust profile, vehicle or central body no longer exists" );
+        }
+        return vehicle->getState( ) - centralBody->getState( );
+    }
+
+    std::shared_ptr< PiecewisePolynomialFunction > thrustFunction_;
+
+    PolynomialThrustFrames thrustFrame_;
+
+    //! Vehicle and central body, stored as weak pointers since the profile is (indirectly) stored in the vehicle
+    std::weak_ptr< tudat::simulation_setup::Body > vehicle_;
+
+    std::weak_ptr< tudat::simulation_setup::Body > centralBody_;
+
+    double currentTime_;
+
+    Eigen::Vector3d currentThrustInThrustFrame_;
+};
+
+//! Function to create a piecewise polynomial thrust profile for a body in a system of bodies
+/*!
+ * Function to create a piecewise polynomial thrust profile for a body in a system of bodies (see
+ * PiecewisePolynomialThrustProfile and PiecewisePolynomialFunction)
+ * \param bodies System of bodies containing the vehicle
+ * \param bodyName Name of the vehicle
+ * \param segmentBoundaries Times of the segment boundaries (size equal to number of segments + 1, increasing)
+ * \param segmentCoefficients Coefficients of the thrust vector (in N) for each segment, with row k containing the
+ * coefficients of ( t - t_i )^k, and 3 columns
+ * \param thrustFrame Frame in which the thrust vector is defined
+ * \param centralBodyName Name of the body w.r.t. which the RSW or TNW frame is defined (unused for an inertial frame)
+ * \return Piecewise polynomial thrust profile
+ */
+inline std::shared_ptr< PiecewisePolynomialThrustProfile > createPiecewisePolynomialThrustProfile(
+        const tudat::simulation_setup::SystemOfBodies& bodies,
+        const std::string& bodyName,
+        const std::vector< double >& segmentBoundaries,
+        const std::vector< Eigen::MatrixXd >& segmentCoefficients,
+        const PolynomialThrustFrames thrustFrame = inertial_polynomial_thrust_frame,
+        const std::string& centralBodyName = "" )
+{
+    std::shared_ptr< tudat::simulation_setup::Body > centralBody;
+    if( thrustFrame != inertial_polynomial_thrust_frame )
+    {
+        if( centralBodyName == "" )
+        {
+            throw std::runtime_error( "Error when creating piecewise polynomial thrust profile, central body is required for RSW or TNW thrust frame" );
+        }
+        centralBody = bodies.at( centralBodyName );
+    }
+
+    return std::make_shared< PiecewisePolynomialThrustProfile >(
+                std::make_shared< PiecewisePolynomialFunction >( segmentBoundaries, segmentCoefficients ),
+                thrustFrame, bodies.at( bodyName ), centralBody );
+}
+
+//! Function to create thrust magnitude settings from a piecewise polynomial thrust profile, with constant specific impulse
+inline std::shared_ptr< tudat::simulation_setup::ThrustMagnitudeSettings > piecewisePolynomialThrustMagnitudeSettings(
+        const std::shared_ptr< PiecewisePolynomialThrustProfile > thrustProfile,
+        const double specificImpulse )
+{
+    return tudat::simulation_setup::fromFunctionThrustMagnitudeFixedIspSettings(
+                std::bind( &PiecewisePolynomialThrustProfile::getThrustMagnitude, thrustProfile, std::placeholders::_1 ),
+                specificImpulse );
+}
+
+//! Function to create thrust magnitude settings from a piecewise polynomial thrust profile, with tabulated specific impulse
+/*!
+ * Function to create thrust magnitude settings from a piecewise polynomial thrust profile, with the specific impulse
+ * interpolated from a table as a function of time.
+ * \param thrustProfile Thrust profile
+ * \param specificImpulseTable Specific impulse as a function of time
+ * \param interpolatorSettings Settings for the interpolation of the specific impulse table (linear interpolation with
+ * the boundary values used outside of the table if nullptr)
+ * \return Thrust magnitude settings
+ */
+inline std::shared_ptr< tudat::simulation_setup::ThrustMagnitudeSettings > piecewisePolynomialThrustMagnitudeSettings(
+        const std::shared_ptr< PiecewisePolynomialThrustProfile > thrustProfile,
+        const std::map< double, double >& specificImpulseTable,
+        const std::shared_ptr< tudat::interpolators::InterpolatorSettings > interpolatorSettings = nullptr )
+{
+    if( specificImpulseTable.size( ) == 0 )
+    {
+        throw std::runtime_error( "Error when creating piecewise polynomial thrust magnitude settings, specific impulse table is empty" );
+    }
+    else if( specificImpulseTable.size( ) == 1 )
+    {
+        return piecewisePolynomialThrustMagnitudeSettings( thrustProfile, specificImpulseTable.begin( )->second );
+    }
+
+    std::shared_ptr< tudat::interpolators::InterpolatorSettings > specificImpulseInterpolatorSettings = interpolatorSettings;
+    if( specificImpulseInterpolatorSettings == nullptr )
+    {
+        specificImpulseInterpolatorSettings = std::make_shared< tudat::interpolators::InterpolatorSettings >(
+                    tudat::interpolators::linear_interpolator, tudat::interpolators::huntingAlgorithm,
+                    false, tudat::interpolators::use_boundary_value );
+    }
+    const std::shared_ptr< tudat::interpolators::OneDimensionalInterpolator< double, double > > specificImpulseInterpolator =
+            tudat::interpolators::createOneDimensionalInterpolator< double, double >(
+                specificImpulseTable, specificImpulseInterpolatorSettings );
+
+    return tudat::simulation_setup::fromFunctionThrustMagnitudeSettings(
+                std::bind( &PiecewisePolynomialThrustProfile::getThrustMagnitude, thrustProfile, std::placeholders::_1 ),
+                [ = ]( const double time ){ return specificImpulseInterpolator->interpolate( time ); } );
+}
+
+//! Function to create rotation model settings that align the body-fixed x-axis with a piecewise polynomial thrust profile
+/*!
+ * Function to create rotation model settings for the vehicle, such that its body-fixed x-axis is aligned with the thrust
+ * direction of a piecewise polynomial thrust profile. Combined with an engine with body-fixed thrust direction along the
+ * x-axis (the default of add_engine_model), the thrust is applied in the direction of the profile.
+ * \param thrustProfile Thrust profile
+ * \param baseFrame Base frame of the rotation model
+ * \param targetFrame Target (body-fixed) frame of the rotation model
+ * \return Rotation model settings
+ */
+inline std::shared_ptr< tudat::simulation_setup::RotationModelSettings > piecewisePolynomialThrustRotationSettings(
+        const std::shared_ptr< PiecewisePolynomialThrustProfile > thrustProfile,
+        const std::string& baseFrame,
+        const std::string& targetFrame )
+{
+    return tudat::simulation_setup::bodyFixedDirectionBasedRotationSettings(
+                std::bind( &PiecewisePolynomialThrustProfile::getInertialThrustDirection, thrustProfile, std::placeholders::_1 ),
+                baseFrame, targetFrame );
+}
+
+} // namespace tudatpy
+
+#endif // TUDATPY_PIECEWISE_POLYNOMIAL_THRUST_H
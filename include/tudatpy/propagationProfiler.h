@@ -0,0 +1,246 @@
+/*    Copyright (c) 2010-2022, Delft University of Technology
+ *    All rights reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ */
+
+#ifndef TUDATPY_PROPAGATION_PROFILER_H
+#define TUDATPY_PROPAGATION_PROFILER_H
+
+#include <chrono>
+#include <fstream>
+#include <iomanip>
+#include <memory>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace tudatpy
+{
+
+//! Settings for profiling the propagation loop of a single-arc propagation
+class ProfilingSettings
+{
+public:
+
+    //! Constructor
+    /*!
+     * Constructor
+     * \param recordTraceEvents Boolean denoting whether the individual timing measurements are stored, so that they
+     * can be written to a trace file (in addition to the accumulated timing per quantity)
+     * \param maximumNumberOfTraceEvents Maximum number of timing measurements that is stored
+     */
+    ProfilingSettings( const bool recordTraceEvents = false,
+                       const unsigned int maximumNumberOfTraceEvents = 1000000 ):
+        recordTraceEvents_( recordTraceEvents ), maximumNumberOfTraceEvents_( maximumNumberOfTraceEvents ){ }
+
+    bool getRecordTraceEvents( ){ return recordTraceEvents_; }
+
+    unsigned int getMaximumNumberOfTraceEvents( ){ return maximumNumberOfTraceEvents_; }
+
+protected:
+
+    bool recordTraceEvents_;
+
+    unsigned int maximumNumberOfTraceEvents_;
+};
+
+//! Function to create settings for profiling the propagation loop of a single-arc propagation
+inline std::shared_ptr< ProfilingSettings > profilingSettings(
+        const bool recordTraceEvents = false,
+        const unsigned int maximumNumberOfTraceEvents = 1000000 )
+{
+    return std::make_shared< ProfilingSettings >( recordTraceEvents, maximumNumberOfTraceEvents );
+}
+
+//! Accumulated timing of a single quantity (function or part of the propagation loop) in a propagation
+/*!
+ * Accumulated timing of a single quantity (function or part of the propagation loop) in a propagation, timed on each
+ * call made by the propagation
+ */
+struct ProfiledQuantity
+{
+    ProfiledQuantity( const std::string& name,
+                      const std::string& category ):
+        name_( name ), category_( category ), numberOfCalls_( 0 ), totalTime_( 0.0 ){ }
+
+    double getMeanTime( ) const
+    {
+        return ( numberOfCalls_ > 0 ) ? totalTime_ / static_cast< double >( numberOfCalls_ ) : 0.0;
+    }
+
+    //! Name of the quantity
+    std::string name_;
+
+    //! Category of the quantity (e.g. acceleration, dependent_variable)
+    std::string category_;
+
+    //! Number of timed calls
+    unsigned long numberOfCalls_;
+
+    //! Total time (in seconds) of the timed calls
+    double totalTime_;
+};
+
+//! Class to accumulate the timing of the models and functions evaluated in a propagation
+class PropagationProfiler
+{
+public:
+
+    PropagationProfiler( const std::shared_ptr< ProfilingSettings > profilingSettings ):
+        profilingSettings_( profilingSettings ),
+        referenceTime_( std::chrono::steady_clock::now( ) ),
+        numberOfDroppedTraceEvents_( 0 ){ }
+
+    //! Function to add a quantity that is to be profiled, returning its index
+    unsigned int addQuantity( const std::string& name,
+                              const std::string& category )
+    {
+        profiledQuantities_.push_back( ProfiledQuantity( name, category ) );
+        return static_cast< unsigned int >( profiledQuantities_.size( ) - 1 );
+    }
+
+    //! Function to add a single timing measurement of a quantity
+    void addMeasurement( const unsigned int quantityIndex,
+                         const std::chrono::steady_clock::time_point startTime,
+                         const std::chrono::steady_clock::time_point endTime )
+    {
+        addMeasurement( quantityIndex, startTime, std::chrono::duration< double >( endTime - startTime ).count( ) );
+    }
+
+    //! Function to add a single timing measurement of a quantity, with the duration given in seconds
+    void addMeasurement( const unsigned int quantityIndex,
+                         const std::chrono::steady_clock::time_point startTime,
+                         const double duration )
+    {
+        ProfiledQuantity& profiledQuantity = profiledQuantities_.at( quantityIndex );
+        profiledQuantity.numberOfCalls_++;
+        profiledQuantity.totalTime_ += duration;
+
+        if( profilingSettings_->getRecordTraceEvents( ) )
+        {
+            if( traceEvents_.size( ) < profilingSettings_->getMaximumNumberOfTraceEvents( ) )
+            {
+                traceEvents_.push_back( TraceEvent{
+                                            quantityIndex,
+                                            std::chrono::duration< double >( startTime - referenceTime_ ).count( ),
+                                            duration } );
+            }
+            else
+            {
+                numberOfDroppedTraceEvents_++;
+            }
+        }
+    }
+
+    //! Function to retrieve the accumulated timing of all profiled quantities
+    std::vector< ProfiledQuantity > getProfiledQuantities( )
+    {
+        return profiledQuantities_;
+    }
+
+    unsigned long getNumberOfDroppedTraceEvents( )
+    {
+        return numberOfDroppedTraceEvents_;
+    }
+
+    //! Function to create a table with the timing of all profiled quantities, as a string
+    std::string getReport( )
+    {
+        std::vector< ProfiledQuantity > profiledQuantities = getProfiledQuantities( );
+
+        std::stringstream reportStream;
+        reportStream << std::left << std::setw( 20 ) << "Category" << std::setw( 60 ) << "Quantity"
+                     << std::right << std::setw( 12 ) << "Calls" << std::setw( 16 ) << "Mean [us]"
+                     << std::setw( 16 ) << "Total [s]" << std::endl;
+        for( const ProfiledQuantity& profiledQuantity : profiledQuantities )
+        {
+            reportStream << std::left << std::setw( 20 ) << profiledQuantity.category_
+                         << std::setw( 60 ) << profiledQuantity.name_
+                         << std::right << std::setw( 12 ) << profiledQuantity.numberOfCalls_
+                         << std::setw( 16 ) << std::fixed << std::setprecision( 3 ) << profiledQuantity.getMeanTime( ) * 1.0E6
+                         << std::setw( 16 ) << std::setprecision( 6 ) << profiledQuantity.totalTime_ << std::endl;
+        }
+        return reportStream.str( );
+    }
+
+    //! Function to write the recorded timing measurements to a file in the Chrome trace event (JSON) format
+    /*!
+     * Function to write the recorded timing measurements to a file in the Chrome trace event (JSON) format, which can
+     * be inspected with chrome://tracing or Perfetto. Requires the trace events to have been recorded (see
+     * ProfilingSettings).
+     * \param fileName Name of the trace file
+     */
+    void writeChromeTrace( const std::string& fileName )
+    {
+        if( !profilingSettings_->getRecordTraceEvents( ) )
+        {
+            throw std::runtime_error( "Error when writing Chrome trace, recording of trace events was not enabled in the profiling settings" );
+        }
+
+        std::ofstream traceFile( fileName );
+        if( !traceFile.is_open( ) )
+        {
+            throw std::runtime_error( "Error when opening trace file " + fileName + " for writing" );
+        }
+
+        traceFile << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[";
+        traceFile << std::fixed << std::setprecision( 3 );
+        for( unsigned int i = 0; i < traceEvents_.size( ); i++ )
+        {
+            const ProfiledQuantity& profiledQuantity = profiledQuantities_.at( traceEvents_.at( i ).quantityIndex_ );
+            traceFile << ( i == 0 ? "" : "," ) << std::endl
+                      << "{\"name\":\"" << escapeJsonString( profiledQuantity.name_ )
+                      << "\",\"cat\":\"" << escapeJsonString( profiledQuantity.category_ )
+                      << "\",\"ph\":\"X\",\"pid\":0,\"tid\":0"
+                      << ",\"ts\":" << traceEvents_.at( i ).startTime_ * 1.0E6
+                      << ",\"dur\":" << traceEvents_.at( i ).duration_ * 1.0E6 << "}";
+        }
+        traceFile << std::endl << "]}" << std::endl;
+    }
+
+private:
+
+    //! Single timing measurement, with times in seconds since the creation of the profiler
+    struct TraceEvent
+    {
+        unsigned int quantityIndex_;
+
+        double startTime_;
+
+        double duration_;
+    };
+
+    static std::string escapeJsonString( const std::string& inputString )
+    {
+        std::string escapedString;
+        for( const char character : inputString )
+        {
+            if( character == '"' || character == '\\' )
+            {
+                escapedString += '\\';
+            }
+            escapedString += character;
+        }
+        return escapedString;
+    }
+
+    std::shared_ptr< ProfilingSettings > profilingSettings_;
+
+    std::chrono::steady_clock::time_point referenceTime_;
+
+    std::vector< ProfiledQuantity > profiledQuantities_;
+
+    std::vector< TraceEvent > traceEvents_;
+
+    unsigned long numberOfDroppedTraceEvents_;
+};
+
+} // namespace tudatpy
+
+#endif // TUDATPY_PROPAGATION_PROFILER_H
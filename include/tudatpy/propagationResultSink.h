@@ -0,0 +1,410 @@
+/*    Copyright (c) 2010-2022, Delft University of Technology
+ *    All rights reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ */
+
+#ifndef TUDATPY_PROPAGATION_RESULT_SINK_H
+#define TUDATPY_PROPAGATION_RESULT_SINK_H
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include <Eigen/Core>
+
+namespace tudatpy
+{
+
+//! Settings for streaming the output of a single-arc propagation to a file, while the propagation is running
+/*!
+ * Settings for streaming the output of a single-arc propagation to a file, while the propagation is running. The
+ * (processed) states and dependent variables of the saved steps are buffered in memory in chunks of a fixed number of
+ * steps, and each chunk is appended to the file once it is full. The memory used for the propagation results is
+ * therefore bounded by the chunk size, regardless of the length of the arc.
+ */
+class ResultSinkSettings
+{
+public:
+
+    //! Constructor
+    /*!
+     * Constructor
+     * \param fileName Name of the file to which the results are written (overwritten if it exists)
+     * \param stepsPerChunk Number of saved steps that are buffered in memory before being written to the file
+     */
+    ResultSinkSettings( const std::string& fileName,
+                        const unsigned int stepsPerChunk = 4096 ):
+        fileName_( fileName ), stepsPerChunk_( stepsPerChunk )
+    {
+        if( stepsPerChunk_ == 0 )
+        {
+            throw std::runtime_error( "Error when creating result sink settings, number of steps per chunk must be positive" );
+        }
+    }
+
+    std::string getFileName( ){ return fileName_; }
+
+    unsigned int getStepsPerChunk( ){ return stepsPerChunk_; }
+
+protected:
+
+    std::string fileName_;
+
+    unsigned int stepsPerChunk_;
+};
+
+//! Function to create settings for streaming the output of a single-arc propagation to a file
+inline std::shared_ptr< ResultSinkSettings > resultSinkSettings(
+        const std::string& fileName,
+        const unsigned int stepsPerChunk = 4096 )
+{
+    return std::make_shared< ResultSinkSettings >( fileName, stepsPerChunk );
+}
+
+//! Identifier at the start of each result sink file
+static const char resultSinkFileIdentifier[ 8 ] = { 'T', 'U', 'D', 'P', 'Y', 'R', 'E', 'S' };
+
+//! Version of the result sink file format
+static const std::uint32_t resultSinkFileFormatVersion = 1;
+
+/*!
+ *  The result sink file consists of a header, followed by any number of chunks. The header contains the file identifier,
+ *  the format version, the size of the (processed) state vector and the size of the dependent variable vector (all as
+ *  32-bit unsigned integers). Each chunk consists of the number of rows (64-bit unsigned integer) N, followed by the N
+ *  epochs, the N x n states (row-major) and the N x m dependent variables (row-major), all stored as doubles in the
+ *  native byte order. Within a chunk, the data is therefore stored column-wise per quantity, so that each block can be
+ *  read directly into a (row-major) array. When the propagation is finished, the last chunk is followed by an end
+ *  marker (a chunk with zero rows).
+ */
+
+//! Class that writes the output of a propagation to a result sink file, chunk by chunk
+class ChunkedResultWriter
+{
+public:
+
+    //! Constructor, opens the file and writes the header
+    /*!
+     * Constructor, opens the file and writes the header
+     * \param sinkSettings Settings for the result sink
+     * \param stateSize Size of the (processed) state vector that is saved at each step
+     * \param dependentVariableSize Size of the dependent variable vector that is saved at each step
+     * \param resumeFileSize If non-zero, the existing file is not overwritten, but its first resumeFileSize bytes
+     * (as returned by getCurrentFileSize when the propagation was checkpointed) are kept, and new chunks are written
+     * after them
+     */
+    ChunkedResultWriter( const std::shared_ptr< ResultSinkSettings > sinkSettings,
+                         const unsigned int stateSize,
+                         const unsigned int dependentVariableSize,
+                         const std::size_t resumeFileSize = 0 ):
+        stepsPerChunk_( sinkSettings->getStepsPerChunk( ) ), stateSize_( stateSize ),
+        dependentVariableSize_( dependentVariableSize ), numberOfBufferedSteps_( 0 ), numberOfWrittenSteps_( 0 )
+    {
+        if( resumeFileSize == 0 )
+        {
+            file_.open( sinkSettings->getFileName( ), std::ios::binary | std::ios::out | std::ios::trunc );
+        }
+        else
+        {
+            file_.open( sinkSettings->getFileName( ), std::ios::binary | std::ios::in | std::ios::out );
+        }
+
+        if( !file_.is_open( ) )
+        {
+            throw std::runtime_error( "Error when opening result sink file " + sinkSettings->getFileName( ) + " for writing" );
+        }
+
+        if( resumeFileSize == 0 )
+        {
+            const std::uint32_t header[ 3 ] = { resultSinkFileFormatVersion, stateSize_, dependentVariableSize_ };
+            file_.write( resultSinkFileIdentifier, sizeof( resultSinkFileIdentifier ) );
+            file_.write( reinterpret_cast< const char* >( header ), sizeof( header ) );
+        }
+        else
+        {
+            // Any data after the resume position is overwritten, or ignored when reading (see close)
+            file_.seekp( resumeFileSize );
+        }
+
+        epochBuffer_.reserve( stepsPerChunk_ );
+        stateBuffer_.reserve( stepsPerChunk_ * stateSize_ );
+        dependentVariableBuffer_.reserve( stepsPerChunk_ * dependentVariableSize_ );
+    }
+
+    ~ChunkedResultWriter( )
+    {
+        if( file_.is_open( ) )
+        {
+            // Errors cannot be propagated from the destructor; the file is then left with the chunks written so far
+            try
+            {
+                writeBufferedChunk( );
+            }
+            catch( const std::runtime_error& ){ }
+            file_.close( );
+        }
+    }
+
+    //! Function to add a saved step to the buffer, writing the buffer to the file when it is full
+    void addStep( const double time,
+                  const Eigen::VectorXd& state,
+                  const Eigen::VectorXd& dependentVariables )
+    {
+        if( static_cast< unsigned int >( state.rows( ) ) != stateSize_ ||
+                static_cast< unsigned int >( dependentVariables.rows( ) ) != dependentVariableSize_ )
+        {
+            throw std::runtime_error( "Error when writing step to result sink, state or dependent variable size is inconsistent" );
+        }
+
+        epochBuffer_.push_back( time );
+        stateBuffer_.insert( stateBuffer_.end( ), state.data( ), state.data( ) + stateSize_ );
+        dependentVariableBuffer_.insert( dependentVariableBuffer_.end( ), dependentVariables.data( ),
+                                         dependentVariables.data( ) + dependentVariableSize_ );
+        numberOfBufferedSteps_++;
+
+        if( numberOfBufferedSteps_ == stepsPerChunk_ )
+        {
+            writeBufferedChunk( );
+        }
+    }
+
+    //! Function to write the remaining buffered steps, and close the file
+    /*!
+     * Function to write the remaining buffered steps, and close the file. An end marker (a chunk with zero rows) is
+     * written after the last chunk, so that any data beyond it (left over from before a propagation was resumed) is
+     * ignored when reading the file.
+     */
+    void close( )
+    {
+        writeBufferedChunk( );
+        const std::uint64_t endMarker = 0;
+        file_.write( reinterpret_cast< const char* >( &endMarker ), sizeof( endMarker ) );
+        file_.close( );
+    }
+
+    //! Function to write the buffered steps to the file, without waiting for the chunk to be full
+    void flush( )
+    {
+        writeBufferedChunk( );
+    }
+
+    //! Function to retrieve the current size (in bytes) of the file, excluding any buffered steps
+    std::size_t getCurrentFileSize( )
+    {
+        return static_cast< std::size_t >( file_.tellp( ) );
+    }
+
+    std::size_t getNumberOfWrittenSteps( )
+    {
+        return numberOfWrittenSteps_ + numberOfBufferedSteps_;
+    }
+
+private:
+
+    void writeBufferedChunk( )
+    {
+        if( numberOfBufferedSteps_ > 0 )
+        {
+            const std::uint64_t numberOfRows = numberOfBufferedSteps_;
+            file_.write( reinterpret_cast< const char* >( &numberOfRows ), sizeof( numberOfRows ) );
+            file_.write( reinterpret_cast< const char* >( epochBuffer_.data( ) ), epochBuffer_.size( ) * sizeof( double ) );
+            file_.write( reinterpret_cast< const char* >( stateBuffer_.data( ) ), stateBuffer_.size( ) * sizeof( double ) );
+            file_.write( reinterpret_cast< const char* >( dependentVariableBuffer_.data( ) ),
+                         dependentVariableBuffer_.size( ) * sizeof( double ) );
+            file_.flush( );
+            if( !file_.good( ) )
+            {
+                throw std::runtime_error( "Error when writing chunk to result sink file" );
+            }
+
+            numberOfWrittenSteps_ += numberOfBufferedSteps_;
+            numberOfBufferedSteps_ = 0;
+            epochBuffer_.clear( );
+            stateBuffer_.clear( );
+            dependentVariableBuffer_.clear( );
+        }
+    }
+
+    std::ofstream file_;
+
+    unsigned int stepsPerChunk_;
+
+    std::uint32_t stateSize_;
+
+    std::uint32_t dependentVariableSize_;
+
+    std::vector< double > epochBuffer_;
+
+    std::vector< double > stateBuffer_;
+
+    std::vector< double > dependentVariableBuffer_;
+
+    unsigned int numberOfBufferedSteps_;
+
+    std::size_t numberOfWrittenSteps_;
+};
+
+//! Class that provides (lazy) access to the propagation results stored in a result sink file
+/*!
+ * Class that provides (lazy) access to the propagation results stored in a result sink file. On creation, only the
+ * header and the chunk sizes are read from the file. The epochs, states and dependent variables are read only when
+ * requested, and only for the requested range of rows.
+ */
+class ChunkedResultReader
+{
+public:
+
+    //! Constructor, reads the file header and builds the index of chunks
+    ChunkedResultReader( const std::string& fileName ):
+        fileName_( fileName ), numberOfRows_( 0 )
+    {
+        std::ifstream file( fileName_, std::ios::binary | std::ios::in );
+        if( !file.is_open( ) )
+        {
+            throw std::runtime_error( "Error when opening result sink file " + fileName_ + " for reading" );
+        }
+
+        char fileIdentifier[ sizeof( resultSinkFileIdentifier ) ];
+        std::uint32_t header[ 3 ];
+        file.read( fileIdentifier, sizeof( fileIdentifier ) );
+        file.read( reinterpret_cast< char* >( header ), sizeof( header ) );
+        if( !file.good( ) || std::memcmp( fileIdentifier, resultSinkFileIdentifier, sizeof( fileIdentifier ) ) != 0 )
+        {
+            throw std::runtime_error( "Error when reading result sink file " + fileName_ + ", file is not a result sink file" );
+        }
+        if( header[ 0 ] != resultSinkFileFormatVersion )
+        {
+            throw std::runtime_error( "Error when reading result sink file " + fileName_ + ", file format version " +
+                                      std::to_string( header[ 0 ] ) + " is not supported" );
+        }
+        stateSize_ = header[ 1 ];
+        dependentVariableSize_ = header[ 2 ];
+
+        const std::size_t headerSize = static_cast< std::size_t >( file.tellg( ) );
+        file.seekg( 0, std::ios::end );
+        const std::size_t fileSize = static_cast< std::size_t >( file.tellg( ) );
+        file.seekg( headerSize );
+
+        // Read chunk sizes, until the end marker, or a chunk that was not (completely) written, is found
+        std::uint64_t numberOfChunkRows;
+        while( file.read( reinterpret_cast< char* >( &numberOfChunkRows ), sizeof( numberOfChunkRows ) ) &&
+               numberOfChunkRows > 0 )
+        {
+            const std::size_t chunkOffset = static_cast< std::size_t >( file.tellg( ) );
+            const std::size_t chunkDataSize =
+                    numberOfChunkRows * ( 1 + stateSize_ + dependentVariableSize_ ) * sizeof( double );
+            if( chunkOffset + chunkDataSize > fileSize )
+            {
+                break;
+            }
+
+            chunkOffsets_.push_back( chunkOffset );
+            chunkFirstRows_.push_back( numberOfRows_ );
+            chunkSizes_.push_back( static_cast< std::size_t >( numberOfChunkRows ) );
+            numberOfRows_ += static_cast< std::size_t >( numberOfChunkRows );
+
+            file.seekg( chunkOffset + chunkDataSize );
+        }
+    }
+
+    std::string getFileName( ){ return fileName_; }
+
+    std::size_t getNumberOfRows( ){ return numberOfRows_; }
+
+    unsigned int getStateSize( ){ return stateSize_; }
+
+    unsigned int getDependentVariableSize( ){ return dependentVariableSize_; }
+
+    std::size_t getNumberOfChunks( ){ return chunkSizes_.size( ); }
+
+    //! Function to read the epochs of rows [startRow, endRow) into a buffer of size endRow - startRow
+    void readEpochs( const std::size_t startRow, const std::size_t endRow, double* buffer )
+    {
+        readBlock( startRow, endRow, 0, 1, buffer );
+    }
+
+    //! Function to read the states of rows [startRow, endRow) into a (row-major) buffer
+    void readStates( const std::size_t startRow, const std::size_t endRow, double* buffer )
+    {
+        readBlock( startRow, endRow, 1, stateSize_, buffer );
+    }
+
+    //! Function to read the dependent variables of rows [startRow, endRow) into a (row-major) buffer
+    void readDependentVariables( const std::size_t startRow, const std::size_t endRow, double* buffer )
+    {
+        readBlock( startRow, endRow, 1 + stateSize_, dependentVariableSize_, buffer );
+    }
+
+private:
+
+    //! Function to read a block of a single quantity (epochs, states or dependent variables) for a range of rows
+    /*!
+     * Function to read a block of a single quantity (epochs, states or dependent variables) for a range of rows
+     * \param startRow First row to read
+     * \param endRow Row after the last row to read
+     * \param blockOffset Offset (in number of columns) of the quantity's block in a chunk
+     * \param blockWidth Number of columns of the quantity
+     * \param buffer Buffer of size ( endRow - startRow ) * blockWidth to which the data is written
+     */
+    void readBlock( const std::size_t startRow, const std::size_t endRow,
+                    const std::size_t blockOffset, const std::size_t blockWidth,
+                    double* buffer )
+    {
+        if( startRow > endRow || endRow > numberOfRows_ )
+        {
+            throw std::runtime_error( "Error when reading result sink file, requested rows [" + std::to_string( startRow ) +
+                                      ", " + std::to_string( endRow ) + ") are not in file with " +
+                                      std::to_string( numberOfRows_ ) + " rows" );
+        }
+
+        std::ifstream file( fileName_, std::ios::binary | std::ios::in );
+        for( unsigned int i = 0; i < chunkSizes_.size( ); i++ )
+        {
+            const std::size_t chunkStart = chunkFirstRows_.at( i );
+            const std::size_t chunkEnd = chunkStart + chunkSizes_.at( i );
+            if( chunkEnd <= startRow || chunkStart >= endRow )
+            {
+                continue;
+            }
+
+            const std::size_t firstRowToRead = std::max( startRow, chunkStart );
+            const std::size_t lastRowToRead = std::min( endRow, chunkEnd );
+            file.seekg( chunkOffsets_.at( i ) +
+                        ( blockOffset * chunkSizes_.at( i ) + ( firstRowToRead - chunkStart ) * blockWidth ) * sizeof( double ) );
+            file.read( reinterpret_cast< char* >( buffer + ( firstRowToRead - startRow ) * blockWidth ),
+                       ( lastRowToRead - firstRowToRead ) * blockWidth * sizeof( double ) );
+        }
+
+        if( !file.good( ) )
+        {
+            throw std::runtime_error( "Error when reading data from result sink file " + fileName_ );
+        }
+    }
+
+    std::string fileName_;
+
+    std::uint32_t stateSize_;
+
+    std::uint32_t dependentVariableSize_;
+
+    std::size_t numberOfRows_;
+
+    std::vector< std::size_t > chunkOffsets_;
+
+    std::vector< std::size_t > chunkFirstRows_;
+
+    std::vector< std::size_t > chunkSizes_;
+};
+
+} // namespace tudatpy
+
+#endif // TUDATPY_PROPAGATION_RESULT_SINK_H
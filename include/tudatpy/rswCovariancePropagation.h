@@ -0,0 +1,453 @@
+/*    Copyright (c) 2010-2022, Delft University of Technology
+ *    All rights reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ */
+
+#ifndef TUDATPY_RSW_COVARIANCE_PROPAGATION_H
+#define TUDATPY_RSW_COVARIANCE_PROPAGATION_H
+
+#include <algorithm>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include <Eigen/Core>
+
+#include "tudat/astro/reference_frames/referenceFrameTransformations.h"
+#include "tudat/simulation/estimation_setup.h"
+
+#include "tudatpy/parallelExecution.h"
+
+namespace tudatpy
+{
+
+//! Translational state in the propagated state, of which the covariance is rotated to the RSW frame
+struct RswStateBlock
+{
+    RswStateBlock( const std::string& bodyName, const std::string& centralBodyName, const int startIndex ):
+        bodyName_( bodyName ), centralBodyName_( centralBodyName ), startIndex_( startIndex ){ }
+
+    //! Body of which the state is estimated (the satellite of the RSW frame)
+    std::string bodyName_;
+
+    //! Central body w.r.t. which the state is estimated
+    std::string centralBodyName_;
+
+    //! Index of the first entry of the state in the propagated state (the rows of the combined state transition and
+    //! sensitivity matrix). For a single-arc estimation, this is equal to its index in the parameter vector.
+    int startIndex_;
+};
+
+//! Translational states of an estimation of which the covariance is rotated to the RSW frame, per arc
+struct RswPropagationSetup
+{
+    //! Translational states in the propagated state, per arc (a single entry for a single-arc estimation)
+    std::vector< std::vector< RswStateBlock > > arcRswStateBlocks_;
+
+    //! Start times of the arcs of a multi- or hybrid-arc estimation (empty for a single-arc estimation)
+    std::vector< double > arcStartTimes_;
+
+    //! Function to check whether the estimation is single-arc, in which case all parameters are included in the output
+    bool isSingleArc( ) const
+    {
+        return arcStartTimes_.size( ) == 0;
+    }
+};
+
+//! Function to retrieve the initial translational states of a parameter set, for the RSW transformation
+/*!
+ * Function to retrieve the initial translational states of a (single-, multi- or hybrid-arc) parameter set, for the
+ * RSW transformation. The propagated state at a given epoch consists of the single-arc states, followed (for a multi- or
+ * hybrid-arc estimation) by the states of the arc containing that epoch, in the order of the arc-wise initial state
+ * parameters.
+ * \param parameterSet Estimated parameters
+ * \return Translational states per arc, and start times of the arcs
+ */
+inline RswPropagationSetup getRswPropagationSetup(
+        const std::shared_ptr< tudat::estimatable_parameters::EstimatableParameterSet< double > > parameterSet )
+{
+    std::vector< RswStateBlock > singleArcRswStateBlocks;
+    std::vector< std::shared_ptr< tudat::estimatable_parameters::ArcWiseInitialTranslationalStateParameter< double > > >
+            arcWiseInitialStates;
+    int singleArcStateSize = 0;
+    for( auto parameterIterator : parameterSet->getInitialStateParameters( ) )
+    {
+        if( tudat::estimatable_parameters::isDynamicalParameterSingleArc( parameterIterator.second ) )
+        {
+            if( std::dynamic_pointer_cast< tudat::estimatable_parameters::InitialTranslationalStateParameter< double > >(
+                        parameterIterator.second ) != nullptr )
+            {
+                std::shared_ptr< tudat::estimatable_parameters::InitialTranslationalStateParameter< double > > initialState =
+                        std::dynamic_pointer_cast< tudat::estimatable_parameters::InitialTranslationalStateParameter< double > >(
+                            parameterIterator.second );
+                singleArcRswStateBlocks.push_back( RswStateBlock( initialState->getParameterName( ).second.first,
+                                                                  initialState->getCentralBody( ), parameterIterator.first ) );
+            }
+            singleArcStateSize += parameterIterator.second->getParameterSize( );
+        }
+        else if( std::dynamic_pointer_cast< tudat::estimatable_parameters::ArcWiseInitialTranslationalStateParameter< double > >(
+                     parameterIterator.second ) != nullptr )
+        {
+            arcWiseInitialStates.push_back(
+                        std::dynamic_pointer_cast< tudat::estimatable_parameters::ArcWiseInitialTranslationalStateParameter< double > >(
+                            parameterIterator.second ) );
+        }
+        else
+        {
+            throw std::runtime_error( "Error when propagating covariance to RSW frame, only arc-wise translational states are "
+                                      "supported for multi-arc estimation" );
+        }
+    }
+
+    RswPropagationSetup rswPropagationSetup;
+    if( arcWiseInitialStates.size( ) == 0 )
+    {
+        rswPropagationSetup.arcRswStateBlocks_.push_back( singleArcRswStateBlocks );
+        return rswPropagationSetup;
+    }
+
+    rswPropagationSetup.arcStartTimes_ = arcWiseInitialStates.at( 0 )->getArcStartTimes( );
+    for( unsigned int i = 0; i < rswPropagationSetup.arcStartTimes_.size( ); i++ )
+    {
+        std::vector< RswStateBlock > currentArcRswStateBlocks = singleArcRswStateBlocks;
+        for( unsigned int j = 0; j < arcWiseInitialStates.size( ); j++ )
+        {
+            if( arcWiseInitialStates.at( j )->getArcStartTimes( ) != rswPropagationSetup.arcStartTimes_ )
+            {
+                throw std::runtime_error( "Error when propagating covariance to RSW frame, arc-wise initial states have "
+                                          "different arc start times" );
+            }
+
+            const std::vector< std::string > centralBodies = arcWiseInitialStates.at( j )->getCentralBodies( );
+            currentArcRswStateBlocks.push_back( RswStateBlock(
+                                                    arcWiseInitialStates.at( j )->getParameterName( ).second.first,
+                                                    centralBodies.at( centralBodies.size( ) == 1 ? 0 : i ),
+                                                    singleArcStateSize + 6 * j ) );
+        }
+        rswPropagationSetup.arcRswStateBlocks_.push_back( currentArcRswStateBlocks );
+    }
+    return rswPropagationSetup;
+}
+
+//! Function to determine the arc of each epoch at which the covariance is propagated
+/*!
+ * Function to determine the arc of each epoch at which the covariance is propagated: the last arc that starts at or
+ * before the epoch (all epochs belong to arc 0 for a single-arc estimation).
+ * \param arcStartTimes Start times of the arcs (empty for a single-arc estimation)
+ * \param evaluationTimes Epochs at which the covariance is propagated
+ * \return Indices of the epochs, per arc
+ */
+inline std::vector< std::vector< std::size_t > > getEpochIndicesPerArc(
+        const std::vector< double >& arcStartTimes,
+        const std::vector< double >& evaluationTimes )
+{
+    std::vector< std::vector< std::size_t > > epochIndicesPerArc( std::max< std::size_t >( arcStartTimes.size( ), 1 ) );
+    for( std::size_t i = 0; i < evaluationTimes.size( ); i++ )
+    {
+        int arcIndex = 0;
+        if( arcStartTimes.size( ) > 0 )
+        {
+            arcIndex = static_cast< int >( std::upper_bound( arcStartTimes.begin( ), arcStartTimes.end( ),
+                                                             evaluationTimes.at( i ) ) - arcStartTimes.begin( ) ) - 1;
+            if( arcIndex < 0 )
+            {
+                throw std::runtime_error( "Error when propagating covariance to RSW frame, epoch " +
+                                          std::to_string( evaluationTimes.at( i ) ) + " is before the start of the first arc" );
+            }
+        }
+        epochIndicesPerArc.at( arcIndex ).push_back( i );
+    }
+    return epochIndicesPerArc;
+}
+
+//! Function to compute the rotation of a translational state from the inertial frame to the RSW frame of a body
+inline Eigen::Matrix6d getInertialToRswStateRotation(
+        const tudat::simulation_setup::SystemOfBodies& bodies,
+        const RswStateBlock& rswStateBlock,
+        const double time )
+{
+    const Eigen::Vector6d relativeState =
+            bodies.getBody( rswStateBlock.bodyName_ )->getStateInBaseFrameFromEphemeris( time ) -
+            bodies.getBody( rswStateBlock.centralBodyName_ )->getStateInBaseFrameFromEphemeris( time );
+    const Eigen::Matrix3d inertialToRswPosition =
+            tudat::reference_frames::getInertialToRswSatelliteCenteredFrameRotationMatrix( relativeState );
+
+    Eigen::Matrix6d inertialToRswState = Eigen::Matrix6d::Zero( );
+    inertialToRswState.block( 0, 0, 3, 3 ) = inertialToRswPosition;
+    inertialToRswState.block( 3, 3, 3, 3 ) = inertialToRswPosition;
+    return inertialToRswState;
+}
+
+//! Function to check the size of a covariance matrix against a state transition interface
+inline void checkCovarianceSize(
+        const Eigen::MatrixXd& initialCovariance,
+        const std::shared_ptr< tudat::propagators::CombinedStateTransitionAndSensitivityMatrixInterface > stateTransitionInterface )
+{
+    const int numberOfParameters = stateTransitionInterface->getFullParameterVectorSize( );
+    if( initialCovariance.rows( ) != numberOfParameters || initialCovariance.cols( ) != numberOfParameters )
+    {
+        throw std::runtime_error( "Error when propagating covariance, size of covariance (" +
+                                  std::to_string( initialCovariance.rows( ) ) + "x" +
+                                  std::to_string( initialCovariance.cols( ) ) + ") is inconsistent with number of "
+                                  "parameters (" + std::to_string( numberOfParameters ) + ")" );
+    }
+}
+
+//! Function to compute the propagated covariance at a single epoch, in the RSW frame of the estimated bodies
+/*!
+ * Function to compute the propagated covariance at a single epoch, in the RSW frame of the estimated bodies. Only the
+ * rows of the combined state transition and sensitivity matrix Phi that belong to the propagated states (size m) differ
+ * from the identity matrix, so that Phi P Phi^T is obtained from the product of these m rows with P (O(m n^2) instead
+ * of O(n^3) for n parameters). The rotation to the RSW frame is applied to the rows and columns of each 6x6 translational
+ * state block separately; entries of other parameters are not rotated.
+ * \param initialCovariance Covariance of the parameters at the initial epoch (P)
+ * \param stateTransitionMatrix Rows of the combined state transition and sensitivity matrix belonging to the propagated
+ * states, at the current epoch
+ * \param rswRotations Rotation from the inertial to the RSW frame of each translational state block, at the current epoch
+ * \param rswStateBlocks Translational state blocks
+ * \param includeAllParameters Boolean denoting whether the covariance of all parameters (n x n) is returned, or only
+ * that of the propagated state (m x m). The former requires the propagated state to be the first m parameters, which is
+ * only the case for a single-arc estimation.
+ * \return Propagated covariance in the RSW frame
+ */
+inline Eigen::MatrixXd computePropagatedRswCovariance(
+        const Eigen::MatrixXd& initialCovariance,
+        const Eigen::MatrixXd& stateTransitionMatrix,
+        const std::vector< Eigen::Matrix6d >& rswRotations,
+        const std::vector< RswStateBlock >& rswStateBlocks,
+        const bool includeAllParameters = true )
+{
+    const int stateSize = static_cast< int >( stateTransitionMatrix.rows( ) );
+    const Eigen::MatrixXd propagatedStateRows = stateTransitionMatrix * initialCovariance;
+
+    Eigen::MatrixXd propagatedCovariance;
+    if( includeAllParameters )
+    {
+        propagatedCovariance = initialCovariance;
+        propagatedCovariance.topRows( stateSize ) = propagatedStateRows;
+        propagatedCovariance.leftCols( stateSize ) = propagatedStateRows.transpose( );
+        propagatedCovariance.topLeftCorner( stateSize, stateSize ) = propagatedStateRows * stateTransitionMatrix.transpose( );
+    }
+    else
+    {
+        propagatedCovariance = propagatedStateRows * stateTransitionMatrix.transpose( );
+    }
+
+    for( unsigned int i = 0; i < rswStateBlocks.size( ); i++ )
+    {
+        const int startIndex = rswStateBlocks.at( i ).startIndex_;
+        propagatedCovariance.middleRows( startIndex, 6 ) = rswRotations.at( i ) * propagatedCovariance.middleRows( startIndex, 6 );
+        propagatedCovariance.middleCols( startIndex, 6 ) = propagatedCovariance.middleCols( startIndex, 6 ) *
+                rswRotations.at( i ).transpose( );
+    }
+    return propagatedCovariance;
+}
+
+//! Function to compute the propagated formal errors at a single epoch, in the RSW frame of the estimated bodies
+/*!
+ * Function to compute the propagated formal errors at a single epoch, in the RSW frame of the estimated bodies, from
+ * the diagonal of the propagated covariance only (see computePropagatedRswCovariance): for each propagated state
+ * entry, the diagonal entry is the product of a row of Phi P with the same row of Phi; for each translational state
+ * block, the 6x6 block of the propagated covariance is computed and rotated. The full propagated covariance is not
+ * formed.
+ * \param initialCovariance Covariance of the parameters at the initial epoch (P)
+ * \param stateTransitionMatrix Rows of the combined state transition and sensitivity matrix belonging to the propagated
+ * states, at the current epoch
+ * \param rswRotations Rotation from the inertial to the RSW frame of each translational state block, at the current epoch
+ * \param rswStateBlocks Translational state blocks
+ * \param includeAllParameters Boolean denoting whether the formal errors of all parameters are returned, or only those
+ * of the propagated state (see computePropagatedRswCovariance)
+ * \return Propagated formal errors in the RSW frame
+ */
+inline Eigen::VectorXd computePropagatedRswFormalErrors(
+        const Eigen::MatrixXd& initialCovariance,
+        const Eigen::MatrixXd& stateTransitionMatrix,
+        const std::vector< Eigen::Matrix6d >& rswRotations,
+        const std::vector< RswStateBlock >& rswStateBlocks,
+        const bool includeAllParameters = true )
+{
+    const int stateSize = static_cast< int >( stateTransitionMatrix.rows( ) );
+    const Eigen::MatrixXd propagatedStateRows = stateTransitionMatrix * initialCovariance;
+
+    Eigen::VectorXd propagatedVariances = includeAllParameters ?
+                Eigen::VectorXd( initialCovariance.diagonal( ) ) : Eigen::VectorXd( stateSize );
+    propagatedVariances.head( stateSize ) =
+            propagatedStateRows.cwiseProduct( stateTransitionMatrix ).rowwise( ).sum( );
+
+    for( unsigned int i = 0; i < rswStateBlocks.size( ); i++ )
+    {
+        const int startIndex = rswStateBlocks.at( i ).startIndex_;
+        const Eigen::Matrix6d inertialCovarianceBlock =
+                propagatedStateRows.middleRows( startIndex, 6 ) * stateTransitionMatrix.middleRows( startIndex, 6 ).transpose( );
+        propagatedVariances.segment( startIndex, 6 ) =
+                ( rswRotations.at( i ) * inertialCovarianceBlock * rswRotations.at( i ).transpose( ) ).diagonal( );
+    }
+    return propagatedVariances.cwiseSqrt( );
+}
+
+//! Function to compute a quantity from the propagated covariance in the RSW frame at a list of epochs, one task per arc
+/*!
+ * Function to compute a quantity (covariance or formal errors) from the propagated covariance in the RSW frame at a list
+ * of epochs, for a single-, multi- or hybrid-arc estimation. The epochs of each arc are processed as a separate task,
+ * concurrently. The state transition and sensitivity matrices and the body states are retrieved under a lock, since
+ * their interpolators are not thread-safe; the products with the covariance (which make up most of the cost) are
+ * computed concurrently. Each epoch is written to its own entry of the output, so that the results do not depend on
+ * the number of threads.
+ * \param initialCovariance Covariance of the parameters at the initial epoch
+ * \param stateTransitionInterface Interface to the state transition and sensitivity matrices of the estimation
+ * \param bodies System of bodies, from which the states defining the RSW frames are retrieved
+ * \param parameterSet Estimated parameters
+ * \param evaluationTimes Epochs at which the quantity is computed
+ * \param numberOfThreads Number of threads to use (see getNumberOfWorkerThreads)
+ * \param epochFunction Function computing the quantity at a single epoch (computePropagatedRswCovariance or
+ * computePropagatedRswFormalErrors)
+ * \return Quantity at each epoch, in the order of evaluationTimes
+ */
+template< typename OutputType, typename EpochFunction >
+std::vector< OutputType > computeRswQuantityAtEpochs(
+        const Eigen::MatrixXd& initialCovariance,
+        const std::shared_ptr< tudat::propagators::CombinedStateTransitionAndSensitivityMatrixInterface > stateTransitionInterface,
+        const tudat::simulation_setup::SystemOfBodies& bodies,
+        const std::shared_ptr< tudat::estimatable_parameters::EstimatableParameterSet< double > > parameterSet,
+        const std::vector< double >& evaluationTimes,
+        const int numberOfThreads,
+        EpochFunction epochFunction )
+{
+    checkCovarianceSize( initialCovariance, stateTransitionInterface );
+    const RswPropagationSetup rswPropagationSetup = getRswPropagationSetup( parameterSet );
+    const std::vector< std::vector< std::size_t > > epochIndicesPerArc =
+            getEpochIndicesPerArc( rswPropagationSetup.arcStartTimes_, evaluationTimes );
+
+    std::vector< OutputType > rswQuantities( evaluationTimes.size( ) );
+    std::mutex interpolationMutex;
+    executeTasksInParallel(
+                epochIndicesPerArc.size( ), numberOfThreads,
+                [ & ]( const std::size_t arcIndex, const unsigned int )
+    {
+        const std::vector< RswStateBlock >& rswStateBlocks = rswPropagationSetup.arcRswStateBlocks_.at( arcIndex );
+        std::vector< Eigen::Matrix6d > rswRotations( rswStateBlocks.size( ) );
+        Eigen::MatrixXd stateTransitionMatrix;
+        for( const std::size_t epochIndex : epochIndicesPerArc.at( arcIndex ) )
+        {
+            const double currentTime = evaluationTimes.at( epochIndex );
+            {
+                std::lock_guard< std::mutex > lock( interpolationMutex );
+                stateTransitionMatrix = stateTransitionInterface->getCombinedStateTransitionAndSensitivityMatrix(
+                            currentTime, std::vector< std::string >( ) );
+                for( unsigned int i = 0; i < rswStateBlocks.size( ); i++ )
+                {
+                    rswRotations.at( i ) = getInertialToRswStateRotation( bodies, rswStateBlocks.at( i ), currentTime );
+                }
+            }
+            rswQuantities.at( epochIndex ) = epochFunction(
+                        initialCovariance, stateTransitionMatrix, rswRotations, rswStateBlocks,
+                        rswPropagationSetup.isSingleArc( ) );
+        }
+    } );
+    return rswQuantities;
+}
+
+//! Function to propagate a covariance matrix to a list of epochs, and rotate it to the RSW frame of the estimated bodies
+/*!
+ * Function to propagate a covariance matrix to a list of epochs, and rotate it to the RSW frame of the estimated bodies
+ * (see computePropagatedRswCovariance). For a single-arc estimation, the covariance of all parameters is returned; for a
+ * multi- or hybrid-arc estimation, the covariance of the propagated state at each epoch (single-arc states, followed by
+ * the states of the arc containing the epoch).
+ * \param initialCovariance Covariance of the parameters at the initial epoch
+ * \param stateTransitionInterface Interface to the state transition and sensitivity matrices of the estimation
+ * \param bodies System of bodies, from which the states defining the RSW frames are retrieved
+ * \param parameterSet Estimated parameters
+ * \param evaluationTimes Epochs at which the covariance is computed
+ * \param numberOfThreads Number of threads to use, with the epochs of each arc processed as a separate task
+ * \return Propagated covariance in the RSW frame, at each epoch (in the order of evaluationTimes)
+ */
+inline std::vector< Eigen::MatrixXd > propagateCovarianceRswAtEpochs(
+        const Eigen::MatrixXd& initialCovariance,
+        const std::shared_ptr< tudat::propagators::CombinedStateTransitionAndSensitivityMatrixInterface > stateTransitionInterface,
+        const tudat::simulation_setup::SystemOfBodies& bodies,
+        const std::shared_ptr< tudat::estimatable_parameters::EstimatableParameterSet< double > > parameterSet,
+        const std::vector< double >& evaluationTimes,
+        const int numberOfThreads = 1 )
+{
+    return computeRswQuantityAtEpochs< Eigen::MatrixXd >(
+                initialCovariance, stateTransitionInterface, bodies, parameterSet, evaluationTimes, numberOfThreads,
+                &computePropagatedRswCovariance );
+}
+
+//! Function to propagate the formal errors of the parameters to a list of epochs, in the RSW frame of the estimated bodies
+/*!
+ * Function to propagate the formal errors of the parameters to a list of epochs, in the RSW frame of the estimated
+ * bodies, without forming the propagated covariance (see computePropagatedRswFormalErrors). The entries are those of
+ * propagateCovarianceRswAtEpochs.
+ * \param initialCovariance Covariance of the parameters at the initial epoch
+ * \param stateTransitionInterface Interface to the state transition and sensitivity matrices of the estimation
+ * \param bodies System of bodies, from which the states defining the RSW frames are retrieved
+ * \param parameterSet Estimated parameters
+ * \param evaluationTimes Epochs at which the formal errors are computed
+ * \param numberOfThreads Number of threads to use, with the epochs of each arc processed as a separate task
+ * \return Propagated formal errors in the RSW frame, at each epoch (in the order of evaluationTimes)
+ */
+inline std::vector< Eigen::VectorXd > propagateFormalErrorsRswAtEpochs(
+        const Eigen::MatrixXd& initialCovariance,
+        const std::shared_ptr< tudat::propagators::CombinedStateTransitionAndSensitivityMatrixInterface > stateTransitionInterface,
+        const tudat::simulation_setup::SystemOfBodies& bodies,
+        const std::shared_ptr< tudat::estimatable_parameters::EstimatableParameterSet< double > > parameterSet,
+        const std::vector< double >& evaluationTimes,
+        const int numberOfThreads = 1 )
+{
+    return computeRswQuantityAtEpochs< Eigen::VectorXd >(
+                initialCovariance, stateTransitionInterface, bodies, parameterSet, evaluationTimes, numberOfThreads,
+                &computePropagatedRswFormalErrors );
+}
+
+//! Function to propagate a covariance matrix to a list of epochs in the RSW frame, as a time history
+inline std::map< double, Eigen::MatrixXd > propagateCovarianceRsw(
+        const Eigen::MatrixXd& initialCovariance,
+        const std::shared_ptr< tudat::propagators::CombinedStateTransitionAndSensitivityMatrixInterface > stateTransitionInterface,
+        const tudat::simulation_setup::SystemOfBodies& bodies,
+        const std::shared_ptr< tudat::estimatable_parameters::EstimatableParameterSet< double > > parameterSet,
+        const std::vector< double >& evaluationTimes,
+        const int numberOfThreads = 1 )
+{
+    const std::vector< Eigen::MatrixXd > propagatedRswCovariance = propagateCovarianceRswAtEpochs(
+                initialCovariance, stateTransitionInterface, bodies, parameterSet, evaluationTimes, numberOfThreads );
+
+    std::map< double, Eigen::MatrixXd > propagatedRswCovarianceHistory;
+    for( unsigned int i = 0; i < evaluationTimes.size( ); i++ )
+    {
+        propagatedRswCovarianceHistory[ evaluationTimes.at( i ) ] = propagatedRswCovariance.at( i );
+    }
+    return propagatedRswCovarianceHistory;
+}
+
+//! Function to propagate the formal errors of the parameters to a list of epochs in the RSW frame, as a time history
+inline std::map< double, Eigen::VectorXd > propagateFormalErrorsRsw(
+        const Eigen::MatrixXd& initialCovariance,
+        const std::shared_ptr< tudat::propagators::CombinedStateTransitionAndSensitivityMatrixInterface > stateTransitionInterface,
+        const tudat::simulation_setup::SystemOfBodies& bodies,
+        const std::shared_ptr< tudat::estimatable_parameters::EstimatableParameterSet< double > > parameterSet,
+        const std::vector< double >& evaluationTimes,
+        const int numberOfThreads = 1 )
+{
+    const std::vector< Eigen::VectorXd > propagatedRswFormalErrors = propagateFormalErrorsRswAtEpochs(
+                initialCovariance, stateTransitionInterface, bodies, parameterSet, evaluationTimes, numberOfThreads );
+
+    std::map< double, Eigen::VectorXd > propagatedRswFormalErrorHistory;
+    for( unsigned int i = 0; i < evaluationTimes.size( ); i++ )
+    {
+        propagatedRswFormalErrorHistory[ evaluationTimes.at( i ) ] = propagatedRswFormalErrors.at( i );
+    }
+    return propagatedRswFormalErrorHistory;
+}
+
+} // namespace tudatpy
+
+#endif // TUDATPY_RSW_COVARIANCE_PROPAGATION_H
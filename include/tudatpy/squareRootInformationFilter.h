@@ -0,0 +1,494 @@
+/*    Copyright (c) 2010-2022, Delft University of Technology
+ *    All rights reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ */
+
+#ifndef TUDATPY_SQUARE_ROOT_INFORMATION_FILTER_H
+#define TUDATPY_SQUARE_ROOT_INFORMATION_FILTER_H
+
+#include <cmath>
+#include <functional>
+#include <map>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include <Eigen/Dense>
+
+#include "tudat/astro/propagators/propagateCovariance.h"
+#include "tudat/simulation/estimation_setup.h"
+
+#include "tudatpy/observationPartials.h"
+
+namespace tudatpy
+{
+
+//! Sequential square-root information filter (SRIF) for the parameters of an estimator
+/*!
+ * Sequential square-root information filter (SRIF) for the parameters of an estimator, which processes observations
+ * batch by batch as they become available, instead of re-estimating from the full set of observations. The
+ * information is stored as an upper-triangular matrix R and vector z, such that the least-squares estimate of the
+ * deviation dy of the filter variables from the reference trajectory satisfies R dy = z. Each batch of observations is
+ * added by a Householder QR decomposition of R and z stacked on the (weighted) partials and residuals of the batch, so
+ * that the cost of an update only depends on the number of parameters and the size of the batch, not on the number of
+ * observations processed before.
+ *
+ * The filter variables are the estimated parameters, with the initial state replaced by the state at the current epoch
+ * of the filter. Initially, the current epoch is the initial epoch of the propagation, at which the parameters are
+ * defined. The filter is moved to a later epoch with propagateToEpoch, which maps the information forward with the
+ * state transition and sensitivity matrices of the estimator, and adds process noise to the state (if provided), so
+ * that information from earlier batches is de-weighted.
+ *
+ * The residuals and partials of each batch are computed with the observation managers of the estimator, at its current
+ * parameter values (the reference parameters, which define the reference trajectory), and the partials are mapped to
+ * the filter variables with the state transition and sensitivity matrices; the variational equations of the estimator
+ * must therefore cover the epochs of all observations and of the propagation of the filter. Observations should be
+ * added in order of time, at or after the current epoch. Since the dynamics of the estimator are only defined from the
+ * initial epoch, the reference can only be moved (with relinearize) by mapping the current estimate back to an
+ * equivalent initial state, and reintegrating the variational equations from the initial epoch.
+ */
+template< typename ObservationScalarType = double, typename TimeType = double >
+class SquareRootInformationFilter
+{
+public:
+
+    //! Constructor
+    /*!
+     * Constructor
+     * \param orbitDeterminationManager Estimator of which the parameters are estimated, and of which the observation
+     * managers and state transition interface are used. The current parameter values are used as a priori estimate.
+     * \param inverseAprioriCovariance Inverse of the a priori covariance of the parameters (no a priori information
+     * if empty)
+     */
+    SquareRootInformationFilter(
+            const std::shared_ptr< tudat::simulation_setup::OrbitDeterminationManager< ObservationScalarType, TimeType > >
+            orbitDeterminationManager,
+            const Eigen::MatrixXd& inverseAprioriCovariance = Eigen::MatrixXd::Zero( 0, 0 ) ):
+        orbitDeterminationManager_( orbitDeterminationManager ),
+        referenceParameters_( orbitDeterminationManager->getParametersToEstimate( )->
+                              template getFullParameterValues< ObservationScalarType >( ) ),
+        numberOfParameters_( static_cast< int >( referenceParameters_.rows( ) ) ),
+        squareRootInformationMatrix_( Eigen::MatrixXd::Zero( numberOfParameters_, numberOfParameters_ ) ),
+        informationVector_( Eigen::VectorXd::Zero( numberOfParameters_ ) ),
+        residualSumOfSquares_( 0.0 ),
+        numberOfObservations_( 0 ),
+        numberOfBatches_( 0 ),
+        isPropagated_( false ),
+        currentEpoch_( 0.0 ),
+        parameterTransitionMatrix_( Eigen::MatrixXd::Identity( numberOfParameters_, numberOfParameters_ ) ),
+        inverseParameterTransitionMatrix_( Eigen::MatrixXd::Identity( numberOfParameters_, numberOfParameters_ ) )
+    {
+        if( inverseAprioriCovariance.size( ) > 0 )
+        {
+            if( inverseAprioriCovariance.rows( ) != numberOfParameters_ || inverseAprioriCovariance.cols( ) != numberOfParameters_ )
+            {
+                throw std::runtime_error( "Error when creating square-root information filter, size of inverse a priori "
+                                          "covariance is inconsistent with number of parameters (" +
+                                          std::to_string( numberOfParameters_ ) + ")" );
+            }
+
+            const Eigen::LLT< Eigen::MatrixXd > aprioriDecomposition( inverseAprioriCovariance );
+            if( aprioriDecomposition.info( ) != Eigen::Success )
+            {
+                throw std::runtime_error( "Error when creating square-root information filter, inverse a priori covariance "
+                                          "is not positive definite" );
+            }
+            squareRootInformationMatrix_ = aprioriDecomposition.matrixU( );
+        }
+    }
+
+    //! Function to add a batch of observations to the filter
+    /*!
+     * Function to add a batch of observations to the filter. The observations of the batch are processed one
+     * observation set at a time, with their partials mapped to the filter variables at the current epoch.
+     * \param observationCollection Observations to add
+     * \param weights Weights of the observations, in the order of the concatenated observation vector of the collection
+     * \return Residuals (observed minus computed) of the observations w.r.t. the reference parameters
+     */
+    Eigen::VectorXd addObservations(
+            const std::shared_ptr< tudat::observation_models::ObservationCollection< ObservationScalarType, TimeType > >
+            observationCollection,
+            const Eigen::VectorXd& weights )
+    {
+        const int totalNumberOfObservations = observationCollection->getTotalObservableSize( );
+        if( weights.rows( ) != totalNumberOfObservations )
+        {
+            throw std::runtime_error( "Error when adding observations to square-root information filter, number of weights (" +
+                                      std::to_string( weights.rows( ) ) + ") is inconsistent with number of observations (" +
+                                      std::to_string( totalNumberOfObservations ) + ")" );
+        }
+        if( ( weights.array( ) < 0.0 ).any( ) )
+        {
+            throw std::runtime_error( "Error when adding observations to square-root information filter, weights must be "
+                                      "non-negative" );
+        }
+
+        Eigen::VectorXd residuals = Eigen::VectorXd::Zero( totalNumberOfObservations );
+        Eigen::VectorXd setResiduals;
+        Eigen::MatrixXd setPartials;
+        for( const ObservationSetEntry< ObservationScalarType, TimeType >& observationSetEntry :
+             getObservationSetEntries( observationCollection ) )
+        {
+            computeObservationSetResidualsAndPartials( orbitDeterminationManager_, observationSetEntry, setResiduals, setPartials );
+            residuals.segment( observationSetEntry.startIndex_, observationSetEntry.numberOfObservations_ ) = setResiduals;
+            if( isPropagated_ )
+            {
+                setPartials = setPartials * inverseParameterTransitionMatrix_;
+            }
+
+            const Eigen::VectorXd squareRootWeights = weights.segment(
+                        observationSetEntry.startIndex_, observationSetEntry.numberOfObservations_ ).cwiseSqrt( );
+            updateInformation( squareRootWeights.asDiagonal( ) * setPartials, squareRootWeights.cwiseProduct( setResiduals ) );
+        }
+        numberOfBatches_++;
+        return residuals;
+    }
+
+    //! Function to add a batch of observations with equal weights to the filter
+    Eigen::VectorXd addObservations(
+            const std::shared_ptr< tudat::observation_models::ObservationCollection< ObservationScalarType, TimeType > >
+            observationCollection,
+            const double weight )
+    {
+        return addObservations( observationCollection, Eigen::VectorXd::Constant(
+                                    observationCollection->getTotalObservableSize( ), weight ) );
+    }
+
+    //! Function to propagate the filter to a later epoch
+    /*!
+     * Function to propagate the filter to a later epoch, mapping the information on the filter variables with the
+     * state transition and sensitivity matrices of the estimator, after which process noise is added to the state
+     * (by the SRIF time update, which eliminates the noise variables with a QR decomposition)
+     * \param epoch Epoch to which the filter is propagated (may not be before the current epoch)
+     * \param processNoiseCovariance Covariance of the process noise added to the state between the current epoch and
+     * the new epoch (symmetric positive semi-definite, of the size of the state). If empty, the process noise function
+     * is used (see setProcessNoiseFunction); if that is not set either, no process noise is added.
+     */
+    void propagateToEpoch( const double epoch,
+                           const Eigen::MatrixXd& processNoiseCovariance = Eigen::MatrixXd::Zero( 0, 0 ) )
+    {
+        const double previousEpoch = getCurrentEpoch( );
+        if( epoch < previousEpoch )
+        {
+            throw std::runtime_error( "Error when propagating square-root information filter, epoch " + std::to_string( epoch ) +
+                                      " is before current epoch " + std::to_string( previousEpoch ) );
+        }
+
+        const Eigen::MatrixXd newParameterTransitionMatrix = getParameterTransitionMatrix( epoch );
+        const int stateSize = static_cast< int >(
+                    orbitDeterminationManager_->getStateTransitionAndSensitivityMatrixInterface( )->getStateTransitionMatrixSize( ) );
+        Eigen::MatrixXd currentProcessNoise = processNoiseCovariance;
+        if( currentProcessNoise.size( ) == 0 && processNoiseFunction_ != nullptr )
+        {
+            currentProcessNoise = processNoiseFunction_( previousEpoch, epoch );
+        }
+        if( currentProcessNoise.size( ) > 0 && ( currentProcessNoise.rows( ) != stateSize || currentProcessNoise.cols( ) != stateSize ) )
+        {
+            throw std::runtime_error( "Error when propagating square-root information filter, size of process noise covariance (" +
+                                      std::to_string( currentProcessNoise.rows( ) ) + "x" +
+                                      std::to_string( currentProcessNoise.cols( ) ) + ") is inconsistent with state size (" +
+                                      std::to_string( stateSize ) + ")" );
+        }
+
+        // Process noise covariance as F F^T, from an LDLT decomposition (which allows for a singular covariance)
+        Eigen::MatrixXd processNoiseFactor = Eigen::MatrixXd::Zero( stateSize, 0 );
+        if( currentProcessNoise.size( ) > 0 && !currentProcessNoise.isZero( 0.0 ) )
+        {
+            const Eigen::LDLT< Eigen::MatrixXd > noiseDecomposition( currentProcessNoise );
+            const Eigen::VectorXd diagonal = noiseDecomposition.vectorD( );
+            if( noiseDecomposition.info( ) != Eigen::Success || diagonal.minCoeff( ) < -1.0E-12 * diagonal.cwiseAbs( ).maxCoeff( ) )
+            {
+                throw std::runtime_error( "Error when propagating square-root information filter, process noise covariance "
+                                          "is not positive semi-definite" );
+            }
+            const Eigen::MatrixXd lowerFactor = noiseDecomposition.matrixL( );
+            processNoiseFactor = noiseDecomposition.transpositionsP( ).transpose( ) *
+                    ( lowerFactor * diagonal.cwiseMax( 0.0 ).cwiseSqrt( ).asDiagonal( ) );
+        }
+
+        // Information on the variables at the new epoch, R_new = R Psi_old Psi_new^-1, followed by the time update: stack
+        // [ I 0 0 ] on [ -R_new G F, R_new, z ] (with G selecting the state) and triangularize, eliminating the noise
+        const Eigen::MatrixXd mappedInformationMatrix = squareRootInformationMatrix_ * parameterTransitionMatrix_ *
+                newParameterTransitionMatrix.partialPivLu( ).inverse( );
+        const int numberOfNoiseVariables = static_cast< int >( processNoiseFactor.cols( ) );
+        Eigen::MatrixXd stackedInformation = Eigen::MatrixXd::Zero(
+                    numberOfNoiseVariables + numberOfParameters_, numberOfNoiseVariables + numberOfParameters_ + 1 );
+        stackedInformation.topLeftCorner( numberOfNoiseVariables, numberOfNoiseVariables ).setIdentity( );
+        stackedInformation.block( numberOfNoiseVariables, 0, numberOfParameters_, numberOfNoiseVariables ) =
+                -mappedInformationMatrix.leftCols( stateSize ) * processNoiseFactor;
+        stackedInformation.block( numberOfNoiseVariables, numberOfNoiseVariables, numberOfParameters_, numberOfParameters_ ) =
+                mappedInformationMatrix;
+        stackedInformation.bottomRightCorner( numberOfParameters_, 1 ) = informationVector_;
+
+        const Eigen::HouseholderQR< Eigen::MatrixXd > decomposition( stackedInformation );
+        const Eigen::MatrixXd triangularInformation =
+                decomposition.matrixQR( ).template triangularView< Eigen::Upper >( );
+        squareRootInformationMatrix_ = triangularInformation.block(
+                    numberOfNoiseVariables, numberOfNoiseVariables, numberOfParameters_, numberOfParameters_ );
+        informationVector_ = triangularInformation.block(
+                    numberOfNoiseVariables, numberOfNoiseVariables + numberOfParameters_, numberOfParameters_, 1 );
+
+        setParameterTransitionMatrix( newParameterTransitionMatrix );
+        currentEpoch_ = epoch;
+        isPropagated_ = true;
+    }
+
+    //! Function to set the function returning the process noise covariance of the state between two epochs
+    /*!
+     * Function to set the function returning the process noise covariance of the state between two epochs, used by
+     * propagateToEpoch when no process noise covariance is provided
+     * \param processNoiseFunction Function returning the process noise covariance, called as
+     * processNoiseFunction( previousEpoch, epoch ) (no process noise is added if nullptr)
+     */
+    void setProcessNoiseFunction( const std::function< Eigen::MatrixXd( const double, const double ) > processNoiseFunction )
+    {
+        processNoiseFunction_ = processNoiseFunction;
+    }
+
+    //! Function to retrieve the current epoch of the filter (the initial epoch of the propagation, if not propagated)
+    double getCurrentEpoch( )
+    {
+        if( isPropagated_ )
+        {
+            return currentEpoch_;
+        }
+
+        std::shared_ptr< tudat::propagators::SingleArcVariationalEquationsSolver< ObservationScalarType, TimeType > >
+                variationalEquationsSolver = std::dynamic_pointer_cast<
+                tudat::propagators::SingleArcVariationalEquationsSolver< ObservationScalarType, TimeType > >(
+                    orbitDeterminationManager_->getVariationalEquationsSolver( ) );
+        if( variationalEquationsSolver == nullptr )
+        {
+            throw std::runtime_error( "Error in square-root information filter, propagation of the filter is only supported "
+                                      "for single-arc estimators" );
+        }
+        return static_cast< double >(
+                    variationalEquationsSolver->getDynamicsSimulator( )->getPropagatorSettings( )->getInitialTime( ) );
+    }
+
+    //! Function to retrieve the current estimate of the parameters
+    /*!
+     * Function to retrieve the current estimate of the parameters. If the filter has been propagated, the estimate of
+     * the state at the current epoch is mapped back to the equivalent initial state (to first order, including the
+     * effect of the process noise).
+     * \return Current estimate of the parameters
+     */
+    Eigen::VectorXd getParameterEstimate( )
+    {
+        checkIsInformationMatrixRegular( );
+        return referenceParameters_.template cast< double >( ) + inverseParameterTransitionMatrix_ *
+                squareRootInformationMatrix_.triangularView< Eigen::Upper >( ).solve( informationVector_ );
+    }
+
+    //! Function to retrieve the current covariance of the parameters (mapped back to the initial epoch if propagated)
+    Eigen::MatrixXd getCovariance( )
+    {
+        return inverseParameterTransitionMatrix_ * getCurrentCovariance( ) * inverseParameterTransitionMatrix_.transpose( );
+    }
+
+    //! Function to retrieve the current covariance of the filter variables, with the state at the current epoch
+    Eigen::MatrixXd getCurrentCovariance( )
+    {
+        checkIsInformationMatrixRegular( );
+        const Eigen::MatrixXd inverseSquareRootInformationMatrix =
+                squareRootInformationMatrix_.triangularView< Eigen::Upper >( ).solve(
+                    Eigen::MatrixXd::Identity( numberOfParameters_, numberOfParameters_ ) );
+        return inverseSquareRootInformationMatrix * inverseSquareRootInformationMatrix.transpose( );
+    }
+
+    //! Function to retrieve the current formal errors of the parameters
+    Eigen::VectorXd getFormalErrors( )
+    {
+        return getCovariance( ).diagonal( ).cwiseSqrt( );
+    }
+
+    //! Function to retrieve the current covariance of the parameters, propagated to a list of epochs
+    /*!
+     * Function to retrieve the current covariance of the parameters, propagated to a list of epochs with the state
+     * transition and sensitivity matrices of the estimator
+     * \param evaluationTimes Epochs at which the covariance is computed
+     * \return Propagated covariance, per epoch
+     */
+    std::map< double, Eigen::MatrixXd > getPropagatedCovariance( const std::vector< double >& evaluationTimes )
+    {
+        std::map< double, Eigen::MatrixXd > propagatedCovariance;
+        tudat::propagators::propagateCovariance(
+                    propagatedCovariance, getCovariance( ),
+                    orbitDeterminationManager_->getStateTransitionAndSensitivityMatrixInterface( ), evaluationTimes );
+        return propagatedCovariance;
+    }
+
+    //! Function to move the reference parameters to the current estimate
+    /*!
+     * Function to move the reference parameters, at which the residuals and partials of new observations are computed,
+     * to the current estimate (see getParameterEstimate). The parameters of the estimator are reset, and its variational
+     * equations reintegrated from the initial epoch. The information of the observations processed so far is kept
+     * (linearized at the previous reference).
+     */
+    void relinearize( )
+    {
+        const Eigen::VectorXd parameterEstimate = getParameterEstimate( );
+        informationVector_ -= squareRootInformationMatrix_.triangularView< Eigen::Upper >( ) * parameterTransitionMatrix_ *
+                ( parameterEstimate - referenceParameters_.template cast< double >( ) );
+
+        referenceParameters_ = parameterEstimate.template cast< ObservationScalarType >( );
+        orbitDeterminationManager_->resetParameterEstimate( referenceParameters_, true );
+        if( isPropagated_ )
+        {
+            setParameterTransitionMatrix( getParameterTransitionMatrix( currentEpoch_ ) );
+        }
+    }
+
+    //! Function to retrieve the upper-triangular square root of the information matrix
+    Eigen::MatrixXd getSquareRootInformationMatrix( )
+    {
+        return squareRootInformationMatrix_;
+    }
+
+    //! Function to retrieve the information vector z (R times the deviation from the reference trajectory)
+    Eigen::VectorXd getInformationVector( )
+    {
+        return informationVector_;
+    }
+
+    //! Function to retrieve the reference parameters, at which the residuals and partials are computed
+    Eigen::VectorXd getReferenceParameters( )
+    {
+        return referenceParameters_.template cast< double >( );
+    }
+
+    //! Function to retrieve the weighted sum of squares of the residuals of the least-squares solution
+    double getResidualSumOfSquares( )
+    {
+        return residualSumOfSquares_;
+    }
+
+    //! Function to retrieve the number of observations processed so far
+    int getNumberOfObservations( )
+    {
+        return numberOfObservations_;
+    }
+
+    //! Function to retrieve the number of batches of observations processed so far
+    int getNumberOfBatches( )
+    {
+        return numberOfBatches_;
+    }
+
+private:
+
+    //! Function to compute the transition matrix of the filter variables from the initial epoch to a given epoch
+    /*!
+     * Function to compute the transition matrix of the filter variables from the initial epoch to a given epoch: the
+     * state transition and sensitivity matrices of the estimator for the state, and the identity for the other
+     * parameters (which Tudat orders after the initial states)
+     * \param epoch Epoch to which the variables are mapped
+     * \return Transition matrix of the filter variables
+     */
+    Eigen::MatrixXd getParameterTransitionMatrix( const double epoch )
+    {
+        const Eigen::MatrixXd combinedTransitionMatrix =
+                orbitDeterminationManager_->getStateTransitionAndSensitivityMatrixInterface( )->
+                getFullCombinedStateTransitionAndSensitivityMatrix( epoch, std::vector< std::string >( ) );
+        if( combinedTransitionMatrix.cols( ) != numberOfParameters_ )
+        {
+            throw std::runtime_error( "Error when propagating square-root information filter, size of state transition and "
+                                      "sensitivity matrix is inconsistent with number of parameters" );
+        }
+
+        Eigen::MatrixXd parameterTransitionMatrix = Eigen::MatrixXd::Identity( numberOfParameters_, numberOfParameters_ );
+        parameterTransitionMatrix.topRows( combinedTransitionMatrix.rows( ) ) = combinedTransitionMatrix;
+        return parameterTransitionMatrix;
+    }
+
+    //! Function to set the transition matrix of the filter variables to the current epoch, and its inverse
+    void setParameterTransitionMatrix( const Eigen::MatrixXd& parameterTransitionMatrix )
+    {
+        parameterTransitionMatrix_ = parameterTransitionMatrix;
+        inverseParameterTransitionMatrix_ = parameterTransitionMatrix.partialPivLu( ).inverse( );
+    }
+
+    //! Function to add the (weighted) partials and residuals of a set of observations to the information
+    void updateInformation( const Eigen::MatrixXd& weightedPartials, const Eigen::VectorXd& weightedResiduals )
+    {
+        const int numberOfRows = static_cast< int >( weightedPartials.rows( ) );
+        if( numberOfRows == 0 )
+        {
+            return;
+        }
+
+        // Stack [ R z ] on [ H r ] and triangularize; the last diagonal element is the norm of the added residual
+        Eigen::MatrixXd stackedInformation( numberOfParameters_ + numberOfRows, numberOfParameters_ + 1 );
+        stackedInformation.topLeftCorner( numberOfParameters_, numberOfParameters_ ) = squareRootInformationMatrix_;
+        stackedInformation.topRightCorner( numberOfParameters_, 1 ) = informationVector_;
+        stackedInformation.bottomLeftCorner( numberOfRows, numberOfParameters_ ) = weightedPartials;
+        stackedInformation.bottomRightCorner( numberOfRows, 1 ) = weightedResiduals;
+
+        const Eigen::HouseholderQR< Eigen::MatrixXd > decomposition( stackedInformation );
+        const Eigen::MatrixXd triangularInformation =
+                decomposition.matrixQR( ).topRows( numberOfParameters_ + 1 ).template triangularView< Eigen::Upper >( );
+
+        squareRootInformationMatrix_ = triangularInformation.topLeftCorner( numberOfParameters_, numberOfParameters_ );
+        informationVector_ = triangularInformation.topRightCorner( numberOfParameters_, 1 );
+        residualSumOfSquares_ += triangularInformation( numberOfParameters_, numberOfParameters_ ) *
+                triangularInformation( numberOfParameters_, numberOfParameters_ );
+        numberOfObservations_ += numberOfRows;
+    }
+
+    //! Function to check that the information matrix is regular, so that the parameters can be estimated
+    void checkIsInformationMatrixRegular( )
+    {
+        const Eigen::VectorXd diagonal = squareRootInformationMatrix_.diagonal( ).cwiseAbs( );
+        if( numberOfParameters_ > 0 && !( diagonal.minCoeff( ) > 1.0E-12 * diagonal.maxCoeff( ) ) )
+        {
+            throw std::runtime_error( "Error in square-root information filter, the information matrix is singular; not all "
+                                      "parameters are observable from the observations processed so far (use an a priori "
+                                      "covariance to constrain them)" );
+        }
+    }
+
+    std::shared_ptr< tudat::simulation_setup::OrbitDeterminationManager< ObservationScalarType, TimeType > >
+    orbitDeterminationManager_;
+
+    //! Parameter values at which the residuals and partials are computed (initial state of the reference trajectory)
+    Eigen::Matrix< ObservationScalarType, Eigen::Dynamic, 1 > referenceParameters_;
+
+    int numberOfParameters_;
+
+    //! Upper-triangular square root R of the information matrix
+    Eigen::MatrixXd squareRootInformationMatrix_;
+
+    //! Information vector z, with R dy = z for the deviation dy of the filter variables from the reference trajectory
+    Eigen::VectorXd informationVector_;
+
+    double residualSumOfSquares_;
+
+    int numberOfObservations_;
+
+    int numberOfBatches_;
+
+    //! Boolean denoting whether the filter has been propagated from the initial epoch
+    bool isPropagated_;
+
+    //! Epoch to which the filter has been propagated (if isPropagated_)
+    double currentEpoch_;
+
+    //! Transition matrix of the filter variables from the initial epoch to the current epoch
+    Eigen::MatrixXd parameterTransitionMatrix_;
+
+    //! Inverse of parameterTransitionMatrix_, mapping the partials w.r.t. the parameters to the filter variables
+    Eigen::MatrixXd inverseParameterTransitionMatrix_;
+
+    //! Function returning the process noise covariance of the state between two epochs (may be nullptr)
+    std::function< Eigen::MatrixXd( const double, const double ) > processNoiseFunction_;
+};
+
+} // namespace tudatpy
+
+#endif // TUDATPY_SQUARE_ROOT_INFORMATION_FILTER_H
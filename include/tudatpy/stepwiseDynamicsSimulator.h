@@ -0,0 +1,1613 @@
+/*    Copyright (c) 2010-2022, Delft University of Technology
+ *    All rights reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ */
+
+#ifndef TUDATPY_STEPWISE_DYNAMICS_SIMULATOR_H
+#define TUDATPY_STEPWISE_DYNAMICS_SIMULATOR_H
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <functional>
+#include <iostream>
+#include <map>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "tudat/math/integrators/createNumericalIntegrator.h"
+#include "tudat/simulation/propagation_setup.h"
+
+#include "tudatpy/continuousSolution.h"
+#include "tudatpy/eventDetection.h"
+#include "tudatpy/propagationProfiler.h"
+#include "tudatpy/propagationResultSink.h"
+#include "tudatpy/stepwiseIntegrator.h"
+
+namespace tudatpy
+{
+
+//! Class for defining settings for processing the results of a single-arc propagation, with tudatpy-specific options
+/*!
+ * Class for defining settings for processing the results of a single-arc propagation, with tudatpy-specific options
+ * in addition to those of the base class. When propagator settings contain an object of this type, the dynamics
+ * simulator created for them is a SingleArcStepwiseDynamicsSimulator, which implements these options.
+ */
+class ExtendedSingleArcPropagatorProcessingSettings: public tudat::propagators::SingleArcPropagatorProcessingSettings
+{
+public:
+
+    //! Constructor
+    /*!
+     * Constructor
+     * \param resultSinkSettings Settings for streaming the results to a file during the propagation (if nullptr, the
+     * results are stored in memory, as for the base class)
+     * \param profilingSettings Settings for profiling the propagation loop (if nullptr, the propagation is not profiled)
+     * \param createContinuousSolution Boolean denoting whether a continuous solution is created, by Lagrange
+     * interpolation between the states at the integration steps (see ContinuousSolution)
+     * \param outputTimeInterval Fixed interval between the epochs at which the results are saved, starting at the
+     * initial time (if NaN, the results are saved according to the save frequency settings, or outputEpochs)
+     * \param outputEpochs Epochs at which the results are saved (if empty, the results are saved according to the save
+     * frequency settings, or outputTimeInterval). The states at output epochs between two integration steps are
+     * integrated from the start of the step (see SingleArcStepwiseDynamicsSimulator::saveOutputEpochsInStep).
+     * \param eventSettings Settings for the events that are detected and located during the propagation
+     */
+    ExtendedSingleArcPropagatorProcessingSettings(
+            const std::shared_ptr< ResultSinkSettings > resultSinkSettings = nullptr,
+            const std::shared_ptr< ProfilingSettings > profilingSettings = nullptr,
+            const bool createContinuousSolution = false,
+            const double outputTimeInterval = TUDAT_NAN,
+            const std::vector< double >& outputEpochs = std::vector< double >( ),
+            const std::vector< std::shared_ptr< EventSettings > >& eventSettings =
+            std::vector< std::shared_ptr< EventSettings > >( ) ):
+        tudat::propagators::SingleArcPropagatorProcessingSettings( ),
+        resultSinkSettings_( resultSinkSettings ),
+        profilingSettings_( profilingSettings ),
+        createContinuousSolution_( createContinuousSolution ),
+        outputTimeInterval_( outputTimeInterval ),
+        outputEpochs_( outputEpochs ),
+        eventSettings_( eventSettings ){ }
+
+    std::shared_ptr< ResultSinkSettings > getResultSinkSettings( )
+    {
+        return resultSinkSettings_;
+    }
+
+    void setResultSinkSettings( const std::shared_ptr< ResultSinkSettings > resultSinkSettings )
+    {
+        resultSinkSettings_ = resultSinkSettings;
+    }
+
+    std::shared_ptr< ProfilingSettings > getProfilingSettings( )
+    {
+        return profilingSettings_;
+    }
+
+    void setProfilingSettings( const std::shared_ptr< ProfilingSettings > profilingSettings )
+    {
+        profilingSettings_ = profilingSettings;
+    }
+
+    bool getCreateContinuousSolution( )
+    {
+        return createContinuousSolution_;
+    }
+
+    void setCreateContinuousSolution( const bool createContinuousSolution )
+    {
+        createContinuousSolution_ = createContinuousSolution;
+    }
+
+    double getOutputTimeInterval( )
+    {
+        return outputTimeInterval_;
+    }
+
+    void setOutputTimeInterval( const double outputTimeInterval )
+    {
+        outputTimeInterval_ = outputTimeInterval;
+    }
+
+    std::vector< double > getOutputEpochs( )
+    {
+        return outputEpochs_;
+    }
+
+    void setOutputEpochs( const std::vector< double >& outputEpochs )
+    {
+        outputEpochs_ = outputEpochs;
+    }
+
+    std::vector< std::shared_ptr< EventSettings > > getEventSettings( )
+    {
+        return eventSettings_;
+    }
+
+    void setEventSettings( const std::vector< std::shared_ptr< EventSettings > >& eventSettings )
+    {
+        eventSettings_ = eventSettings;
+    }
+
+    //! Function to check whether the results are saved at output epochs, instead of at the integration steps
+    bool areResultsSavedAtOutputEpochs( )
+    {
+        return !std::isnan( outputTimeInterval_ ) || outputEpochs_.size( ) > 0;
+    }
+
+protected:
+
+    std::shared_ptr< ResultSinkSettings > resultSinkSettings_;
+
+    std::shared_ptr< ProfilingSettings > profilingSettings_;
+
+    bool createContinuousSolution_;
+
+    double outputTimeInterval_;
+
+    std::vector< double > outputEpochs_;
+
+    std::vector< std::shared_ptr< EventSettings > > eventSettings_;
+};
+
+//! Identifier at the start of each checkpoint file
+static const char checkpointFileIdentifier[ 8 ] = { 'T', 'U', 'D', 'P', 'Y', 'C', 'K', 'P' };
+
+//! Version of the checkpoint file format
+static const std::uint32_t checkpointFileFormatVersion = 5;
+
+//! Function to write a single value, in its native binary representation, to a file
+template< typename ValueType >
+void writeBinaryValue( std::ofstream& file, const ValueType& value )
+{
+    file.write( reinterpret_cast< const char* >( &value ), sizeof( ValueType ) );
+}
+
+//! Function to read a single value, in its native binary representation, from a file
+template< typename ValueType >
+ValueType readBinaryValue( std::ifstream& file )
+{
+    ValueType value;
+    file.read( reinterpret_cast< char* >( &value ), sizeof( ValueType ) );
+    return value;
+}
+
+//! Function to write a matrix (preceded by its number of rows and columns) to a file
+template< typename ScalarType, int NumberOfRows, int NumberOfColumns >
+void writeBinaryMatrix( std::ofstream& file, const Eigen::Matrix< ScalarType, NumberOfRows, NumberOfColumns >& matrix )
+{
+    writeBinaryValue( file, static_cast< std::uint64_t >( matrix.rows( ) ) );
+    writeBinaryValue( file, static_cast< std::uint64_t >( matrix.cols( ) ) );
+    file.write( reinterpret_cast< const char* >( matrix.data( ) ), matrix.size( ) * sizeof( ScalarType ) );
+}
+
+//! Function to read a matrix written by writeBinaryMatrix from a file
+template< typename ScalarType, int NumberOfColumns >
+Eigen::Matrix< ScalarType, Eigen::Dynamic, NumberOfColumns > readBinaryMatrix( std::ifstream& file )
+{
+    const std::uint64_t numberOfRows = readBinaryValue< std::uint64_t >( file );
+    const std::uint64_t numberOfColumns = readBinaryValue< std::uint64_t >( file );
+    if( !file.good( ) || ( NumberOfColumns != Eigen::Dynamic && numberOfColumns != NumberOfColumns ) )
+    {
+        throw std::runtime_error( "Error when reading matrix from binary file, file is incomplete or inconsistent" );
+    }
+
+    Eigen::Matrix< ScalarType, Eigen::Dynamic, NumberOfColumns > matrix( numberOfRows, numberOfColumns );
+    file.read( reinterpret_cast< char* >( matrix.data( ) ), matrix.size( ) * sizeof( ScalarType ) );
+    return matrix;
+}
+
+//! Single-arc dynamics simulator that integrates the equations of motion with a step-by-step loop controlled by tudatpy
+/*!
+ * Single-arc dynamics simulator that integrates the equations of motion with a step-by-step loop controlled by tudatpy,
+ * using the state derivative model, integrator settings, termination conditions and dependent variable functions
+ * created by the base class. Compared to the propagation loop of the base class, this allows the results of each saved
+ * step to be processed as soon as the step is accepted (for instance, by writing them to a result sink instead of
+ * storing them in memory), and allows the results to be saved at epochs other than the integration steps, by
+ * integrating within each step.
+ */
+template< typename StateScalarType = double, typename TimeType = double >
+class SingleArcStepwiseDynamicsSimulator: public tudat::propagators::SingleArcDynamicsSimulator< StateScalarType, TimeType >
+{
+public:
+
+    typedef tudat::propagators::SingleArcDynamicsSimulator< StateScalarType, TimeType > BaseSimulator;
+
+    typedef Eigen::Matrix< StateScalarType, Eigen::Dynamic, Eigen::Dynamic > StateType;
+
+    typedef StepwiseIntegrator< TimeType, StateScalarType > IntegratorType;
+
+    //! Constructor
+    /*!
+     * Constructor
+     * \param bodies System of bodies used in the propagation
+     * \param propagatorSettings Settings for the propagation
+     * \param areEquationsOfMotionToBeIntegrated Boolean denoting whether the equations of motion are to be integrated
+     * on creation of the object
+     */
+    SingleArcStepwiseDynamicsSimulator(
+            const tudat::simulation_setup::SystemOfBodies& bodies,
+            const std::shared_ptr< tudat::propagators::SingleArcPropagatorSettings< StateScalarType, TimeType > > propagatorSettings,
+            const bool areEquationsOfMotionToBeIntegrated = true ):
+        BaseSimulator( bodies, propagatorSettings, false ),
+        singleArcPropagatorSettings_( propagatorSettings ),
+        extendedProcessingSettings_( std::dynamic_pointer_cast< ExtendedSingleArcPropagatorProcessingSettings >(
+                                         propagatorSettings->getOutputSettings( ) ) ),
+        propagationIsInitialized_( false ),
+        propagationIsTerminated_( false ),
+        terminationDetails_( std::make_shared< tudat::propagators::PropagationTerminationDetails >(
+                                 tudat::propagators::propagation_never_run ) )
+    {
+        if( getResultSinkSettings( ) != nullptr && propagatorSettings->getOutputSettings( )->getSetIntegratedResult( ) )
+        {
+            throw std::runtime_error( "Error when creating stepwise dynamics simulator, the integrated result cannot be set "
+                                      "in the environment when results are written to a result sink" );
+        }
+
+        if( extendedProcessingSettings_ != nullptr && extendedProcessingSettings_->areResultsSavedAtOutputEpochs( ) )
+        {
+            if( !std::isnan( extendedProcessingSettings_->getOutputTimeInterval( ) ) &&
+                    extendedProcessingSettings_->getOutputEpochs( ).size( ) > 0 )
+            {
+                throw std::runtime_error( "Error when creating stepwise dynamics simulator, both an output time interval "
+                                          "and output epochs are defined" );
+            }
+            else if( !( extendedProcessingSettings_->getOutputTimeInterval( ) > 0.0 ) &&
+                     extendedProcessingSettings_->getOutputEpochs( ).size( ) == 0 )
+            {
+                throw std::runtime_error( "Error when creating stepwise dynamics simulator, output time interval must be "
+                                          "positive" );
+            }
+        }
+
+        if( areEquationsOfMotionToBeIntegrated )
+        {
+            integrateEquationsOfMotion( propagatorSettings->getInitialStates( ) );
+        }
+    }
+
+    ~SingleArcStepwiseDynamicsSimulator( ){ }
+
+    //! Function to integrate the equations of motion from the given initial state, until a termination condition is met
+    void integrateEquationsOfMotion( const StateType& initialStates ) override
+    {
+        initializePropagation( initialStates );
+        while( !propagationIsTerminated_ )
+        {
+            performPropagationStep( );
+        }
+    }
+
+    //! Function to (re)start a step-by-step propagation from the initial state in the propagator settings
+    void initializeStepwisePropagation( )
+    {
+        initializeStepwisePropagation( singleArcPropagatorSettings_->getInitialStates( ) );
+    }
+
+    //! Function to (re)start a step-by-step propagation from the given initial state
+    /*!
+     * Function to (re)start a step-by-step propagation from the given initial state. Any results of a previous
+     * propagation are discarded. During a step-by-step propagation, the environment is updated to the current state
+     * after each step, so that it can be inspected (and modified) in between steps.
+     * \param initialStates Initial (processed, e.g. Cartesian) state of the propagation
+     */
+    void initializeStepwisePropagation( const StateType& initialStates )
+    {
+        initializePropagation( initialStates );
+        environmentUpdateRequired_ = true;
+    }
+
+    //! Function to perform a number of integration steps of a step-by-step propagation
+    /*!
+     * Function to perform a number of integration steps of a step-by-step propagation. If the propagation has not yet
+     * been initialized, it is first initialized from the initial state in the propagator settings. Fewer steps are
+     * performed if a termination condition is met, in which case the results of the propagation are finalized.
+     * \param numberOfSteps Maximum number of integration steps to perform
+     * \return True if the propagation has terminated
+     */
+    bool performSteps( const unsigned int numberOfSteps = 1 )
+    {
+        if( !propagationIsInitialized_ )
+        {
+            initializeStepwisePropagation( );
+        }
+
+        for( unsigned int i = 0; i < numberOfSteps && !propagationIsTerminated_; i++ )
+        {
+            performPropagationStep( );
+        }
+        return propagationIsTerminated_;
+    }
+
+    //! Function to stop a step-by-step propagation at the current step, and finalize its results
+    void stopPropagation( )
+    {
+        if( !propagationIsInitialized_ )
+        {
+            throw std::runtime_error( "Error when stopping propagation, propagation is not initialized" );
+        }
+        else if( !propagationIsTerminated_ )
+        {
+            if( lastSavedTime_ != currentTime_ && !areResultsSavedAtOutputEpochs( ) )
+            {
+                saveStep( currentTime_, currentRawState_ );
+            }
+            terminatePropagation( std::make_shared< tudat::propagators::PropagationTerminationDetails >(
+                                      tudat::propagators::termination_condition_reached, false ) );
+        }
+    }
+
+    //! Function to replace the current state of a step-by-step propagation (e.g. to apply an impulsive manoeuvre)
+    /*!
+     * Function to replace the current state of a step-by-step propagation (e.g. to apply an impulsive manoeuvre). The
+     * next integration step starts from the new state; the results saved at the current epoch (if any) are not
+     * modified.
+     * \param newState New (processed, e.g. Cartesian) state at the current epoch
+     */
+    void modifyCurrentState( const StateType& newState )
+    {
+        if( !propagationIsInitialized_ || propagationIsTerminated_ )
+        {
+            throw std::runtime_error( "Error when modifying current state, no step-by-step propagation is running" );
+        }
+
+        currentRawState_ = dynamicsStateDerivative_->convertFromOutputSolution( newState, currentTime_ );
+        integrator_->modifyCurrentState( currentRawState_ );
+        currentStateDerivative_ = stateDerivativeFunction_( currentTime_, currentRawState_ );
+        if( continuousSolution_ != nullptr )
+        {
+            continuousSolution_->addNode( currentTime_, currentRawState_ );
+        }
+        if( eventDetector_ != nullptr )
+        {
+            eventDetector_->resetEventValues( );
+        }
+    }
+
+    //! Function to write the complete state of a running step-by-step propagation to a checkpoint file
+    /*!
+     * Function to write the complete state of a running step-by-step propagation to a checkpoint file, from which it
+     * can be resumed (see resumeFromCheckpoint). The checkpoint contains the current time, propagated state and time
+     * step of the integrator, the results saved so far (for a result sink, the position up to which the sink file is
+     * valid), the nodes of the continuous solution (if created), the events located so far, and the step, CPU time and
+     * function evaluation counters used by the termination conditions and save frequency. For the (multistep)
+     * Adams-Bashforth-Moulton integrator, the checkpoint also contains the history of the integrator (see
+     * StepwiseIntegratorHistory), including all its state derivative evaluations, so that the size of the checkpoint
+     * grows with the length of the propagation.
+     * \param fileName Name of the checkpoint file (overwritten if it exists)
+     */
+    void writeCheckpoint( const std::string& fileName )
+    {
+        if( !propagationIsInitialized_ || propagationIsTerminated_ )
+        {
+            throw std::runtime_error( "Error when writing checkpoint, no step-by-step propagation is running" );
+        }
+
+        std::uint64_t resultSinkFileSize = 0;
+        if( resultWriter_ != nullptr )
+        {
+            resultWriter_->flush( );
+            resultSinkFileSize = resultWriter_->getCurrentFileSize( );
+        }
+
+        // Write to temporary file first, so that an interrupted write does not invalidate an existing checkpoint
+        const std::string temporaryFileName = fileName + ".tmp";
+        {
+            std::ofstream checkpointFile( temporaryFileName, std::ios::binary | std::ios::out | std::ios::trunc );
+            if( !checkpointFile.is_open( ) )
+            {
+                throw std::runtime_error( "Error when opening checkpoint file " + temporaryFileName + " for writing" );
+            }
+
+            checkpointFile.write( checkpointFileIdentifier, sizeof( checkpointFileIdentifier ) );
+            writeBinaryValue( checkpointFile, checkpointFileFormatVersion );
+            writeBinaryValue( checkpointFile, static_cast< std::uint32_t >( sizeof( TimeType ) ) );
+            writeBinaryValue( checkpointFile, static_cast< std::uint32_t >( sizeof( StateScalarType ) ) );
+
+            writeBinaryValue( checkpointFile, currentTime_ );
+            writeBinaryValue( checkpointFile, currentTimeStep_ );
+            writeBinaryMatrix( checkpointFile, currentRawState_ );
+            writeBinaryValue( checkpointFile, lastSavedTime_ );
+            writeBinaryValue( checkpointFile, static_cast< std::uint64_t >( numberOfSteps_ ) );
+            writeBinaryValue( checkpointFile, getCurrentComputationTime( ) );
+            writeBinaryValue( checkpointFile, static_cast< std::uint64_t >(
+                                  dynamicsStateDerivative_->getNumberOfFunctionEvaluations( ) +
+                                  numberOfFunctionEvaluationsOffset_ ) );
+            writeBinaryValue( checkpointFile, resultSinkFileSize );
+
+            writeBinaryValue( checkpointFile, static_cast< std::uint64_t >( rawSolution_.size( ) ) );
+            for( auto solutionIterator : rawSolution_ )
+            {
+                writeBinaryValue( checkpointFile, solutionIterator.first );
+                writeBinaryMatrix( checkpointFile, solutionIterator.second );
+            }
+
+            writeBinaryValue( checkpointFile, static_cast< std::uint64_t >( dependentVariableHistory_.size( ) ) );
+            for( auto dependentVariableIterator : dependentVariableHistory_ )
+            {
+                writeBinaryValue( checkpointFile, dependentVariableIterator.first );
+                writeBinaryMatrix( checkpointFile, dependentVariableIterator.second );
+            }
+
+            const std::uint64_t numberOfContinuousSolutionNodes =
+                    ( continuousSolution_ == nullptr ) ? 0 : continuousSolution_->getNumberOfNodes( );
+            writeBinaryValue( checkpointFile, numberOfContinuousSolutionNodes );
+            for( std::uint64_t i = 0; i < numberOfContinuousSolutionNodes; i++ )
+            {
+                writeBinaryValue( checkpointFile, continuousSolution_->getNodeTime( i ) );
+                writeBinaryMatrix( checkpointFile, continuousSolution_->getNodeState( i ) );
+            }
+
+            writeBinaryValue( checkpointFile, static_cast< std::uint64_t >( detectedEvents_.size( ) ) );
+            for( unsigned int i = 0; i < detectedEvents_.size( ); i++ )
+            {
+                const std::string eventName = detectedEvents_.at( i )->getEventName( );
+                writeBinaryValue( checkpointFile, static_cast< std::uint64_t >( eventName.size( ) ) );
+                checkpointFile.write( eventName.data( ), eventName.size( ) );
+                writeBinaryValue( checkpointFile, detectedEvents_.at( i )->getEpoch( ) );
+                writeBinaryValue( checkpointFile, static_cast< std::uint8_t >( detectedEvents_.at( i )->getIsIncreasing( ) ) );
+                writeBinaryMatrix( checkpointFile, detectedEvents_.at( i )->getState( ) );
+            }
+
+            const std::shared_ptr< StepwiseIntegratorHistory< TimeType, StateScalarType > > integratorHistory =
+                    integrator_->getHistory( );
+            writeBinaryValue( checkpointFile, static_cast< std::uint8_t >( integratorHistory != nullptr ) );
+            if( integratorHistory != nullptr )
+            {
+                writeIntegratorHistory( checkpointFile, *integratorHistory );
+            }
+
+            if( !checkpointFile.good( ) )
+            {
+                throw std::runtime_error( "Error when writing checkpoint file " + temporaryFileName );
+            }
+        }
+
+        if( std::rename( temporaryFileName.c_str( ), fileName.c_str( ) ) != 0 )
+        {
+            std::remove( fileName.c_str( ) );
+            if( std::rename( temporaryFileName.c_str( ), fileName.c_str( ) ) != 0 )
+            {
+                throw std::runtime_error( "Error when moving checkpoint file " + temporaryFileName + " to " + fileName );
+            }
+        }
+    }
+
+    //! Function to resume a step-by-step propagation from a checkpoint file
+    /*!
+     * Function to resume a step-by-step propagation from a checkpoint file written by writeCheckpoint, for a simulator
+     * created with the same bodies and propagator settings. Any propagation that is running is discarded. The resumed
+     * propagation is identical to the one that was checkpointed, including the number of function evaluations (the
+     * evaluations needed to resume the propagation are not counted).
+     * \param fileName Name of the checkpoint file
+     */
+    void resumeFromCheckpoint( const std::string& fileName )
+    {
+        std::ifstream checkpointFile( fileName, std::ios::binary | std::ios::in );
+        if( !checkpointFile.is_open( ) )
+        {
+            throw std::runtime_error( "Error when opening checkpoint file " + fileName + " for reading" );
+        }
+
+        char fileIdentifier[ sizeof( checkpointFileIdentifier ) ];
+        checkpointFile.read( fileIdentifier, sizeof( fileIdentifier ) );
+        if( !checkpointFile.good( ) ||
+                std::memcmp( fileIdentifier, checkpointFileIdentifier, sizeof( fileIdentifier ) ) != 0 )
+        {
+            throw std::runtime_error( "Error when reading checkpoint file " + fileName + ", file is not a checkpoint file" );
+        }
+        if( readBinaryValue< std::uint32_t >( checkpointFile ) != checkpointFileFormatVersion ||
+                readBinaryValue< std::uint32_t >( checkpointFile ) != sizeof( TimeType ) ||
+                readBinaryValue< std::uint32_t >( checkpointFile ) != sizeof( StateScalarType ) )
+        {
+            throw std::runtime_error( "Error when reading checkpoint file " + fileName +
+                                      ", file format or scalar types are not compatible with this simulator" );
+        }
+
+        initializePropagationModels( );
+
+        const TimeType currentTime = readBinaryValue< TimeType >( checkpointFile );
+        const TimeType currentTimeStep = readBinaryValue< TimeType >( checkpointFile );
+        const StateType currentRawState = readBinaryMatrix< StateScalarType, Eigen::Dynamic >( checkpointFile );
+        lastSavedTime_ = readBinaryValue< TimeType >( checkpointFile );
+        numberOfSteps_ = static_cast< unsigned int >( readBinaryValue< std::uint64_t >( checkpointFile ) );
+        const double computationTime = readBinaryValue< double >( checkpointFile );
+        const std::uint64_t numberOfFunctionEvaluations = readBinaryValue< std::uint64_t >( checkpointFile );
+        const std::uint64_t resultSinkFileSize = readBinaryValue< std::uint64_t >( checkpointFile );
+
+        rawSolution_.clear( );
+        const std::uint64_t numberOfSavedStates = readBinaryValue< std::uint64_t >( checkpointFile );
+        for( std::uint64_t i = 0; i < numberOfSavedStates; i++ )
+        {
+            const TimeType savedTime = readBinaryValue< TimeType >( checkpointFile );
+            rawSolution_[ savedTime ] = readBinaryMatrix< StateScalarType, Eigen::Dynamic >( checkpointFile );
+        }
+
+        dependentVariableHistory_.clear( );
+        const std::uint64_t numberOfSavedDependentVariables = readBinaryValue< std::uint64_t >( checkpointFile );
+        for( std::uint64_t i = 0; i < numberOfSavedDependentVariables; i++ )
+        {
+            const TimeType savedTime = readBinaryValue< TimeType >( checkpointFile );
+            dependentVariableHistory_[ savedTime ] = readBinaryMatrix< double, 1 >( checkpointFile );
+        }
+
+        resetContinuousSolution( currentRawState.rows( ) );
+        const std::uint64_t numberOfContinuousSolutionNodes = readBinaryValue< std::uint64_t >( checkpointFile );
+        for( std::uint64_t i = 0; i < numberOfContinuousSolutionNodes; i++ )
+        {
+            const TimeType nodeTime = readBinaryValue< TimeType >( checkpointFile );
+            const StateType nodeState = readBinaryMatrix< StateScalarType, 1 >( checkpointFile );
+            if( continuousSolution_ != nullptr )
+            {
+                continuousSolution_->addNode( nodeTime, nodeState );
+            }
+        }
+
+        const std::uint64_t numberOfDetectedEvents = readBinaryValue< std::uint64_t >( checkpointFile );
+        for( std::uint64_t i = 0; i < numberOfDetectedEvents && checkpointFile.good( ); i++ )
+        {
+            std::string eventName( readBinaryValue< std::uint64_t >( checkpointFile ), ' ' );
+            checkpointFile.read( &eventName[ 0 ], eventName.size( ) );
+            const double eventEpoch = readBinaryValue< double >( checkpointFile );
+            const bool isIncreasing = ( readBinaryValue< std::uint8_t >( checkpointFile ) != 0 );
+            detectedEvents_.push_back( std::make_shared< DetectedEvent >(
+                                           eventName, eventEpoch, isIncreasing,
+                                           readBinaryMatrix< double, 1 >( checkpointFile ) ) );
+        }
+
+        std::shared_ptr< StepwiseIntegratorHistory< TimeType, StateScalarType > > integratorHistory;
+        if( readBinaryValue< std::uint8_t >( checkpointFile ) != 0 )
+        {
+            integratorHistory = readIntegratorHistory( checkpointFile );
+        }
+
+        if( !checkpointFile.good( ) )
+        {
+            throw std::runtime_error( "Error when reading checkpoint file " + fileName + ", file is incomplete" );
+        }
+
+        if( getResultSinkSettings( ) != nullptr )
+        {
+            Eigen::VectorXd currentDependentVariables = Eigen::VectorXd::Zero( 0 );
+            stateDerivativeFunction_( currentTime, currentRawState );
+            if( dependentVariablesFunction_ != nullptr )
+            {
+                currentDependentVariables = dependentVariablesFunction_( );
+            }
+            resultWriter_ = std::make_shared< ChunkedResultWriter >(
+                        getResultSinkSettings( ),
+                        dynamicsStateDerivative_->convertToOutputSolution( currentRawState, currentTime ).rows( ),
+                        currentDependentVariables.rows( ), resultSinkFileSize );
+        }
+
+        resetIntegrator( currentTime, currentRawState, currentTimeStep );
+        if( integratorHistory != nullptr )
+        {
+            integrator_->restoreHistory( *integratorHistory, currentTime, currentRawState );
+        }
+        if( eventDetector_ != nullptr )
+        {
+            eventDetector_->resetEventValues( );
+        }
+
+        // The state derivative evaluations made to resume the propagation are not part of the checkpointed propagation
+        numberOfFunctionEvaluationsOffset_ =
+                numberOfFunctionEvaluations - dynamicsStateDerivative_->getNumberOfFunctionEvaluations( );
+
+        if( areResultsSavedAtOutputEpochs( ) )
+        {
+            // Output epochs up to and including the current time have been saved before the checkpoint was written
+            resetNextOutputEpochIndex( );
+            TimeType outputEpoch;
+            if( getOutputEpoch( nextOutputEpochIndex_, outputEpoch ) && outputEpoch == currentTime_ )
+            {
+                nextOutputEpochIndex_++;
+            }
+        }
+        environmentUpdateRequired_ = true;
+        initialClockTime_ = std::chrono::steady_clock::now( ) -
+                std::chrono::duration_cast< std::chrono::steady_clock::duration >(
+                    std::chrono::duration< double >( computationTime ) );
+        propagationIsInitialized_ = true;
+        propagationIsTerminated_ = false;
+    }
+
+    //! Function to retrieve the current time of the propagation
+    TimeType getCurrentTime( )
+    {
+        return currentTime_;
+    }
+
+    //! Function to retrieve the current (processed, e.g. Cartesian) state of the propagation
+    StateType getCurrentState( )
+    {
+        if( !propagationIsInitialized_ )
+        {
+            throw std::runtime_error( "Error when retrieving current state, propagation is not initialized" );
+        }
+        return dynamicsStateDerivative_->convertToOutputSolution( currentRawState_, currentTime_ );
+    }
+
+    //! Function to retrieve the current propagated (e.g. for Encke, the deviation from a Keplerian orbit) state
+    StateType getCurrentPropagatedState( )
+    {
+        return currentRawState_;
+    }
+
+    //! Function to retrieve the time step that will be attempted in the next integration step
+    TimeType getCurrentTimeStep( )
+    {
+        return currentTimeStep_;
+    }
+
+    bool isPropagationInitialized( )
+    {
+        return propagationIsInitialized_;
+    }
+
+    bool isPropagationTerminated( )
+    {
+        return propagationIsTerminated_;
+    }
+
+    //! Function to retrieve the results written to the result sink (nullptr if no result sink is used)
+    std::shared_ptr< ChunkedResultReader > getStreamedResults( )
+    {
+        return streamedResults_;
+    }
+
+    //! Function to retrieve the reason why the last propagation was terminated
+    std::shared_ptr< tudat::propagators::PropagationTerminationDetails > getTerminationDetails( )
+    {
+        return terminationDetails_;
+    }
+
+    //! Function to check whether the last propagation was terminated by one of its termination conditions
+    bool integrationCompletedSuccessfully( )
+    {
+        return terminationDetails_->getPropagationTerminationReason( ) == tudat::propagators::termination_condition_reached;
+    }
+
+    //! Function to retrieve the total CPU time (in seconds) of the last propagation
+    double getTotalComputationTime( )
+    {
+        return totalComputationTime_;
+    }
+
+    //! Function to retrieve the total number of state derivative function evaluations of the last propagation
+    std::uint64_t getTotalNumberOfFunctionEvaluations( )
+    {
+        return totalNumberOfFunctionEvaluations_;
+    }
+
+    //! Function to retrieve the continuous solution of the last propagation (nullptr if it is not created)
+    std::shared_ptr< ContinuousSolution< TimeType, StateScalarType > > getContinuousSolution( )
+    {
+        return continuousSolution_;
+    }
+
+    //! Function to retrieve the profiler of the last propagation (nullptr if profiling is not enabled)
+    std::shared_ptr< PropagationProfiler > getProfiler( )
+    {
+        return profiler_;
+    }
+
+    //! Function to retrieve the events located so far in the current (or last) propagation, in the order of propagation
+    std::vector< std::shared_ptr< DetectedEvent > > getDetectedEvents( )
+    {
+        return detectedEvents_;
+    }
+
+    //! Function to retrieve the epochs of the events located so far in the current (or last) propagation, per event name
+    std::map< std::string, std::vector< double > > getDetectedEventEpochs( )
+    {
+        return getEventEpochs( detectedEvents_ );
+    }
+
+    //! Function to check whether the current (or last) propagation integrates a fixed-size state (see createStepwiseIntegrator)
+    bool isIntegratedStateSizeFixed( )
+    {
+        return integrator_ != nullptr && integrator_->isStateSizeFixed( );
+    }
+
+protected:
+
+    //! Function to retrieve the models used in the propagation, and reset the termination conditions
+    void initializePropagationModels( )
+    {
+        this->resetPropagationTerminationConditions( );
+        propagationTerminationCondition_ = this->getPropagationTerminationCondition( );
+        dynamicsStateDerivative_ = this->getDynamicsStateDerivative( );
+        stateDerivativeFunction_ = this->getStateDerivativeFunction( );
+        dependentVariablesFunction_ = this->getDependentVariablesFunctions( );
+
+        eventDetector_ = nullptr;
+        if( getEventSettings( ).size( ) > 0 )
+        {
+            eventDetector_ = std::make_shared< EventDetector< StateScalarType, TimeType > >(
+                        getEventSettings( ), this->getSystemOfBodies( ), dynamicsStateDerivative_->getStateDerivativeModels( ) );
+        }
+        detectedEvents_.clear( );
+
+        // The environment only needs to be updated after each step if quantities other than the time are evaluated, or
+        // if the state derivative at the end of each step is needed to locate events within the step
+        environmentUpdateRequired_ =
+                ( dependentVariablesFunction_ != nullptr ) || ( eventDetector_ != nullptr ) ||
+                ( singleArcPropagatorSettings_->getTerminationSettings( )->terminationType_ !=
+                  tudat::propagators::time_stopping_condition &&
+                  singleArcPropagatorSettings_->getTerminationSettings( )->terminationType_ !=
+                  tudat::propagators::cpu_time_stopping_condition );
+
+        if( getProfilingSettings( ) != nullptr )
+        {
+            initializeProfiler( );
+        }
+
+        if( areResultsSavedAtOutputEpochs( ) )
+        {
+            // Sort output epochs in the direction of propagation
+            propagationDirection_ = ( singleArcPropagatorSettings_->getIntegratorSettings( )->initialTimeStep_ < 0.0 ) ?
+                        -1.0 : 1.0;
+            sortedOutputEpochs_ = extendedProcessingSettings_->getOutputEpochs( );
+            std::sort( sortedOutputEpochs_.begin( ), sortedOutputEpochs_.end( ) );
+            if( propagationDirection_ < 0.0 )
+            {
+                std::reverse( sortedOutputEpochs_.begin( ), sortedOutputEpochs_.end( ) );
+            }
+        }
+
+        dynamicsStateDerivative_->resetFunctionEvaluationCounter( );
+        numberOfFunctionEvaluationsOffset_ = 0;
+        streamedResults_ = nullptr;
+        continuousSolution_ = nullptr;
+        resultWriter_ = nullptr;
+        terminationDetails_ = std::make_shared< tudat::propagators::PropagationTerminationDetails >(
+                    tudat::propagators::propagation_never_run );
+    }
+
+    //! Function to create the integrator, starting from the given time, propagated state and time step
+    void resetIntegrator( const TimeType currentTime, const StateType& currentRawState, const TimeType currentTimeStep )
+    {
+        buffers_ = std::make_shared< StepwisePropagationBuffers< StateScalarType > >( );
+        buffers_->allocate( currentRawState.rows( ), currentRawState.cols( ) );
+        integrator_ = createStepwiseIntegrator< TimeType, StateScalarType >(
+                    stateDerivativeFunction_, currentRawState, currentTime,
+                    singleArcPropagatorSettings_->getIntegratorSettings( ), buffers_ );
+        currentTime_ = currentTime;
+        currentRawState_ = currentRawState;
+        currentTimeStep_ = currentTimeStep;
+
+        currentStateDerivative_ = stateDerivativeFunction_( currentTime_, currentRawState_ );
+    }
+
+    //! Function to create an empty continuous solution for a new propagation, if it is to be created
+    void resetContinuousSolution( const unsigned int stateSize )
+    {
+        if( getCreateContinuousSolution( ) )
+        {
+            const std::shared_ptr< tudat::propagators::DynamicsStateDerivativeModel< TimeType, StateScalarType > >
+                    dynamicsStateDerivative = dynamicsStateDerivative_;
+            continuousSolution_ = std::make_shared< ContinuousSolution< TimeType, StateScalarType > >(
+                        stateSize, [ = ]( const StateType& propagatedState, const TimeType time )
+            {
+                return dynamicsStateDerivative->convertToOutputSolution( propagatedState, time );
+            } );
+        }
+    }
+
+    //! Function to set up the integrator and result storage for a propagation from the given initial state
+    void initializePropagation( const StateType& initialStates )
+    {
+        initializePropagationModels( );
+        rawSolution_.clear( );
+        dependentVariableHistory_.clear( );
+
+        const TimeType initialTime = singleArcPropagatorSettings_->getInitialTime( );
+        resetIntegrator( initialTime, dynamicsStateDerivative_->convertFromOutputSolution( initialStates, initialTime ),
+                         singleArcPropagatorSettings_->getIntegratorSettings( )->initialTimeStep_ );
+
+        resetContinuousSolution( currentRawState_.rows( ) );
+        if( continuousSolution_ != nullptr )
+        {
+            continuousSolution_->addNode( currentTime_, currentRawState_ );
+        }
+        if( eventDetector_ != nullptr )
+        {
+            eventDetector_->resetEventValues( );
+        }
+
+        numberOfSteps_ = 0;
+        initialClockTime_ = std::chrono::steady_clock::now( );
+        propagationIsInitialized_ = true;
+        propagationIsTerminated_ = false;
+
+        if( areResultsSavedAtOutputEpochs( ) )
+        {
+            resetNextOutputEpochIndex( );
+            TimeType outputEpoch;
+            if( getOutputEpoch( nextOutputEpochIndex_, outputEpoch ) && outputEpoch == currentTime_ )
+            {
+                saveStep( currentTime_, currentRawState_ );
+                nextOutputEpochIndex_++;
+            }
+        }
+        else
+        {
+            saveStep( currentTime_, currentRawState_ );
+        }
+    }
+
+    //! Function to perform a single integration step, and process its results
+    /*!
+     * Function to perform a single integration step, and process its results. If a termination condition is met
+     * during the step, the results of the propagation are finalized.
+     * \return True if the propagation has terminated
+     */
+    bool performPropagationStep( )
+    {
+        if( !propagationIsInitialized_ )
+        {
+            throw std::runtime_error( "Error when performing propagation step, propagation is not initialized" );
+        }
+        else if( propagationIsTerminated_ )
+        {
+            return true;
+        }
+
+        try
+        {
+            const TimeType previousTime = integrator_->getCurrentTime( );
+            // The state at the start of the step is equal to the current state; it is copied into the buffer arena of the
+            // simulator (instead of retrieved from the integrator) so that no memory is allocated
+            buffers_->previousState_.noalias( ) = currentRawState_;
+            buffers_->previousStateDerivative_.noalias( ) = currentStateDerivative_;
+            const StateType& previousState = buffers_->previousState_;
+            const StateType& previousStateDerivative = buffers_->previousStateDerivative_;
+
+            const std::chrono::steady_clock::time_point stepStartTime = std::chrono::steady_clock::now( );
+            StateType& newState = buffers_->newState_;
+            integrator_->performIntegrationStep( currentTimeStep_, newState );
+            if( profiler_ != nullptr )
+            {
+                profiler_->addMeasurement( integrationStepProfileIndex_, stepStartTime, std::chrono::steady_clock::now( ) );
+            }
+            TimeType newTime = integrator_->getCurrentTime( );
+            currentTimeStep_ = integrator_->getNextStepSize( );
+            numberOfSteps_++;
+
+            if( !newState.allFinite( ) )
+            {
+                terminatePropagation( std::make_shared< tudat::propagators::PropagationTerminationDetails >(
+                                          tudat::propagators::nan_or_inf_detected_in_state ) );
+                return propagationIsTerminated_;
+            }
+
+            if( dynamicsStateDerivative_->isStateToBePostProcessed( ) )
+            {
+                dynamicsStateDerivative_->postProcessState( newState );
+                integrator_->modifyCurrentState( newState );
+            }
+
+            currentTime_ = newTime;
+            currentRawState_ = newState;
+            if( environmentUpdateRequired_ )
+            {
+                currentStateDerivative_ = stateDerivativeFunction_( newTime, newState );
+            }
+
+            const std::chrono::steady_clock::time_point terminationCheckStartTime = std::chrono::steady_clock::now( );
+            const bool isTerminationConditionMet = propagationTerminationCondition_->checkStopCondition(
+                        static_cast< double >( newTime ), getCurrentComputationTime( ) );
+            if( profiler_ != nullptr )
+            {
+                profiler_->addMeasurement( terminationProfileIndex_, terminationCheckStartTime,
+                                           std::chrono::steady_clock::now( ) );
+            }
+
+            if( isTerminationConditionMet )
+            {
+                const bool terminateExactly = propagationTerminationCondition_->getTerminateExactlyOnFinalCondition( );
+                if( terminateExactly )
+                {
+                    TimeType endTime;
+                    integrator_->computeFinalStateForExactTerminationCondition(
+                                propagationTerminationCondition_, previousTime, newTime, previousState, newState, endTime );
+                    newTime = endTime;
+                    currentTime_ = newTime;
+                    currentRawState_ = newState;
+                    currentStateDerivative_ = stateDerivativeFunction_( newTime, newState );
+                }
+
+                if( continuousSolution_ != nullptr )
+                {
+                    continuousSolution_->addNode( newTime, newState );
+                }
+                if( eventDetector_ != nullptr )
+                {
+                    locateEventsInStep( previousTime, previousState, previousStateDerivative,
+                                        newTime, newState, currentStateDerivative_ );
+                }
+                if( areResultsSavedAtOutputEpochs( ) )
+                {
+                    saveOutputEpochsInStep( previousTime, previousState, newTime, newState );
+                }
+                else
+                {
+                    saveStep( newTime, newState );
+                }
+                terminatePropagation( std::make_shared< tudat::propagators::PropagationTerminationDetails >(
+                                          tudat::propagators::termination_condition_reached, terminateExactly ) );
+            }
+            else
+            {
+                if( continuousSolution_ != nullptr )
+                {
+                    continuousSolution_->addNode( newTime, newState );
+                }
+                if( eventDetector_ != nullptr )
+                {
+                    locateEventsInStep( previousTime, previousState, previousStateDerivative,
+                                        newTime, newState, currentStateDerivative_ );
+                }
+                if( areResultsSavedAtOutputEpochs( ) )
+                {
+                    saveOutputEpochsInStep( previousTime, previousState, newTime, newState );
+                }
+                else if( isStepToBeSaved( newTime ) )
+                {
+                    saveStep( newTime, newState );
+                }
+            }
+        }
+        catch( const std::exception& caughtException )
+        {
+            std::cerr << "Error, propagation terminated at t=" +
+                         std::to_string( static_cast< double >( integrator_->getCurrentTime( ) ) ) +
+                         ", returning propagation data up to current time. Caught the following exception: " +
+                         caughtException.what( ) << std::endl;
+            terminatePropagation( std::make_shared< tudat::propagators::PropagationTerminationDetails >(
+                                      tudat::propagators::runtime_error_caught_in_propagation ) );
+        }
+
+        return propagationIsTerminated_;
+    }
+
+    //! Function to determine whether the results at the current step are to be saved, according to the save frequency
+    bool isStepToBeSaved( const TimeType currentTime )
+    {
+        const std::shared_ptr< tudat::propagators::SingleArcPropagatorProcessingSettings > outputSettings =
+                singleArcPropagatorSettings_->getOutputSettings( );
+        const int saveFrequencyInSteps = outputSettings->getResultsSaveFrequencyInSteps( );
+        const double saveFrequencyInSeconds = outputSettings->getResultsSaveFrequencyInSeconds( );
+
+        return ( saveFrequencyInSteps > 0 && numberOfSteps_ % saveFrequencyInSteps == 0 ) ||
+                ( !std::isnan( saveFrequencyInSeconds ) &&
+                  std::fabs( static_cast< double >( currentTime - lastSavedTime_ ) ) >= saveFrequencyInSeconds );
+    }
+
+    //! Function to retrieve the output epoch with the given index (in the order of propagation)
+    /*!
+     * Function to retrieve the output epoch with the given index (in the order of propagation), when the results are
+     * saved at output epochs
+     * \param outputEpochIndex Index of the output epoch
+     * \param outputEpoch Output epoch (returned by reference)
+     * \return False if no output epoch with this index exists
+     */
+    bool getOutputEpoch( const unsigned int outputEpochIndex, TimeType& outputEpoch )
+    {
+        const double outputTimeInterval = extendedProcessingSettings_->getOutputTimeInterval( );
+        if( !std::isnan( outputTimeInterval ) )
+        {
+            outputEpoch = singleArcPropagatorSettings_->getInitialTime( ) +
+                    static_cast< TimeType >( outputEpochIndex ) * static_cast< TimeType >( outputTimeInterval * propagationDirection_ );
+            return true;
+        }
+        else if( outputEpochIndex < sortedOutputEpochs_.size( ) )
+        {
+            outputEpoch = static_cast< TimeType >( sortedOutputEpochs_.at( outputEpochIndex ) );
+            return true;
+        }
+        else
+        {
+            return false;
+        }
+    }
+
+    //! Function to set the index of the next output epoch to the first output epoch that is not before the current time
+    void resetNextOutputEpochIndex( )
+    {
+        nextOutputEpochIndex_ = 0;
+        TimeType outputEpoch;
+        while( getOutputEpoch( nextOutputEpochIndex_, outputEpoch ) &&
+               static_cast< double >( outputEpoch - currentTime_ ) * propagationDirection_ < 0.0 )
+        {
+            nextOutputEpochIndex_++;
+        }
+    }
+
+    //! Function to save the results at all output epochs within an integration step, integrating within the step
+    /*!
+     * Function to save the results at all output epochs within an integration step (excluding its start, including its
+     * end). The state at an output epoch inside the step is integrated from the start of the step, with a single step
+     * of the same integrator (see StepwiseIntegrator::integrateWithinStep), so that its error is that of the integrator.
+     * These integrations evaluate the state derivative, and are included in the number of function evaluations. The
+     * environment is updated to each output epoch before its dependent variables are computed, and is reset to the
+     * end of the step afterwards.
+     * \param previousTime Time at the start of the step
+     * \param previousState Propagated state at the start of the step
+     * \param newTime Time at the end of the step
+     * \param newState Propagated state at the end of the step
+     */
+    void saveOutputEpochsInStep( const TimeType previousTime,
+                                 const StateType& previousState,
+                                 const TimeType newTime,
+                                 const StateType& newState )
+    {
+        bool isEnvironmentUpdatedToOutputEpoch = false;
+        TimeType outputEpoch;
+        StateType& outputState = buffers_->interpolatedState_;
+        while( getOutputEpoch( nextOutputEpochIndex_, outputEpoch ) &&
+               static_cast< double >( newTime - outputEpoch ) * propagationDirection_ >= 0.0 )
+        {
+            if( outputEpoch == newTime )
+            {
+                if( isEnvironmentUpdatedToOutputEpoch )
+                {
+                    stateDerivativeFunction_( newTime, newState );
+                    isEnvironmentUpdatedToOutputEpoch = false;
+                }
+                saveStep( outputEpoch, newState );
+                nextOutputEpochIndex_++;
+                continue;
+            }
+
+            integrator_->integrateWithinStep( previousTime, previousState, outputEpoch, outputState );
+            stateDerivativeFunction_( outputEpoch, outputState );
+            isEnvironmentUpdatedToOutputEpoch = true;
+
+            saveStep( outputEpoch, outputState );
+            nextOutputEpochIndex_++;
+        }
+
+        if( isEnvironmentUpdatedToOutputEpoch )
+        {
+            stateDerivativeFunction_( newTime, newState );
+        }
+    }
+
+    //! Function to locate the events within an integration step
+    /*!
+     * Function to locate the events within an integration step. The events are first located using the cubic Hermite
+     * polynomial through the states and state derivatives at both ends of the step, and their epochs are then refined
+     * using the state integrated from the start of the step (see EventDetector), which is also the state stored with
+     * each event. The environment is reset to the end of the step afterwards.
+     * \param previousTime Time at the start of the step
+     * \param previousState Propagated state at the start of the step
+     * \param previousStateDerivative Propagated state derivative at the start of the step
+     * \param newTime Time at the end of the step
+     * \param newState Propagated state at the end of the step
+     * \param newStateDerivative Propagated state derivative at the end of the step
+     */
+    void locateEventsInStep( const TimeType previousTime,
+                             const StateType& previousState,
+                             const StateType& previousStateDerivative,
+                             const TimeType newTime,
+                             const StateType& newState,
+                             const StateType& newStateDerivative )
+    {
+        bool isEnvironmentUpdatedToEventEpoch = false;
+        StateType& stateInStep = buffers_->interpolatedState_;
+        const std::function< void( const double ) > updateEnvironmentToInterpolatedState = [ & ]( const double time )
+        {
+            evaluateCubicHermitePolynomial( previousTime, newTime, previousState, previousStateDerivative,
+                                            newState, newStateDerivative, static_cast< TimeType >( time ), stateInStep );
+            stateDerivativeFunction_( static_cast< TimeType >( time ), stateInStep );
+            isEnvironmentUpdatedToEventEpoch = true;
+        };
+        const std::function< void( const double ) > updateEnvironmentToIntegratedState = [ & ]( const double time )
+        {
+            integrator_->integrateWithinStep( previousTime, previousState, static_cast< TimeType >( time ), stateInStep );
+            stateDerivativeFunction_( static_cast< TimeType >( time ), stateInStep );
+            isEnvironmentUpdatedToEventEpoch = true;
+        };
+        const std::function< Eigen::VectorXd( const double ) > getOutputState = [ & ]( const double time )
+        {
+            integrator_->integrateWithinStep( previousTime, previousState, static_cast< TimeType >( time ), stateInStep );
+            return Eigen::VectorXd( dynamicsStateDerivative_->convertToOutputSolution(
+                                        stateInStep, static_cast< TimeType >( time ) ).col( 0 ).template cast< double >( ) );
+        };
+
+        const std::vector< std::shared_ptr< DetectedEvent > > eventsInStep = eventDetector_->locateEventsInStep(
+                    previousTime, newTime, updateEnvironmentToInterpolatedState, updateEnvironmentToIntegratedState,
+                    getOutputState );
+        detectedEvents_.insert( detectedEvents_.end( ), eventsInStep.begin( ), eventsInStep.end( ) );
+
+        if( isEnvironmentUpdatedToEventEpoch )
+        {
+            stateDerivativeFunction_( newTime, newState );
+        }
+    }
+
+    //! Function to save the results at the current step, either in memory or to the result sink
+    void saveStep( const TimeType currentTime, const StateType& currentRawState )
+    {
+        const std::chrono::steady_clock::time_point saveStartTime = std::chrono::steady_clock::now( );
+        Eigen::VectorXd currentDependentVariables = Eigen::VectorXd::Zero( 0 );
+        if( dependentVariablesFunction_ != nullptr )
+        {
+            currentDependentVariables = dependentVariablesFunction_( );
+            if( profiler_ != nullptr )
+            {
+                profiler_->addMeasurement( dependentVariablesProfileIndex_, saveStartTime, std::chrono::steady_clock::now( ) );
+            }
+        }
+
+        if( getResultSinkSettings( ) != nullptr )
+        {
+            const Eigen::VectorXd currentOutputState = dynamicsStateDerivative_->convertToOutputSolution(
+                        currentRawState, currentTime ).col( 0 ).template cast< double >( );
+            if( resultWriter_ == nullptr )
+            {
+                resultWriter_ = std::make_shared< ChunkedResultWriter >(
+                            getResultSinkSettings( ), currentOutputState.rows( ), currentDependentVariables.rows( ) );
+            }
+            resultWriter_->addStep( static_cast< double >( currentTime ), currentOutputState, currentDependentVariables );
+        }
+        else
+        {
+            rawSolution_[ currentTime ] = currentRawState;
+            if( dependentVariablesFunction_ != nullptr )
+            {
+                dependentVariableHistory_[ currentTime ] = currentDependentVariables;
+            }
+        }
+        lastSavedTime_ = currentTime;
+
+        if( profiler_ != nullptr )
+        {
+            profiler_->addMeasurement( saveStepProfileIndex_, saveStartTime, std::chrono::steady_clock::now( ) );
+        }
+    }
+
+    //! Function to write the history of the integrator to a checkpoint file
+    void writeIntegratorHistory( std::ofstream& checkpointFile,
+                                 const StepwiseIntegratorHistory< TimeType, StateScalarType >& integratorHistory )
+    {
+        writeBinaryValue( checkpointFile, integratorHistory.initialTime_ );
+        writeBinaryMatrix( checkpointFile, integratorHistory.initialState_ );
+
+        writeBinaryValue( checkpointFile, static_cast< std::uint64_t >( integratorHistory.stepSizes_.size( ) ) );
+        for( unsigned int i = 0; i < integratorHistory.stepSizes_.size( ); i++ )
+        {
+            writeBinaryValue( checkpointFile, integratorHistory.stepSizes_.at( i ) );
+        }
+
+        writeBinaryValue( checkpointFile, static_cast< std::uint64_t >( integratorHistory.modifiedStates_.size( ) ) );
+        for( unsigned int i = 0; i < integratorHistory.modifiedStates_.size( ); i++ )
+        {
+            writeBinaryValue( checkpointFile, integratorHistory.modifiedStates_.at( i ).first );
+            writeBinaryMatrix( checkpointFile, integratorHistory.modifiedStates_.at( i ).second );
+        }
+
+        writeBinaryValue( checkpointFile, static_cast< std::uint64_t >( integratorHistory.stateDerivatives_.size( ) ) );
+        for( unsigned int i = 0; i < integratorHistory.stateDerivatives_.size( ); i++ )
+        {
+            writeBinaryValue( checkpointFile, integratorHistory.stateDerivatives_.at( i ).first );
+            writeBinaryMatrix( checkpointFile, integratorHistory.stateDerivatives_.at( i ).second );
+        }
+    }
+
+    //! Function to read the history of the integrator written by writeIntegratorHistory from a checkpoint file
+    std::shared_ptr< StepwiseIntegratorHistory< TimeType, StateScalarType > > readIntegratorHistory(
+            std::ifstream& checkpointFile )
+    {
+        std::shared_ptr< StepwiseIntegratorHistory< TimeType, StateScalarType > > integratorHistory =
+                std::make_shared< StepwiseIntegratorHistory< TimeType, StateScalarType > >( );
+        integratorHistory->initialTime_ = readBinaryValue< TimeType >( checkpointFile );
+        integratorHistory->initialState_ = readBinaryMatrix< StateScalarType, Eigen::Dynamic >( checkpointFile );
+
+        const std::uint64_t numberOfSteps = readBinaryValue< std::uint64_t >( checkpointFile );
+        for( std::uint64_t i = 0; i < numberOfSteps && checkpointFile.good( ); i++ )
+        {
+            integratorHistory->stepSizes_.push_back( readBinaryValue< TimeType >( checkpointFile ) );
+        }
+
+        const std::uint64_t numberOfModifiedStates = readBinaryValue< std::uint64_t >( checkpointFile );
+        for( std::uint64_t i = 0; i < numberOfModifiedStates && checkpointFile.good( ); i++ )
+        {
+            const std::uint64_t stepIndex = readBinaryValue< std::uint64_t >( checkpointFile );
+            integratorHistory->modifiedStates_.push_back(
+                        std::make_pair( stepIndex, readBinaryMatrix< StateScalarType, Eigen::Dynamic >( checkpointFile ) ) );
+        }
+
+        const std::uint64_t numberOfStateDerivatives = readBinaryValue< std::uint64_t >( checkpointFile );
+        for( std::uint64_t i = 0; i < numberOfStateDerivatives && checkpointFile.good( ); i++ )
+        {
+            const TimeType evaluationTime = readBinaryValue< TimeType >( checkpointFile );
+            integratorHistory->stateDerivatives_.push_back(
+                        std::make_pair( evaluationTime, readBinaryMatrix< StateScalarType, Eigen::Dynamic >( checkpointFile ) ) );
+        }
+        return integratorHistory;
+    }
+
+    //! Function to finalize the propagation, and make the results available
+    void terminatePropagation(
+            const std::shared_ptr< tudat::propagators::PropagationTerminationDetails > terminationDetails )
+    {
+        terminationDetails_ = terminationDetails;
+        propagationIsTerminated_ = true;
+        totalComputationTime_ = getCurrentComputationTime( );
+        totalNumberOfFunctionEvaluations_ =
+                dynamicsStateDerivative_->getNumberOfFunctionEvaluations( ) + numberOfFunctionEvaluationsOffset_;
+
+        if( resultWriter_ != nullptr )
+        {
+            resultWriter_->close( );
+            resultWriter_ = nullptr;
+            streamedResults_ = std::make_shared< ChunkedResultReader >( getResultSinkSettings( )->getFileName( ) );
+        }
+        else
+        {
+            this->manuallySetAndProcessRawNumericalEquationsOfMotionSolution(
+                        rawSolution_, dependentVariableHistory_, true );
+            rawSolution_.clear( );
+            dependentVariableHistory_.clear( );
+        }
+    }
+
+    //! Function to retrieve the CPU time (in seconds) since the start of the propagation
+    double getCurrentComputationTime( )
+    {
+        return static_cast< double >( std::chrono::duration_cast< std::chrono::nanoseconds >(
+                                          std::chrono::steady_clock::now( ) - initialClockTime_ ).count( ) ) * 1.0E-9;
+    }
+
+    std::shared_ptr< ResultSinkSettings > getResultSinkSettings( )
+    {
+        return ( extendedProcessingSettings_ == nullptr ) ? nullptr : extendedProcessingSettings_->getResultSinkSettings( );
+    }
+
+    std::shared_ptr< ProfilingSettings > getProfilingSettings( )
+    {
+        return ( extendedProcessingSettings_ == nullptr ) ? nullptr : extendedProcessingSettings_->getProfilingSettings( );
+    }
+
+    bool getCreateContinuousSolution( )
+    {
+        return ( extendedProcessingSettings_ == nullptr ) ? false : extendedProcessingSettings_->getCreateContinuousSolution( );
+    }
+
+    bool areResultsSavedAtOutputEpochs( )
+    {
+        return ( extendedProcessingSettings_ == nullptr ) ? false : extendedProcessingSettings_->areResultsSavedAtOutputEpochs( );
+    }
+
+    std::vector< std::shared_ptr< EventSettings > > getEventSettings( )
+    {
+        return ( extendedProcessingSettings_ == nullptr ) ? std::vector< std::shared_ptr< EventSettings > >( ) :
+                                                            extendedProcessingSettings_->getEventSettings( );
+    }
+
+    //! Function to create the profiler for a new propagation, and wrap the functions that are to be profiled
+    /*!
+     * Function to create the profiler for a new propagation, and wrap the functions that are to be profiled. The state
+     * derivative function used by the integrator is replaced by one that times each evaluation, and the dependent
+     * variable function by one that evaluates (and times) each dependent variable in turn, so that these quantities are
+     * timed in the evaluations performed by the propagation itself. Since Tudat evaluates the acceleration models inside
+     * its state derivative model, each acceleration model is timed by evaluating it once more (at the same time, and with
+     * the environment updated by the state derivative evaluation) after each state derivative evaluation. This
+     * re-evaluation roughly doubles the cost of the acceleration models while profiling, but does not modify the
+     * propagation results. The remainder of the state derivative evaluation time, which is dominated by the environment
+     * update, is recorded as the "Environment update" quantity. Custom (Python) acceleration models and dependent
+     * variables are given the "custom_callback" category, so that their contribution can be identified.
+     */
+    void initializeProfiler( )
+    {
+        profiler_ = std::make_shared< PropagationProfiler >( getProfilingSettings( ) );
+        integrationStepProfileIndex_ = profiler_->addQuantity( "Integration step", "propagation" );
+        stateDerivativeProfileIndex_ = profiler_->addQuantity( "State derivative", "state_derivative" );
+        terminationProfileIndex_ = profiler_->addQuantity( "Termination conditions", "termination" );
+        saveStepProfileIndex_ = profiler_->addQuantity( "Result processing", "propagation" );
+        dependentVariablesProfileIndex_ = profiler_->addQuantity( "Dependent variables", "dependent_variable" );
+        const unsigned int environmentUpdateProfileIndex = profiler_->addQuantity( "Environment update", "environment" );
+
+        // Retrieve the translational acceleration models, with a profiled quantity for each of them
+        std::vector< std::pair< unsigned int, tudat::basic_astrodynamics::AccelerationModel3dPointer > > profiledAccelerationModels;
+        std::map< tudat::propagators::IntegratedStateType,
+                std::vector< std::shared_ptr< tudat::propagators::SingleStateTypeDerivative< StateScalarType, TimeType > > > >
+                stateDerivativeModels = dynamicsStateDerivative_->getStateDerivativeModels( );
+        if( stateDerivativeModels.count( tudat::propagators::translational_state ) > 0 )
+        {
+            for( auto stateDerivativeModel: stateDerivativeModels.at( tudat::propagators::translational_state ) )
+            {
+                std::shared_ptr< tudat::propagators::NBodyStateDerivative< StateScalarType, TimeType > > translationalStateDerivative =
+                        std::dynamic_pointer_cast< tudat::propagators::NBodyStateDerivative< StateScalarType, TimeType > >(
+                            stateDerivativeModel );
+                if( translationalStateDerivative == nullptr )
+                {
+                    continue;
+                }
+
+                for( auto undergoingIterator: translationalStateDerivative->getAccelerationsMap( ) )
+                {
+                    for( auto exertingIterator: undergoingIterator.second )
+                    {
+                        for( auto accelerationModel: exertingIterator.second )
+                        {
+                            const tudat::basic_astrodynamics::AvailableAcceleration accelerationType =
+                                    tudat::basic_astrodynamics::getAccelerationModelType( accelerationModel );
+                            profiledAccelerationModels.push_back(
+                                        std::make_pair( profiler_->addQuantity(
+                                                            tudat::basic_astrodynamics::getAccelerationModelName( accelerationType ) +
+                                                            " of " + exertingIterator.first + " on " + undergoingIterator.first,
+                                                            ( accelerationType == tudat::basic_astrodynamics::custom_acceleration ) ?
+                                                                "custom_callback" : "acceleration" ),
+                                                        accelerationModel ) );
+                        }
+                    }
+                }
+            }
+        }
+
+        const std::shared_ptr< PropagationProfiler > profiler = profiler_;
+        if( dependentVariablesFunction_ != nullptr )
+        {
+            std::vector< std::pair< unsigned int, std::function< Eigen::VectorXd( ) > > > profiledDependentVariableFunctions;
+            int totalDependentVariableSize = 0;
+            const std::vector< std::shared_ptr< tudat::propagators::SingleDependentVariableSaveSettings > > dependentVariables =
+                    singleArcPropagatorSettings_->getDependentVariablesToSave( );
+            for( unsigned int i = 0; i < dependentVariables.size( ); i++ )
+            {
+                std::pair< std::function< Eigen::VectorXd( ) >, int > dependentVariableFunction =
+                        tudat::propagators::createDependentVariableListFunction< TimeType, StateScalarType >(
+                            { dependentVariables.at( i ) }, this->getSystemOfBodies( ),
+                            dynamicsStateDerivative_->getStateDerivativeModels( ) );
+                profiledDependentVariableFunctions.push_back(
+                            std::make_pair( profiler_->addQuantity(
+                                                tudat::propagators::getDependentVariableId( dependentVariables.at( i ) ),
+                                                ( dependentVariables.at( i )->dependentVariableType_ ==
+                                                  tudat::propagators::custom_dependent_variable ) ?
+                                                    "custom_callback" : "dependent_variable" ),
+                                            dependentVariableFunction.first ) );
+                totalDependentVariableSize += dependentVariableFunction.second;
+            }
+
+            // Concatenate the single dependent variables in the same order as the dependent variable function of Tudat
+            dependentVariablesFunction_ = [ = ]( )
+            {
+                Eigen::VectorXd dependentVariables( totalDependentVariableSize );
+                int currentIndex = 0;
+                for( unsigned int i = 0; i < profiledDependentVariableFunctions.size( ); i++ )
+                {
+                    const std::chrono::steady_clock::time_point startTime = std::chrono::steady_clock::now( );
+                    const Eigen::VectorXd singleDependentVariable = profiledDependentVariableFunctions.at( i ).second( );
+                    profiler->addMeasurement( profiledDependentVariableFunctions.at( i ).first, startTime,
+                                              std::chrono::steady_clock::now( ) );
+                    dependentVariables.segment( currentIndex, singleDependentVariable.rows( ) ) = singleDependentVariable;
+                    currentIndex += static_cast< int >( singleDependentVariable.rows( ) );
+                }
+                return dependentVariables;
+            };
+        }
+
+        const unsigned int stateDerivativeProfileIndex = stateDerivativeProfileIndex_;
+        const std::function< StateType( const TimeType, const StateType& ) > stateDerivativeFunction = stateDerivativeFunction_;
+        stateDerivativeFunction_ = [ = ]( const TimeType time, const StateType& state )
+        {
+            const std::chrono::steady_clock::time_point startTime = std::chrono::steady_clock::now( );
+            StateType stateDerivative = stateDerivativeFunction( time, state );
+            const std::chrono::steady_clock::time_point endTime = std::chrono::steady_clock::now( );
+            profiler->addMeasurement( stateDerivativeProfileIndex, startTime, endTime );
+
+            // Re-evaluate each acceleration model in the environment set by the state derivative evaluation
+            double totalAccelerationTime = 0.0;
+            for( unsigned int i = 0; i < profiledAccelerationModels.size( ); i++ )
+            {
+                const std::chrono::steady_clock::time_point accelerationStartTime = std::chrono::steady_clock::now( );
+                profiledAccelerationModels.at( i ).second->resetCurrentTime( );
+                profiledAccelerationModels.at( i ).second->updateMembers( static_cast< double >( time ) );
+                profiledAccelerationModels.at( i ).second->getAcceleration( );
+                const double accelerationTime = std::chrono::duration< double >(
+                            std::chrono::steady_clock::now( ) - accelerationStartTime ).count( );
+                profiler->addMeasurement( profiledAccelerationModels.at( i ).first, accelerationStartTime, accelerationTime );
+                totalAccelerationTime += accelerationTime;
+            }
+            profiler->addMeasurement( environmentUpdateProfileIndex, startTime, std::max(
+                                          std::chrono::duration< double >( endTime - startTime ).count( ) -
+                                          totalAccelerationTime, 0.0 ) );
+            return stateDerivative;
+        };
+    }
+
+    std::shared_ptr< tudat::propagators::SingleArcPropagatorSettings< StateScalarType, TimeType > > singleArcPropagatorSettings_;
+
+    std::shared_ptr< ExtendedSingleArcPropagatorProcessingSettings > extendedProcessingSettings_;
+
+    std::shared_ptr< tudat::propagators::PropagationTerminationCondition > propagationTerminationCondition_;
+
+    std::shared_ptr< tudat::propagators::DynamicsStateDerivativeModel< TimeType, StateScalarType > > dynamicsStateDerivative_;
+
+    std::function< StateType( const TimeType, const StateType& ) > stateDerivativeFunction_;
+
+    std::function< Eigen::VectorXd( ) > dependentVariablesFunction_;
+
+    bool environmentUpdateRequired_;
+
+    std::shared_ptr< IntegratorType > integrator_;
+
+    TimeType currentTimeStep_;
+
+    unsigned int numberOfSteps_;
+
+    TimeType lastSavedTime_;
+
+    TimeType currentTime_;
+
+    StateType currentRawState_;
+
+    //! Propagated state derivative at the current time (only updated when the environment is updated after each step)
+    StateType currentStateDerivative_;
+
+    //! Arena of propagated-state buffers reused in each step, allocated when the integrator is created
+    std::shared_ptr< StepwisePropagationBuffers< StateScalarType > > buffers_;
+
+    std::chrono::steady_clock::time_point initialClockTime_;
+
+    bool propagationIsInitialized_;
+
+    bool propagationIsTerminated_;
+
+    std::shared_ptr< tudat::propagators::PropagationTerminationDetails > terminationDetails_;
+
+    double totalComputationTime_ = 0.0;
+
+    std::uint64_t totalNumberOfFunctionEvaluations_ = 0;
+
+    //! Number of function evaluations performed before the propagation was resumed from a checkpoint
+    std::uint64_t numberOfFunctionEvaluationsOffset_ = 0;
+
+    //! Raw (propagated) states at the saved steps, when no result sink is used
+    std::map< TimeType, StateType > rawSolution_;
+
+    //! Dependent variables at the saved steps, when no result sink is used
+    std::map< TimeType, Eigen::VectorXd > dependentVariableHistory_;
+
+    std::shared_ptr< ChunkedResultWriter > resultWriter_;
+
+    std::shared_ptr< ChunkedResultReader > streamedResults_;
+
+    //! Sign of the time step (1 for forward, -1 for backward propagation), used when saving results at output epochs
+    double propagationDirection_ = 1.0;
+
+    //! Output epochs, sorted in the direction of propagation
+    std::vector< double > sortedOutputEpochs_;
+
+    //! Index of the first output epoch at which the results have not yet been saved
+    unsigned int nextOutputEpochIndex_ = 0;
+
+    //! Continuous solution of the current propagation (nullptr if it is not created)
+    std::shared_ptr< ContinuousSolution< TimeType, StateScalarType > > continuousSolution_;
+
+    //! Profiler of the current propagation (nullptr if profiling is not enabled)
+    std::shared_ptr< PropagationProfiler > profiler_;
+
+    //! Detector of the events of the current propagation (nullptr if no events are defined)
+    std::shared_ptr< EventDetector< StateScalarType, TimeType > > eventDetector_;
+
+    //! Events located so far in the current propagation
+    std::vector< std::shared_ptr< DetectedEvent > > detectedEvents_;
+
+    unsigned int integrationStepProfileIndex_;
+
+    unsigned int stateDerivativeProfileIndex_;
+
+    unsigned int terminationProfileIndex_;
+
+    unsigned int saveStepProfileIndex_;
+
+    unsigned int dependentVariablesProfileIndex_;
+};
+
+//! Function to retrieve the reason why the last propagation of a single-arc dynamics simulator was terminated
+/*!
+ * Function to retrieve the reason why the last propagation of a single-arc dynamics simulator was terminated. For a
+ * SingleArcStepwiseDynamicsSimulator, the termination details are stored by the simulator instead of the results.
+ * \param dynamicsSimulator Dynamics simulator for which the termination details are to be retrieved
+ * \return Termination details of the last propagation
+ */
+template< typename StateScalarType = double, typename TimeType = double >
+std::shared_ptr< tudat::propagators::PropagationTerminationDetails > getPropagationTerminationDetails(
+        const std::shared_ptr< tudat::propagators::SingleArcDynamicsSimulator< StateScalarType, TimeType > > dynamicsSimulator )
+{
+    std::shared_ptr< SingleArcStepwiseDynamicsSimulator< StateScalarType, TimeType > > stepwiseDynamicsSimulator =
+            std::dynamic_pointer_cast< SingleArcStepwiseDynamicsSimulator< StateScalarType, TimeType > >( dynamicsSimulator );
+    if( stepwiseDynamicsSimulator != nullptr )
+    {
+        return stepwiseDynamicsSimulator->getTerminationDetails( );
+    }
+    else
+    {
+        return dynamicsSimulator->getPropagationTerminationReason( );
+    }
+}
+
+//! Function to check whether any output is printed by Tudat before, during or after a propagation
+inline bool isPropagationOutputPrinted( const std::shared_ptr< tudat::propagators::PropagationPrintSettings > printSettings )
+{
+    return printSettings != nullptr && (
+                printSettings->getPrintDependentVariableData( ) || printSettings->getPrintPropagatedStateData( ) ||
+                printSettings->getPrintProcessedStateData( ) || printSettings->getPrintNumberOfFunctionEvaluations( ) ||
+                printSettings->getPrintPropagationTime( ) || printSettings->getPrintTerminationReason( ) ||
+                printSettings->getPrintInitialAndFinalConditions( ) ||
+                printSettings->getResultsPrintFrequencyInSeconds( ) > 0.0 ||
+                printSettings->getResultsPrintFrequencyInSteps( ) > 0 ||
+                printSettings->getPrintDependentVariableDuringPropagation( ) );
+}
+
+//! Function to check whether a single-arc propagation is integrated with fixed-size types by the stepwise simulator
+/*!
+ * Function to check whether a single-arc propagation is integrated with fixed-size Eigen types by the stepwise simulator
+ * (see createStepwiseIntegrator), in which case createDynamicsSimulator selects the stepwise simulator by default: the
+ * propagated state is the Cartesian state of a single body, and a Runge-Kutta integrator is used. Propagations for which
+ * Tudat prints output are excluded, since the stepwise simulator does not print.
+ */
+template< typename StateScalarType = double, typename TimeType = double >
+bool isFixedSizeStepwisePropagation(
+        const std::shared_ptr< tudat::propagators::SingleArcPropagatorSettings< StateScalarType, TimeType > > propagatorSettings )
+{
+    return propagatorSettings->getInitialStates( ).rows( ) == fixedSizeIntegratedStateSize &&
+            propagatorSettings->getInitialStates( ).cols( ) == 1 &&
+            propagatorSettings->getIntegratorSettings( ) != nullptr &&
+            isFixedSizeIntegrationSupported( propagatorSettings->getIntegratorSettings( ) ) &&
+            !isPropagationOutputPrinted( propagatorSettings->getPrintSettings( ) );
+}
+
+//! Function to create a dynamics simulator, using the tudatpy stepwise simulator if tudatpy-specific options are used
+/*!
+ * Function to create a dynamics simulator. If single-arc propagator settings are provided with processing settings of
+ * type ExtendedSingleArcPropagatorProcessingSettings, or for which the state is integrated with fixed-size types (see
+ * isFixedSizeStepwisePropagation), a SingleArcStepwiseDynamicsSimulator is created; otherwise, the dynamics simulator is
+ * created by Tudat.
+ * \param bodies System of bodies used in the propagation
+ * \param propagatorSettings Settings for the propagation
+ * \param simulateDynamicsOnCreation Boolean denoting whether the equations of motion are to be integrated on creation
+ * \return Dynamics simulator
+ */
+template< typename StateScalarType = double, typename TimeType = double >
+std::shared_ptr< tudat::propagators::DynamicsSimulator< StateScalarType, TimeType > > createDynamicsSimulator(
+        const tudat::simulation_setup::SystemOfBodies& bodies,
+        const std::shared_ptr< tudat::propagators::PropagatorSettings< StateScalarType > > propagatorSettings,
+        const bool simulateDynamicsOnCreation = true )
+{
+    std::shared_ptr< tudat::propagators::SingleArcPropagatorSettings< StateScalarType, TimeType > > singleArcPropagatorSettings =
+            std::dynamic_pointer_cast< tudat::propagators::SingleArcPropagatorSettings< StateScalarType, TimeType > >(
+                propagatorSettings );
+    if( singleArcPropagatorSettings != nullptr &&
+            ( std::dynamic_pointer_cast< ExtendedSingleArcPropagatorProcessingSettings >(
+                  singleArcPropagatorSettings->getOutputSettings( ) ) != nullptr ||
+              isFixedSizeStepwisePropagation( singleArcPropagatorSettings ) ) )
+    {
+        return std::make_shared< SingleArcStepwiseDynamicsSimulator< StateScalarType, TimeType > >(
+                    bodies, singleArcPropagatorSettings, simulateDynamicsOnCreation );
+    }
+    else
+    {
+        return tudat::simulation_setup::createDynamicsSimulator< StateScalarType, TimeType >(
+                    bodies, propagatorSettings, simulateDynamicsOnCreation );
+    }
+}
+
+} // namespace tudatpy
+
+#endif // TUDATPY_STEPWISE_DYNAMICS_SIMULATOR_H
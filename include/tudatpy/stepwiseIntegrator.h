@@ -0,0 +1,619 @@
+/*    Copyright (c) 2010-2022, Delft University of Technology
+ *    All rights reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ */
+
+#ifndef TUDATPY_STEPWISE_INTEGRATOR_H
+#define TUDATPY_STEPWISE_INTEGRATOR_H
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <Eigen/Core>
+
+#include "tudat/math/integrators/createNumericalIntegrator.h"
+#include "tudat/simulation/propagation_setup.h"
+
+namespace tudatpy
+{
+
+//! Size of the propagated state for which the stepwise simulator integrates with fixed-size Eigen types
+/*!
+ * Size of the propagated state for which the stepwise simulator integrates with fixed-size Eigen types: the Cartesian
+ * state of a single body, which is by far the most common propagation.
+ */
+static const int fixedSizeIntegratedStateSize = 6;
+
+//! Arena of the propagated-state buffers used in each step of the stepwise dynamics simulator and its integrator
+/*!
+ * Arena of the (dynamic-size) propagated-state buffers used in each step of the stepwise dynamics simulator and its
+ * integrator. The buffers are allocated once, with the size of the propagated state, when the integrator is created,
+ * and are reused (assigned in place) in all steps, so that the propagation loop of tudatpy does not allocate. The scratch
+ * memory of the state derivative, acceleration and variational equation models is held by these models in Tudat, and
+ * reused in each evaluation; the state derivative is, however, returned by value, so that each evaluation still
+ * allocates its result.
+ */
+template< typename StateScalarType = double >
+struct StepwisePropagationBuffers
+{
+    typedef Eigen::Matrix< StateScalarType, Eigen::Dynamic, Eigen::Dynamic > StateType;
+
+    //! Function to allocate all buffers for a propagated state of the given size
+    void allocate( const Eigen::Index rows, const Eigen::Index cols )
+    {
+        propagatedState_.resize( rows, cols );
+        previousState_.resize( rows, cols );
+        previousStateDerivative_.resize( rows, cols );
+        newState_.resize( rows, cols );
+        interpolatedState_.resize( rows, cols );
+    }
+
+    //! Propagated state passed to the state derivative model, converted from a fixed-size integrated state
+    StateType propagatedState_;
+
+    //! Propagated state at the start of the current step
+    StateType previousState_;
+
+    //! Propagated state derivative at the start of the current step
+    StateType previousStateDerivative_;
+
+    //! Propagated state at the end of the current step
+    StateType newState_;
+
+    //! Propagated state interpolated (or integrated) within the current step, for output epochs and events
+    StateType interpolatedState_;
+};
+
+//! History of the operations of a stepwise integrator, from which its internal state can be restored
+/*!
+ * History of the operations of a stepwise integrator since its creation, from which the internal state of a multistep
+ * integrator can be restored exactly (the past steps, order and step size of the Adams-Bashforth-Moulton integrator of
+ * Tudat cannot be retrieved or set directly). The integrator is restored by creating it at the same initial time and
+ * state, and repeating the same integration steps and state modifications, with each evaluation of the state
+ * derivative replaced by its recorded value, so that the state derivative model is not evaluated.
+ */
+template< typename TimeType = double, typename StateScalarType = double >
+struct StepwiseIntegratorHistory
+{
+    typedef Eigen::Matrix< StateScalarType, Eigen::Dynamic, Eigen::Dynamic > StateType;
+
+    //! Time at which the integrator was created
+    TimeType initialTime_;
+
+    //! Propagated state with which the integrator was created
+    StateType initialState_;
+
+    //! Step sizes requested for the integration steps taken, in order
+    std::vector< TimeType > stepSizes_;
+
+    //! States set by modifyCurrentState, each with the number of integration steps taken before it
+    std::vector< std::pair< std::uint64_t, StateType > > modifiedStates_;
+
+    //! Times and values of all evaluations of the state derivative by the integrator, in order
+    std::vector< std::pair< TimeType, StateType > > stateDerivatives_;
+};
+
+//! Integrator used by the stepwise dynamics simulator, independent of the type of the integrated state
+/*!
+ * Integrator used by the stepwise dynamics simulator, independent of the type of the integrated state. The simulator
+ * exchanges (dynamic-size) propagated states with the integrator, which may internally integrate a fixed-size state
+ * (see TemplatedStepwiseIntegrator).
+ */
+template< typename TimeType = double, typename StateScalarType = double >
+class StepwiseIntegrator
+{
+public:
+
+    typedef Eigen::Matrix< StateScalarType, Eigen::Dynamic, Eigen::Dynamic > StateType;
+
+    virtual ~StepwiseIntegrator( ){ }
+
+    //! Function to retrieve the current time of the integrator
+    virtual TimeType getCurrentTime( ) = 0;
+
+    //! Function to retrieve the step size proposed for the next integration step
+    virtual TimeType getNextStepSize( ) = 0;
+
+    //! Function to perform a single integration step
+    /*!
+     * Function to perform a single integration step
+     * \param stepSize Step size to take
+     * \param newState State at the end of the step (returned by reference; not reallocated if it has the correct size)
+     */
+    virtual void performIntegrationStep( const TimeType stepSize, StateType& newState ) = 0;
+
+    //! Function to replace the current state of the integrator
+    virtual void modifyCurrentState( const StateType& newState ) = 0;
+
+    //! Function to find the state at which an exact termination condition is met, within the last integration step
+    /*!
+     * Function to find the state at which an exact termination condition is met, within the last integration step, using
+     * tudat::propagators::getFinalStateForExactTerminationCondition
+     * \param terminationCondition Termination condition that is met
+     * \param previousTime Time at the start of the last step
+     * \param newTime Time at the end of the last step
+     * \param previousState State at the start of the last step
+     * \param newState State at the end of the last step (input), and at the termination time (returned by reference)
+     * \param endTime Time at which the termination condition is met (returned by reference)
+     */
+    virtual void computeFinalStateForExactTerminationCondition(
+            const std::shared_ptr< tudat::propagators::PropagationTerminationCondition > terminationCondition,
+            const TimeType previousTime,
+            const TimeType newTime,
+            const StateType& previousState,
+            StateType& newState,
+            TimeType& endTime ) = 0;
+
+    //! Function to integrate from a state at the start of a step to a time within the step
+    /*!
+     * Function to integrate from a state at the start of a step to a time within the step, without modifying the state
+     * of this integrator (e.g. to obtain the integrated, instead of interpolated, state at an event within the last step)
+     * \param initialTime Time at the start of the step
+     * \param initialState State at the start of the step
+     * \param finalTime Time to which the state is to be integrated
+     * \param finalState State at the final time (returned by reference)
+     */
+    virtual void integrateWithinStep(
+            const TimeType initialTime,
+            const StateType& initialState,
+            const TimeType finalTime,
+            StateType& finalState ) = 0;
+
+    //! Function to check whether the integrated state has a size that is fixed at compile time
+    virtual bool isStateSizeFixed( ) = 0;
+
+    //! Function to retrieve the history from which the internal state of the integrator can be restored
+    /*!
+     * Function to retrieve the history from which the internal state of the integrator can be restored (see
+     * restoreHistory). Only recorded for integrators of which the internal state is not determined by the current time,
+     * state and step size (see isIntegratorHistoryRecorded).
+     * \return History of the integrator (nullptr if it is not recorded)
+     */
+    virtual std::shared_ptr< StepwiseIntegratorHistory< TimeType, StateScalarType > > getHistory( ) = 0;
+
+    //! Function to restore the internal state of the integrator from its history
+    /*!
+     * Function to restore the internal state of the integrator from its history, retrieved with getHistory from an
+     * integrator created with the same settings (e.g. before the propagation was checkpointed)
+     * \param history History of the integrator
+     * \param currentTime Current time of the integrator for which the history was retrieved
+     * \param currentState Current state of the integrator for which the history was retrieved; an exception is thrown if
+     * the restored integrator does not reproduce this state exactly
+     */
+    virtual void restoreHistory( const StepwiseIntegratorHistory< TimeType, StateScalarType >& history,
+                                 const TimeType currentTime,
+                                 const StateType& currentState ) = 0;
+};
+
+//! Function to check whether the history of the integrator is recorded, so that it can be restored from a checkpoint
+/*!
+ * Function to check whether the history of the integrator is recorded (see StepwiseIntegratorHistory), so that it can be
+ * restored from a checkpoint. This is only needed for the (multistep) Adams-Bashforth-Moulton integrator; since all of
+ * its state derivative evaluations are recorded, its memory use grows with the length of the propagation.
+ */
+template< typename TimeType = double >
+bool isIntegratorHistoryRecorded(
+        const std::shared_ptr< tudat::numerical_integrators::IntegratorSettings< TimeType > > integratorSettings )
+{
+    return integratorSettings->integratorType_ == tudat::numerical_integrators::adamsBashforthMoulton;
+}
+
+//! State derivative function that records the times and values of its evaluations, or replays recorded values
+template< typename TimeType, typename IntegratedStateType >
+class RecordedStateDerivativeFunction
+{
+public:
+
+    RecordedStateDerivativeFunction(
+            const std::function< IntegratedStateType( const TimeType, const IntegratedStateType& ) >& stateDerivativeFunction ):
+        stateDerivativeFunction_( stateDerivativeFunction ), isReplaying_( false ), numberOfReplayedEvaluations_( 0 ){ }
+
+    IntegratedStateType evaluate( const TimeType time, const IntegratedStateType& state )
+    {
+        if( isReplaying_ )
+        {
+            if( numberOfReplayedEvaluations_ >= stateDerivatives_.size( ) ||
+                    stateDerivatives_.at( numberOfReplayedEvaluations_ ).first != time )
+            {
+                throw std::runtime_error( "Error when restoring integrator history, state derivative evaluation at t=" +
+                                          std::to_string( static_cast< double >( time ) ) + " was not recorded" );
+            }
+            return stateDerivatives_.at( numberOfReplayedEvaluations_++ ).second;
+        }
+
+        stateDerivatives_.push_back( std::make_pair( time, stateDerivativeFunction_( time, state ) ) );
+        return stateDerivatives_.back( ).second;
+    }
+
+    //! Function to start replaying the given evaluations, which replace all evaluations recorded so far
+    void startReplay( const std::vector< std::pair< TimeType, IntegratedStateType > >& stateDerivatives )
+    {
+        stateDerivatives_ = stateDerivatives;
+        numberOfReplayedEvaluations_ = 0;
+        isReplaying_ = true;
+    }
+
+    //! Function to stop replaying, after which new evaluations are recorded
+    void stopReplay( )
+    {
+        isReplaying_ = false;
+        if( numberOfReplayedEvaluations_ != stateDerivatives_.size( ) )
+        {
+            throw std::runtime_error( "Error when restoring integrator history, " +
+                                      std::to_string( stateDerivatives_.size( ) - numberOfReplayedEvaluations_ ) +
+                                      " recorded state derivative evaluations were not replayed" );
+        }
+    }
+
+    const std::vector< std::pair< TimeType, IntegratedStateType > >& getStateDerivatives( )
+    {
+        return stateDerivatives_;
+    }
+
+private:
+
+    std::function< IntegratedStateType( const TimeType, const IntegratedStateType& ) > stateDerivativeFunction_;
+
+    std::vector< std::pair< TimeType, IntegratedStateType > > stateDerivatives_;
+
+    bool isReplaying_;
+
+    std::size_t numberOfReplayedEvaluations_;
+};
+
+//! Function to convert a state derivative function of the propagated state to one of the integrated state type
+/*!
+ * Function to convert a state derivative function of the (dynamic-size) propagated state to one of the integrated state
+ * type. The propagated state passed to the original function is stored in a buffer of the arena (see
+ * StepwisePropagationBuffers) that is reused in each evaluation. Note that the original function (the state derivative
+ * model of Tudat) still returns a dynamic-size state derivative, which is allocated in each evaluation, and then copied
+ * to the integrated state type.
+ */
+template< typename TimeType, typename StateScalarType, typename IntegratedStateType >
+struct IntegratedStateDerivativeFunction
+{
+    typedef Eigen::Matrix< StateScalarType, Eigen::Dynamic, Eigen::Dynamic > StateType;
+
+    static std::function< IntegratedStateType( const TimeType, const IntegratedStateType& ) > create(
+            const std::function< StateType( const TimeType, const StateType& ) >& stateDerivativeFunction,
+            const std::shared_ptr< StepwisePropagationBuffers< StateScalarType > > buffers )
+    {
+        return [ = ]( const TimeType time, const IntegratedStateType& integratedState )
+        {
+            buffers->propagatedState_.noalias( ) = integratedState;
+            return IntegratedStateType( stateDerivativeFunction( time, buffers->propagatedState_ ) );
+        };
+    }
+};
+
+//! Function to convert a state derivative function of the propagated state, for a dynamic-size integrated state
+template< typename TimeType, typename StateScalarType >
+struct IntegratedStateDerivativeFunction< TimeType, StateScalarType,
+        Eigen::Matrix< StateScalarType, Eigen::Dynamic, Eigen::Dynamic > >
+{
+    typedef Eigen::Matrix< StateScalarType, Eigen::Dynamic, Eigen::Dynamic > StateType;
+
+    static std::function< StateType( const TimeType, const StateType& ) > create(
+            const std::function< StateType( const TimeType, const StateType& ) >& stateDerivativeFunction,
+            const std::shared_ptr< StepwisePropagationBuffers< StateScalarType > > )
+    {
+        return stateDerivativeFunction;
+    }
+};
+
+//! Stepwise integrator that integrates a state of the given (dynamic- or fixed-size) Eigen type, using a Tudat integrator
+/*!
+ * Stepwise integrator that integrates a state of the given (dynamic- or fixed-size) Eigen type, using a Tudat integrator
+ * created from the integrator settings. For a fixed-size type, the operations of the integrator itself on the state
+ * (stages of a Runge-Kutta method, error estimate, ...) use fixed-size Eigen types, which are not stored on the heap.
+ * Each evaluation of the state derivative, however, still uses the (dynamic-size) state derivative model of Tudat, and
+ * allocates its result (see IntegratedStateDerivativeFunction), so that a propagation step is not free of allocations.
+ * This integrator is only used by the stepwise dynamics simulator (SingleArcStepwiseDynamicsSimulator), which
+ * createDynamicsSimulator selects by default when the state is integrated with fixed-size types (see
+ * isFixedSizeStepwisePropagation); propagations with the dynamics simulators of Tudat always integrate dynamic-size
+ * states.
+ */
+template< typename TimeType, typename StateScalarType, typename IntegratedStateType >
+class TemplatedStepwiseIntegrator: public StepwiseIntegrator< TimeType, StateScalarType >
+{
+public:
+
+    typedef Eigen::Matrix< StateScalarType, Eigen::Dynamic, Eigen::Dynamic > StateType;
+
+    typedef tudat::numerical_integrators::NumericalIntegrator< TimeType, IntegratedStateType, IntegratedStateType, TimeType >
+    IntegratorType;
+
+    //! Constructor
+    /*!
+     * Constructor
+     * \param stateDerivativeFunction Function computing the derivative of the propagated state
+     * \param initialState Propagated state at the initial time
+     * \param initialTime Initial time
+     * \param integratorSettings Settings for the integrator
+     * \param buffers Arena of propagated-state buffers of the simulator, allocated for the size of the initial state
+     */
+    TemplatedStepwiseIntegrator(
+            const std::function< StateType( const TimeType, const StateType& ) >& stateDerivativeFunction,
+            const StateType& initialState,
+            const TimeType initialTime,
+            const std::shared_ptr< tudat::numerical_integrators::IntegratorSettings< TimeType > > integratorSettings,
+            const std::shared_ptr< StepwisePropagationBuffers< StateScalarType > > buffers ):
+        integratedStateDerivativeFunction_(
+            IntegratedStateDerivativeFunction< TimeType, StateScalarType, IntegratedStateType >::create(
+                stateDerivativeFunction, buffers ) ),
+        integratorSettings_( integratorSettings )
+    {
+        if( isIntegratorHistoryRecorded( integratorSettings_ ) )
+        {
+            recordedStateDerivativeFunction_ =
+                    std::make_shared< RecordedStateDerivativeFunction< TimeType, IntegratedStateType > >(
+                        integratedStateDerivativeFunction_ );
+        }
+        createIntegrator( initialTime, initialState );
+    }
+
+    TimeType getCurrentTime( )
+    {
+        return integrator_->getCurrentIndependentVariable( );
+    }
+
+    TimeType getNextStepSize( )
+    {
+        return integrator_->getNextStepSize( );
+    }
+
+    void performIntegrationStep( const TimeType stepSize, StateType& newState )
+    {
+        if( recordedStateDerivativeFunction_ != nullptr )
+        {
+            stepSizes_.push_back( stepSize );
+        }
+        // Assigned in place (instead of move-assigned from the returned state), so that the buffer of newState is reused
+        newState.noalias( ) = integrator_->performIntegrationStep( stepSize );
+    }
+
+    void modifyCurrentState( const StateType& newState )
+    {
+        if( recordedStateDerivativeFunction_ != nullptr )
+        {
+            modifiedStates_.push_back( std::make_pair( static_cast< std::uint64_t >( stepSizes_.size( ) ), newState ) );
+        }
+        integrator_->modifyCurrentState( IntegratedStateType( newState ) );
+    }
+
+    void computeFinalStateForExactTerminationCondition(
+            const std::shared_ptr< tudat::propagators::PropagationTerminationCondition > terminationCondition,
+            const TimeType previousTime,
+            const TimeType newTime,
+            const StateType& previousState,
+            StateType& newState,
+            TimeType& endTime )
+    {
+        newState.noalias( ) = tudat::propagators::getFinalStateForExactTerminationCondition< IntegratedStateType, TimeType, TimeType >(
+                    terminationCondition, integrator_, previousTime, newTime,
+                    IntegratedStateType( previousState ), IntegratedStateType( newState ), endTime );
+    }
+
+    //! Function to integrate from a state at the start of a step to a time within the step
+    /*!
+     * Function to integrate from a state at the start of a step to a time within the step. A separate integrator, created
+     * from the same settings, is used, so that the state (and, for a multistep method, the history) of the integrator
+     * of the propagation is not modified. A variable step-size integrator may reject the requested step and take a
+     * smaller one, in which case further steps are taken until the final time is reached.
+     */
+    void integrateWithinStep( const TimeType initialTime,
+                              const StateType& initialState,
+                              const TimeType finalTime,
+                              StateType& finalState )
+    {
+        finalState.noalias( ) = initialState;
+        const double timeTolerance = 10.0 * std::numeric_limits< double >::epsilon( ) * std::max(
+                    { std::fabs( static_cast< double >( initialTime ) ), std::fabs( static_cast< double >( finalTime ) ), 1.0 } );
+        if( std::fabs( static_cast< double >( finalTime - initialTime ) ) <= timeTolerance )
+        {
+            return;
+        }
+
+        const std::shared_ptr< IntegratorType > stepIntegrator =
+                tudat::numerical_integrators::createIntegrator< TimeType, IntegratedStateType >(
+                    integratedStateDerivativeFunction_, IntegratedStateType( initialState ), initialTime, integratorSettings_ );
+
+        unsigned int numberOfSteps = 0;
+        while( std::fabs( static_cast< double >( finalTime - stepIntegrator->getCurrentIndependentVariable( ) ) ) > timeTolerance )
+        {
+            if( numberOfSteps >= maximumNumberOfStepsWithinStep )
+            {
+                throw std::runtime_error( "Error when integrating within step, final time " +
+                                          std::to_string( static_cast< double >( finalTime ) ) + " not reached in " +
+                                          std::to_string( maximumNumberOfStepsWithinStep ) + " steps" );
+            }
+            finalState.noalias( ) = stepIntegrator->performIntegrationStep(
+                        finalTime - stepIntegrator->getCurrentIndependentVariable( ) );
+            numberOfSteps++;
+        }
+    }
+
+    bool isStateSizeFixed( )
+    {
+        return IntegratedStateType::SizeAtCompileTime != Eigen::Dynamic;
+    }
+
+    std::shared_ptr< StepwiseIntegratorHistory< TimeType, StateScalarType > > getHistory( )
+    {
+        if( recordedStateDerivativeFunction_ == nullptr )
+        {
+            return nullptr;
+        }
+
+        std::shared_ptr< StepwiseIntegratorHistory< TimeType, StateScalarType > > history =
+                std::make_shared< StepwiseIntegratorHistory< TimeType, StateScalarType > >( );
+        history->initialTime_ = initialTime_;
+        history->initialState_ = initialState_;
+        history->stepSizes_ = stepSizes_;
+        history->modifiedStates_ = modifiedStates_;
+        for( const auto& stateDerivative : recordedStateDerivativeFunction_->getStateDerivatives( ) )
+        {
+            history->stateDerivatives_.push_back( std::make_pair( stateDerivative.first, StateType( stateDerivative.second ) ) );
+        }
+        return history;
+    }
+
+    void restoreHistory( const StepwiseIntegratorHistory< TimeType, StateScalarType >& history,
+                         const TimeType currentTime,
+                         const StateType& currentState )
+    {
+        if( recordedStateDerivativeFunction_ == nullptr )
+        {
+            throw std::runtime_error( "Error when restoring integrator history, history is not recorded for this integrator" );
+        }
+
+        std::vector< std::pair< TimeType, IntegratedStateType > > stateDerivatives;
+        for( const auto& stateDerivative : history.stateDerivatives_ )
+        {
+            stateDerivatives.push_back( std::make_pair( stateDerivative.first, IntegratedStateType( stateDerivative.second ) ) );
+        }
+        recordedStateDerivativeFunction_->startReplay( stateDerivatives );
+
+        // Repeat the steps and state modifications, which are recorded again in the same order
+        stepSizes_.clear( );
+        modifiedStates_.clear( );
+        createIntegrator( history.initialTime_, history.initialState_ );
+        StateType newState = history.initialState_;
+        std::size_t modificationIndex = 0;
+        for( std::size_t i = 0; i <= history.stepSizes_.size( ); i++ )
+        {
+            while( modificationIndex < history.modifiedStates_.size( ) &&
+                   history.modifiedStates_.at( modificationIndex ).first == i )
+            {
+                newState = history.modifiedStates_.at( modificationIndex ).second;
+                modifyCurrentState( newState );
+                modificationIndex++;
+            }
+            if( i < history.stepSizes_.size( ) )
+            {
+                performIntegrationStep( history.stepSizes_.at( i ), newState );
+            }
+        }
+        recordedStateDerivativeFunction_->stopReplay( );
+
+        if( getCurrentTime( ) != currentTime || newState != currentState )
+        {
+            throw std::runtime_error( "Error when restoring integrator history, the state at t=" +
+                                      std::to_string( static_cast< double >( currentTime ) ) + " is not reproduced" );
+        }
+    }
+
+private:
+
+    //! Function to create the Tudat integrator, starting from the given time and state
+    void createIntegrator( const TimeType initialTime, const StateType& initialState )
+    {
+        initialTime_ = initialTime;
+        initialState_ = initialState;
+
+        std::function< IntegratedStateType( const TimeType, const IntegratedStateType& ) > stateDerivativeFunction =
+                integratedStateDerivativeFunction_;
+        if( recordedStateDerivativeFunction_ != nullptr )
+        {
+            const std::shared_ptr< RecordedStateDerivativeFunction< TimeType, IntegratedStateType > > recordedFunction =
+                    recordedStateDerivativeFunction_;
+            stateDerivativeFunction = [ = ]( const TimeType time, const IntegratedStateType& state )
+            {
+                return recordedFunction->evaluate( time, state );
+            };
+        }
+        integrator_ = tudat::numerical_integrators::createIntegrator< TimeType, IntegratedStateType >(
+                    stateDerivativeFunction, IntegratedStateType( initialState ), initialTime, integratorSettings_ );
+    }
+
+    //! Maximum number of steps taken by integrateWithinStep before it is aborted
+    static const unsigned int maximumNumberOfStepsWithinStep = 1000;
+
+    std::function< IntegratedStateType( const TimeType, const IntegratedStateType& ) > integratedStateDerivativeFunction_;
+
+    std::shared_ptr< tudat::numerical_integrators::IntegratorSettings< TimeType > > integratorSettings_;
+
+    std::shared_ptr< IntegratorType > integrator_;
+
+    //! State derivative function of the integrator that records its evaluations (nullptr if the history is not recorded)
+    std::shared_ptr< RecordedStateDerivativeFunction< TimeType, IntegratedStateType > > recordedStateDerivativeFunction_;
+
+    //! Time at which the Tudat integrator was created
+    TimeType initialTime_;
+
+    //! State with which the Tudat integrator was created
+    StateType initialState_;
+
+    //! Step sizes of the integration steps taken since the creation of the Tudat integrator (if history is recorded)
+    std::vector< TimeType > stepSizes_;
+
+    //! States set by modifyCurrentState, with the number of steps taken before each of them (if history is recorded)
+    std::vector< std::pair< std::uint64_t, StateType > > modifiedStates_;
+};
+
+//! Function to check whether a fixed-size state can be integrated with the given integrator settings
+/*!
+ * Function to check whether a fixed-size state can be integrated with the given integrator settings. Only the
+ * Runge-Kutta integrators (which make up most propagations) are integrated with fixed-size types; the other integrators
+ * use the dynamic-size state.
+ */
+template< typename TimeType = double >
+bool isFixedSizeIntegrationSupported(
+        const std::shared_ptr< tudat::numerical_integrators::IntegratorSettings< TimeType > > integratorSettings )
+{
+    return integratorSettings->integratorType_ == tudat::numerical_integrators::rungeKuttaFixedStepSize ||
+            integratorSettings->integratorType_ == tudat::numerical_integrators::rungeKuttaVariableStepSize;
+}
+
+//! Function to create the integrator of the stepwise dynamics simulator
+/*!
+ * Function to create the integrator of the stepwise dynamics simulator. The type of the integrated state is selected
+ * from the size of the initial state: if it is equal to fixedSizeIntegratedStateSize (and the integrator supports
+ * it), the state is integrated as a fixed-size vector, otherwise as a dynamic-size matrix.
+ * \param stateDerivativeFunction Function computing the derivative of the propagated state
+ * \param initialState Propagated state at the initial time
+ * \param initialTime Initial time
+ * \param integratorSettings Settings for the integrator
+ * \param buffers Arena of propagated-state buffers of the simulator, allocated for the size of the initial state
+ * \return Integrator
+ */
+template< typename TimeType = double, typename StateScalarType = double >
+std::shared_ptr< StepwiseIntegrator< TimeType, StateScalarType > > createStepwiseIntegrator(
+        const std::function< Eigen::Matrix< StateScalarType, Eigen::Dynamic, Eigen::Dynamic >(
+            const TimeType, const Eigen::Matrix< StateScalarType, Eigen::Dynamic, Eigen::Dynamic >& ) >& stateDerivativeFunction,
+        const Eigen::Matrix< StateScalarType, Eigen::Dynamic, Eigen::Dynamic >& initialState,
+        const TimeType initialTime,
+        const std::shared_ptr< tudat::numerical_integrators::IntegratorSettings< TimeType > > integratorSettings,
+        const std::shared_ptr< StepwisePropagationBuffers< StateScalarType > > buffers )
+{
+    if( initialState.rows( ) == fixedSizeIntegratedStateSize && initialState.cols( ) == 1 &&
+            isFixedSizeIntegrationSupported( integratorSettings ) )
+    {
+        return std::make_shared< TemplatedStepwiseIntegrator<
+                TimeType, StateScalarType, Eigen::Matrix< StateScalarType, fixedSizeIntegratedStateSize, 1 > > >(
+                    stateDerivativeFunction, initialState, initialTime, integratorSettings, buffers );
+    }
+    else
+    {
+        return std::make_shared< TemplatedStepwiseIntegrator<
+                TimeType, StateScalarType, Eigen::Matrix< StateScalarType, Eigen::Dynamic, Eigen::Dynamic > > >(
+                    stateDerivativeFunction, initialState, initialTime, integratorSettings, buffers );
+    }
+}
+
+} // namespace tudatpy
+
+#endif // TUDATPY_STEPWISE_INTEGRATOR_H
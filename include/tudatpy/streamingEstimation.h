@@ -0,0 +1,565 @@
+/*    Copyright (c) 2010-2022, Delft University of Technology
+ *    All rights reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ */
+
+#ifndef TUDATPY_STREAMING_ESTIMATION_H
+#define TUDATPY_STREAMING_ESTIMATION_H
+
+#include <algorithm>
+#include <cmath>
+#include <functional>
+#include <limits>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include <Eigen/Dense>
+
+#include "tudat/simulation/estimation_setup.h"
+
+#include "tudatpy/observationPartials.h"
+#include "tudatpy/parallelExecution.h"
+
+namespace tudatpy
+{
+
+//! Accumulator of the normal equations of a weighted least-squares problem, from blocks of observations
+/*!
+ * Accumulator of the normal equations of a weighted least-squares problem, from blocks of observations, so that the
+ * full design matrix never has to be stored: memory scales with the square of the number of parameters. The normal
+ * matrix and right-hand side are accumulated without normalization; the normalization terms of the parameters are
+ * determined from the extreme values of each column of the partials, in the same manner as Tudat normalizes the full
+ * design matrix, and applied to the accumulated equations once all observations have been added.
+ */
+class NormalEquationAccumulator
+{
+public:
+
+    //! Constructor
+    /*!
+     * Constructor
+     * \param numberOfParameters Number of estimated parameters
+     */
+    NormalEquationAccumulator( const int numberOfParameters ):
+        normalMatrix_( Eigen::MatrixXd::Zero( numberOfParameters, numberOfParameters ) ),
+        rightHandSide_( Eigen::VectorXd::Zero( numberOfParameters ) ),
+        minimumPartials_( Eigen::VectorXd::Constant( numberOfParameters, std::numeric_limits< double >::infinity( ) ) ),
+        maximumPartials_( Eigen::VectorXd::Constant( numberOfParameters, -std::numeric_limits< double >::infinity( ) ) ),
+        numberOfObservations_( 0 ){ }
+
+    //! Function to add a block of observations to the normal equations
+    /*!
+     * Function to add a block of observations to the normal equations
+     * \param partials Partials of the observations w.r.t. the parameters (one row per observation)
+     * \param residuals Residuals (observed minus computed) of the observations
+     * \param weights Weights of the observations
+     */
+    void addObservations( const Eigen::MatrixXd& partials, const Eigen::VectorXd& residuals, const Eigen::VectorXd& weights )
+    {
+        if( partials.cols( ) != normalMatrix_.cols( ) || partials.rows( ) != residuals.rows( ) ||
+                partials.rows( ) != weights.rows( ) )
+        {
+            throw std::runtime_error( "Error when adding observations to normal equations, sizes are inconsistent" );
+        }
+        if( partials.rows( ) == 0 )
+        {
+            return;
+        }
+
+        const Eigen::MatrixXd weightedPartials = weights.asDiagonal( ) * partials;
+        normalMatrix_.noalias( ) += partials.transpose( ) * weightedPartials;
+        rightHandSide_.noalias( ) += weightedPartials.transpose( ) * residuals;
+        minimumPartials_ = minimumPartials_.cwiseMin( partials.colwise( ).minCoeff( ).transpose( ) );
+        maximumPartials_ = maximumPartials_.cwiseMax( partials.colwise( ).maxCoeff( ).transpose( ) );
+        numberOfObservations_ += static_cast< int >( partials.rows( ) );
+    }
+
+    //! Function to add the normal equations accumulated by another accumulator (for the same parameters)
+    void addNormalEquations( const NormalEquationAccumulator& otherAccumulator )
+    {
+        normalMatrix_ += otherAccumulator.normalMatrix_;
+        rightHandSide_ += otherAccumulator.rightHandSide_;
+        minimumPartials_ = minimumPartials_.cwiseMin( otherAccumulator.minimumPartials_ );
+        maximumPartials_ = maximumPartials_.cwiseMax( otherAccumulator.maximumPartials_ );
+        numberOfObservations_ += otherAccumulator.numberOfObservations_;
+    }
+
+    //! Function to reset the accumulated normal equations to zero
+    void reset( )
+    {
+        normalMatrix_.setZero( );
+        rightHandSide_.setZero( );
+        minimumPartials_.setConstant( std::numeric_limits< double >::infinity( ) );
+        maximumPartials_.setConstant( -std::numeric_limits< double >::infinity( ) );
+        numberOfObservations_ = 0;
+    }
+
+    //! Function to retrieve the normalization term of each parameter (signed largest absolute partial, 1 if all are zero)
+    Eigen::VectorXd getNormalizationTerms( ) const
+    {
+        Eigen::VectorXd normalizationTerms = Eigen::VectorXd::Ones( normalMatrix_.cols( ) );
+        for( int i = 0; i < normalizationTerms.rows( ); i++ )
+        {
+            if( numberOfObservations_ > 0 )
+            {
+                normalizationTerms( i ) = ( std::fabs( minimumPartials_( i ) ) > maximumPartials_( i ) ) ?
+                            minimumPartials_( i ) : maximumPartials_( i );
+            }
+            if( normalizationTerms( i ) == 0.0 )
+            {
+                normalizationTerms( i ) = 1.0;
+            }
+        }
+        return normalizationTerms;
+    }
+
+    //! Function to retrieve the (unnormalized) normal matrix H^T W H
+    const Eigen::MatrixXd& getNormalMatrix( ) const
+    {
+        return normalMatrix_;
+    }
+
+    //! Function to retrieve the (unnormalized) right-hand side H^T W r
+    const Eigen::VectorXd& getRightHandSide( ) const
+    {
+        return rightHandSide_;
+    }
+
+    int getNumberOfObservations( ) const
+    {
+        return numberOfObservations_;
+    }
+
+private:
+
+    Eigen::MatrixXd normalMatrix_;
+
+    Eigen::VectorXd rightHandSide_;
+
+    //! Smallest value of the partials w.r.t. each parameter
+    Eigen::VectorXd minimumPartials_;
+
+    //! Largest value of the partials w.r.t. each parameter
+    Eigen::VectorXd maximumPartials_;
+
+    int numberOfObservations_;
+};
+
+//! Function to divide the observation sets of a collection into blocks with a minimum number of observations
+/*!
+ * Function to divide the observation sets of a collection into blocks of consecutive sets with a minimum number of
+ * observations (except the last block). The entries are not split by this function, so that the division only depends
+ * on the entries and the block size; large observation sets should be split beforehand (see
+ * splitObservationSetEntries) to limit the size of the blocks.
+ * \param observationSetEntries Observation sets of the collection (see getObservationSetEntries)
+ * \param minimumBlockSize Minimum number of observations per block
+ * \return Index of the first observation set of each block, followed by the number of observation sets
+ */
+template< typename ObservationScalarType = double, typename TimeType = double >
+std::vector< std::size_t > getObservationBlockBoundaries(
+        const std::vector< ObservationSetEntry< ObservationScalarType, TimeType > >& observationSetEntries,
+        const int minimumBlockSize )
+{
+    std::vector< std::size_t > blockBoundaries = { 0 };
+    int currentBlockSize = 0;
+    for( std::size_t i = 0; i < observationSetEntries.size( ); i++ )
+    {
+        currentBlockSize += observationSetEntries.at( i ).numberOfObservations_;
+        if( currentBlockSize >= minimumBlockSize && i + 1 < observationSetEntries.size( ) )
+        {
+            blockBoundaries.push_back( i + 1 );
+            currentBlockSize = 0;
+        }
+    }
+    blockBoundaries.push_back( observationSetEntries.size( ) );
+    return blockBoundaries;
+}
+
+//! Function to accumulate the normal equations of an observation collection, computing the partials block by block
+/*!
+ * Function to accumulate the normal equations of an observation collection, computing the partials block by block on
+ * a pool of worker threads (one per estimator, see computeResidualsAndPartialsInParallel). Observation sets with more
+ * than minimumBlockSize observations are split into ranges of observation times of at most that size (see
+ * splitObservationSetEntries), which are divided into blocks of at least minimumBlockSize observations (see
+ * getObservationBlockBoundaries), so that each block has fewer than twice minimumBlockSize observations; the partials
+ * of a block are discarded once its contribution to the normal equations is computed. The contributions are added in
+ * the order of the blocks, so that the result is identical for any number of threads. Memory use is of the order of
+ * (number of threads) x (block size + number of parameters) x (number of parameters), in addition to the residual
+ * vector, independently of the size of the observation sets. The SPICE-based models of the
+ * bodies of the estimators are replaced by synchronized wrappers (see synchronizeSpiceAccessOfEstimators) while the
+ * normal equations are accumulated, and put back afterwards.
+ * \param orbitDeterminationManagers Estimators used by the worker threads (one per thread)
+ * \param observationCollection Observations for which the normal equations are accumulated
+ * \param weights Weights of all observations, in the order of the concatenated observation vector
+ * \param minimumBlockSize Minimum number of observations per block, and maximum number of observations per range of
+ * observation times (if zero or negative, the maximum of the number of parameters and 1000 is used)
+ * \param accumulator Accumulator to which the normal equations are added
+ * \param residuals Residuals (observed minus computed) of all observations (returned by reference)
+ */
+template< typename ObservationScalarType = double, typename TimeType = double >
+void accumulateNormalEquationsInParallel(
+        const std::vector< std::shared_ptr< tudat::simulation_setup::OrbitDeterminationManager< ObservationScalarType, TimeType > > >&
+        orbitDeterminationManagers,
+        const std::shared_ptr< tudat::observation_models::ObservationCollection< ObservationScalarType, TimeType > >
+        observationCollection,
+        const Eigen::VectorXd& weights,
+        const int minimumBlockSize,
+        NormalEquationAccumulator& accumulator,
+        Eigen::VectorXd& residuals )
+{
+    const int totalNumberOfObservations = observationCollection->getTotalObservableSize( );
+    if( weights.rows( ) != totalNumberOfObservations )
+    {
+        throw std::runtime_error( "Error when accumulating normal equations, number of weights (" +
+                                  std::to_string( weights.rows( ) ) + ") is inconsistent with number of observations (" +
+                                  std::to_string( totalNumberOfObservations ) + ")" );
+    }
+
+    const int numberOfParameters = static_cast< int >( accumulator.getRightHandSide( ).rows( ) );
+    const int blockSize = ( minimumBlockSize > 0 ) ? minimumBlockSize : std::max( numberOfParameters, 1000 );
+    const std::vector< ObservationSetEntry< ObservationScalarType, TimeType > > observationSetEntries =
+            splitObservationSetEntries( getObservationSetEntries( observationCollection ), blockSize );
+    if( observationSetEntries.size( ) == 0 )
+    {
+        throw std::runtime_error( "Error when accumulating normal equations, observation collection contains no observations" );
+    }
+    const std::vector< std::size_t > blockBoundaries = getObservationBlockBoundaries( observationSetEntries, blockSize );
+    const std::size_t numberOfBlocks = blockBoundaries.size( ) - 1;
+
+    residuals = Eigen::VectorXd::Zero( totalNumberOfObservations );
+    const std::vector< SpiceAccessSynchronization > spiceAccessSynchronizations =
+            synchronizeSpiceAccessOfEstimators( orbitDeterminationManagers );
+    try
+    {
+        // Blocks are processed in groups of one block per thread; the contributions of each group are added in order
+        const std::size_t numberOfThreads = orbitDeterminationManagers.size( );
+        std::vector< NormalEquationAccumulator > blockAccumulators(
+                    std::min( numberOfThreads, numberOfBlocks ), NormalEquationAccumulator( numberOfParameters ) );
+        for( std::size_t firstBlockIndex = 0; firstBlockIndex < numberOfBlocks; firstBlockIndex += numberOfThreads )
+        {
+            const std::size_t numberOfBlocksInGroup = std::min( numberOfThreads, numberOfBlocks - firstBlockIndex );
+            executeTasksInParallel(
+                        numberOfBlocksInGroup, static_cast< int >( numberOfThreads ),
+                        [ & ]( const std::size_t taskIndex, const unsigned int threadIndex )
+            {
+                const std::size_t blockIndex = firstBlockIndex + taskIndex;
+                NormalEquationAccumulator& blockAccumulator = blockAccumulators.at( taskIndex );
+                blockAccumulator.reset( );
+
+                int blockSize = 0;
+                for( std::size_t i = blockBoundaries.at( blockIndex ); i < blockBoundaries.at( blockIndex + 1 ); i++ )
+                {
+                    blockSize += observationSetEntries.at( i ).numberOfObservations_;
+                }
+
+                Eigen::MatrixXd blockPartials( blockSize, numberOfParameters );
+                Eigen::VectorXd blockResiduals( blockSize );
+                Eigen::VectorXd blockWeights( blockSize );
+                Eigen::VectorXd setResiduals;
+                Eigen::MatrixXd setPartials;
+                int rowIndex = 0;
+                for( std::size_t i = blockBoundaries.at( blockIndex ); i < blockBoundaries.at( blockIndex + 1 ); i++ )
+                {
+                    const ObservationSetEntry< ObservationScalarType, TimeType >& observationSetEntry =
+                            observationSetEntries.at( i );
+                    computeObservationSetResidualsAndPartials(
+                                orbitDeterminationManagers.at( threadIndex ), observationSetEntry,
+                                setResiduals, setPartials );
+                    blockPartials.middleRows( rowIndex, observationSetEntry.numberOfObservations_ ) = setPartials;
+                    blockResiduals.segment( rowIndex, observationSetEntry.numberOfObservations_ ) = setResiduals;
+                    blockWeights.segment( rowIndex, observationSetEntry.numberOfObservations_ ) =
+                            weights.segment( observationSetEntry.startIndex_, observationSetEntry.numberOfObservations_ );
+                    residuals.segment( observationSetEntry.startIndex_, observationSetEntry.numberOfObservations_ ) =
+                            setResiduals;
+                    rowIndex += observationSetEntry.numberOfObservations_;
+                }
+
+                blockAccumulator.addObservations( blockPartials, blockResiduals, blockWeights );
+            } );
+
+            for( std::size_t i = 0; i < numberOfBlocksInGroup; i++ )
+            {
+                accumulator.addNormalEquations( blockAccumulators.at( i ) );
+            }
+        }
+    }
+    catch( ... )
+    {
+        restoreSpiceAccessOfEstimators( spiceAccessSynchronizations );
+        throw;
+    }
+    restoreSpiceAccessOfEstimators( spiceAccessSynchronizations );
+}
+
+//! Results of a (least-squares) estimation or covariance analysis in which the design matrix is not stored
+struct StreamingEstimationOutput
+{
+    //! Final parameter estimate (that of the iteration with the lowest rms residual)
+    Eigen::VectorXd parameterEstimate_;
+
+    //! Residuals of the final parameter estimate
+    Eigen::VectorXd residuals_;
+
+    //! Normalization terms of the parameters (see NormalEquationAccumulator::getNormalizationTerms)
+    Eigen::VectorXd normalizationTerms_;
+
+    //! Inverse of the (unnormalized) covariance matrix, H^T W H plus the inverse a priori covariance
+    Eigen::MatrixXd inverseCovariance_;
+
+    //! Unnormalized covariance matrix
+    Eigen::MatrixXd covariance_;
+
+    //! Formal errors of the parameters
+    Eigen::VectorXd formalErrors_;
+
+    //! Parameter estimate at the start of each iteration (and the estimate computed in the last iteration)
+    std::vector< Eigen::VectorXd > parameterHistory_;
+
+    //! Rms residual of each iteration
+    std::vector< double > rmsResidualHistory_;
+
+    //! Index of the iteration of the final parameter estimate
+    int bestIteration_ = 0;
+};
+
+//! Function to solve the accumulated normal equations, in the same manner as Tudat solves them from the design matrix
+/*!
+ * Function to solve the accumulated normal equations, in the same manner as Tudat solves them from the design matrix:
+ * the equations are normalized by the normalization terms of the parameters, the (normalized) inverse a priori
+ * covariance is added to the normal matrix, and the system is solved with an LDLT decomposition.
+ * \param accumulator Accumulated normal equations
+ * \param inverseAprioriCovariance Inverse of the a priori covariance (zero if empty)
+ * \param normalizationTerms Normalization terms of the parameters (returned by reference)
+ * \param normalizedInverseCovariance Normalized inverse covariance (returned by reference)
+ * \return Correction to the parameter vector (unnormalized)
+ */
+inline Eigen::VectorXd solveNormalEquations(
+        const NormalEquationAccumulator& accumulator,
+        const Eigen::MatrixXd& inverseAprioriCovariance,
+        Eigen::VectorXd& normalizationTerms,
+        Eigen::MatrixXd& normalizedInverseCovariance )
+{
+    normalizationTerms = accumulator.getNormalizationTerms( );
+    const Eigen::VectorXd inverseNormalizationTerms = normalizationTerms.cwiseInverse( );
+
+    normalizedInverseCovariance = inverseNormalizationTerms.asDiagonal( ) * accumulator.getNormalMatrix( ) *
+            inverseNormalizationTerms.asDiagonal( );
+    if( inverseAprioriCovariance.size( ) > 0 )
+    {
+        if( inverseAprioriCovariance.rows( ) != normalizedInverseCovariance.rows( ) ||
+                inverseAprioriCovariance.cols( ) != normalizedInverseCovariance.cols( ) )
+        {
+            throw std::runtime_error( "Error when solving normal equations, size of inverse a priori covariance is "
+                                      "inconsistent with number of parameters" );
+        }
+        normalizedInverseCovariance += inverseNormalizationTerms.asDiagonal( ) * inverseAprioriCovariance *
+                inverseNormalizationTerms.asDiagonal( );
+    }
+
+    const Eigen::VectorXd normalizedRightHandSide = inverseNormalizationTerms.cwiseProduct( accumulator.getRightHandSide( ) );
+    return normalizedInverseCovariance.ldlt( ).solve( normalizedRightHandSide ).cwiseProduct( inverseNormalizationTerms );
+}
+
+//! Function to set the covariance results in the output of a streaming estimation, from the normalized inverse covariance
+inline void setStreamingCovarianceOutput( StreamingEstimationOutput& estimationOutput,
+                                          const Eigen::VectorXd& normalizationTerms,
+                                          const Eigen::MatrixXd& normalizedInverseCovariance )
+{
+    estimationOutput.normalizationTerms_ = normalizationTerms;
+    estimationOutput.inverseCovariance_ =
+            normalizationTerms.asDiagonal( ) * normalizedInverseCovariance * normalizationTerms.asDiagonal( );
+
+    const Eigen::VectorXd inverseNormalizationTerms = normalizationTerms.cwiseInverse( );
+    estimationOutput.covariance_ = inverseNormalizationTerms.asDiagonal( ) *
+            normalizedInverseCovariance.inverse( ) * inverseNormalizationTerms.asDiagonal( );
+    estimationOutput.formalErrors_ = estimationOutput.covariance_.diagonal( ).cwiseSqrt( );
+}
+
+//! Function to retrieve the inverse a priori covariance of a covariance analysis input (empty if not provided)
+template< typename ObservationScalarType = double, typename TimeType = double >
+Eigen::MatrixXd getInverseAprioriCovariance(
+        const std::shared_ptr< tudat::simulation_setup::CovarianceAnalysisInput< ObservationScalarType, TimeType > > analysisInput )
+{
+    Eigen::MatrixXd inverseAprioriCovariance = analysisInput->getInverseOfAprioriCovariance( );
+    if( inverseAprioriCovariance.size( ) > 0 && inverseAprioriCovariance.isZero( 0.0 ) )
+    {
+        inverseAprioriCovariance.resize( 0, 0 );
+    }
+    return inverseAprioriCovariance;
+}
+
+//! Function to perform a covariance analysis without storing the design matrix
+/*!
+ * Function to perform a covariance analysis without storing the design matrix, accumulating the normal equations block
+ * by block on a pool of worker threads (see accumulateNormalEquationsInParallel), at the current parameter estimate of
+ * the estimators. The estimators must be equivalent, each using its own system of bodies, and are first reset to the
+ * parameter estimate of the first estimator.
+ * \param orbitDeterminationManagers Estimators used by the worker threads (one per thread)
+ * \param analysisInput Observations, weights and a priori covariance
+ * \param minimumBlockSize Minimum number of observations per block (see accumulateNormalEquationsInParallel)
+ * \return Residuals, covariance and formal errors
+ */
+template< typename ObservationScalarType = double, typename TimeType = double >
+std::shared_ptr< StreamingEstimationOutput > computeStreamingCovariance(
+        const std::vector< std::shared_ptr< tudat::simulation_setup::OrbitDeterminationManager< ObservationScalarType, TimeType > > >&
+        orbitDeterminationManagers,
+        const std::shared_ptr< tudat::simulation_setup::CovarianceAnalysisInput< ObservationScalarType, TimeType > > analysisInput,
+        const int minimumBlockSize = 0 )
+{
+    if( orbitDeterminationManagers.size( ) == 0 )
+    {
+        throw std::runtime_error( "Error when computing streaming covariance, no estimators provided" );
+    }
+    checkEstimatorsUseSeparateBodies( orbitDeterminationManagers );
+
+    const Eigen::Matrix< ObservationScalarType, Eigen::Dynamic, 1 > parameterEstimate =
+            orbitDeterminationManagers.at( 0 )->getParametersToEstimate( )->template getFullParameterValues< ObservationScalarType >( );
+    resetParameterEstimatesInParallel( orbitDeterminationManagers, parameterEstimate );
+
+    std::shared_ptr< StreamingEstimationOutput > estimationOutput = std::make_shared< StreamingEstimationOutput >( );
+    NormalEquationAccumulator accumulator( static_cast< int >( parameterEstimate.rows( ) ) );
+    accumulateNormalEquationsInParallel(
+                orbitDeterminationManagers, analysisInput->getObservationCollection( ),
+                analysisInput->getWeightsMatrixDiagonals( ), minimumBlockSize, accumulator, estimationOutput->residuals_ );
+
+    Eigen::VectorXd normalizationTerms;
+    Eigen::MatrixXd normalizedInverseCovariance;
+    solveNormalEquations( accumulator, getInverseAprioriCovariance( analysisInput ), normalizationTerms,
+                          normalizedInverseCovariance );
+    setStreamingCovarianceOutput( *estimationOutput, normalizationTerms, normalizedInverseCovariance );
+
+    estimationOutput->parameterEstimate_ = parameterEstimate.template cast< double >( );
+    estimationOutput->parameterHistory_.push_back( estimationOutput->parameterEstimate_ );
+    estimationOutput->rmsResidualHistory_.push_back(
+                std::sqrt( estimationOutput->residuals_.squaredNorm( ) /
+                           static_cast< double >( std::max( static_cast< int >( estimationOutput->residuals_.rows( ) ), 1 ) ) ) );
+    return estimationOutput;
+}
+
+//! Function to perform an iterative least-squares estimation without storing the design matrix
+/*!
+ * Function to perform an iterative least-squares estimation without storing the design matrix, following the
+ * iterations of OrbitDeterminationManager::estimateParameters: in each iteration, the normal equations are accumulated
+ * block by block on a pool of worker threads (see accumulateNormalEquationsInParallel) and solved for a correction to
+ * the parameters, after which all estimators are reset to the corrected parameters. The iterations stop when the
+ * convergence checker of the estimation input is satisfied; the parameter estimate with the lowest rms residual is
+ * returned, and set in the estimators. The estimators must be equivalent, each using its own system of bodies.
+ * \param orbitDeterminationManagers Estimators used by the worker threads (one per thread)
+ * \param estimationInput Observations, weights, a priori covariance and convergence checker
+ * \param minimumBlockSize Minimum number of observations per block (see accumulateNormalEquationsInParallel)
+ * \return Parameter estimate, residuals, covariance and formal errors
+ */
+template< typename ObservationScalarType = double, typename TimeType = double >
+std::shared_ptr< StreamingEstimationOutput > performStreamingEstimation(
+        const std::vector< std::shared_ptr< tudat::simulation_setup::OrbitDeterminationManager< ObservationScalarType, TimeType > > >&
+        orbitDeterminationManagers,
+        const std::shared_ptr< tudat::simulation_setup::EstimationInput< ObservationScalarType, TimeType > > estimationInput,
+        const int minimumBlockSize = 0 )
+{
+    if( orbitDeterminationManagers.size( ) == 0 )
+    {
+        throw std::runtime_error( "Error when performing streaming estimation, no estimators provided" );
+    }
+    checkEstimatorsUseSeparateBodies( orbitDeterminationManagers );
+
+    const Eigen::MatrixXd inverseAprioriCovariance = getInverseAprioriCovariance( estimationInput );
+    Eigen::Matrix< ObservationScalarType, Eigen::Dynamic, 1 > parameterEstimate =
+            orbitDeterminationManagers.at( 0 )->getParametersToEstimate( )->template getFullParameterValues< ObservationScalarType >( );
+    const int numberOfParameters = static_cast< int >( parameterEstimate.rows( ) );
+
+    std::shared_ptr< StreamingEstimationOutput > estimationOutput = std::make_shared< StreamingEstimationOutput >( );
+    NormalEquationAccumulator accumulator( numberOfParameters );
+    Eigen::VectorXd residuals;
+    Eigen::VectorXd normalizationTerms;
+    Eigen::MatrixXd normalizedInverseCovariance;
+    double bestRmsResidual = std::numeric_limits< double >::infinity( );
+
+    int numberOfIterations = 0;
+    do
+    {
+        resetParameterEstimatesInParallel( orbitDeterminationManagers, parameterEstimate );
+
+        accumulator.reset( );
+        accumulateNormalEquationsInParallel(
+                    orbitDeterminationManagers, estimationInput->getObservationCollection( ),
+                    estimationInput->getWeightsMatrixDiagonals( ), minimumBlockSize, accumulator, residuals );
+        const double rmsResidual = std::sqrt(
+                    residuals.squaredNorm( ) / static_cast< double >( std::max( static_cast< int >( residuals.rows( ) ), 1 ) ) );
+
+        const Eigen::VectorXd parameterCorrection = solveNormalEquations(
+                    accumulator, inverseAprioriCovariance, normalizationTerms, normalizedInverseCovariance );
+
+        estimationOutput->parameterHistory_.push_back( parameterEstimate.template cast< double >( ) );
+        estimationOutput->rmsResidualHistory_.push_back( rmsResidual );
+        if( rmsResidual < bestRmsResidual )
+        {
+            bestRmsResidual = rmsResidual;
+            estimationOutput->bestIteration_ = numberOfIterations;
+            estimationOutput->parameterEstimate_ = parameterEstimate.template cast< double >( );
+            estimationOutput->residuals_ = residuals;
+            setStreamingCovarianceOutput( *estimationOutput, normalizationTerms, normalizedInverseCovariance );
+        }
+
+        parameterEstimate += parameterCorrection.template cast< ObservationScalarType >( );
+        numberOfIterations++;
+    }
+    while( !estimationInput->getConvergenceChecker( )->isEstimationConverged(
+               numberOfIterations, estimationOutput->rmsResidualHistory_ ) );
+
+    estimationOutput->parameterHistory_.push_back( parameterEstimate.template cast< double >( ) );
+    resetParameterEstimatesInParallel( orbitDeterminationManagers,
+                                       Eigen::Matrix< ObservationScalarType, Eigen::Dynamic, 1 >(
+                                           estimationOutput->parameterEstimate_.template cast< ObservationScalarType >( ) ) );
+    return estimationOutput;
+}
+
+//! Function to perform an iterative least-squares estimation on a pool of worker threads, creating an estimator per thread
+/*!
+ * Function to perform an iterative least-squares estimation on a pool of worker threads (see
+ * performStreamingEstimation), for which the estimators of the worker threads are created by a factory function. The
+ * factory is called once per worker thread, on the calling thread and before any worker thread is started, and must
+ * return a new estimator, using its own system of bodies, for each call (e.g. by creating the bodies in the factory).
+ * The parameter values of the first estimator are used as initial estimate, and the final estimate is set in all
+ * estimators.
+ * \param estimatorFactory Function returning the estimator of a worker thread, called as estimatorFactory( threadIndex )
+ * \param estimationInput Observations, weights, a priori covariance and convergence checker
+ * \param numberOfThreads Number of worker threads (see getNumberOfWorkerThreads)
+ * \param minimumBlockSize Minimum number of observations per block (see accumulateNormalEquationsInParallel)
+ * \return Parameter estimate, residuals, covariance and formal errors
+ */
+template< typename ObservationScalarType = double, typename TimeType = double >
+std::shared_ptr< StreamingEstimationOutput > performEstimationInParallel(
+        const std::function< std::shared_ptr< tudat::simulation_setup::OrbitDeterminationManager< ObservationScalarType, TimeType > >(
+            const unsigned int ) >& estimatorFactory,
+        const std::shared_ptr< tudat::simulation_setup::EstimationInput< ObservationScalarType, TimeType > > estimationInput,
+        const int numberOfThreads = 0,
+        const int minimumBlockSize = 0 )
+{
+    const unsigned int numberOfEstimators = getNumberOfWorkerThreads(
+                numberOfThreads, static_cast< std::size_t >(
+                    std::max( estimationInput->getObservationCollection( )->getTotalObservableSize( ), 1 ) ) );
+
+    std::vector< std::shared_ptr< tudat::simulation_setup::OrbitDeterminationManager< ObservationScalarType, TimeType > > >
+            orbitDeterminationManagers;
+    for( unsigned int i = 0; i < numberOfEstimators; i++ )
+    {
+        orbitDeterminationManagers.push_back( estimatorFactory( i ) );
+        if( orbitDeterminationManagers.back( ) == nullptr )
+        {
+            throw std::runtime_error( "Error when performing estimation in parallel, estimator factory returned no "
+                                      "estimator for thread " + std::to_string( i ) );
+        }
+    }
+    return performStreamingEstimation( orbitDeterminationManagers, estimationInput, minimumBlockSize );
+}
+
+} // namespace tudatpy
+
+#endif // TUDATPY_STREAMING_ESTIMATION_H
@@ -0,0 +1,334 @@
+/*    Copyright (c) 2010-2022, Delft University of Technology
+ *    All rights reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ */
+
+#ifndef TUDATPY_SYNCHRONIZED_ENVIRONMENT_H
+#define TUDATPY_SYNCHRONIZED_ENVIRONMENT_H
+
+#include <memory>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+#include "tudat/astro/aerodynamics/aerodynamicCoefficientInterface.h"
+#include "tudat/astro/aerodynamics/atmosphereModel.h"
+#include "tudat/astro/ephemerides/ephemeris.h"
+#include "tudat/astro/ephemerides/rotationalEphemeris.h"
+#include "tudat/interface/spice.h"
+#include "tudat/simulation/environment_setup/body.h"
+
+namespace tudatpy
+{
+
+//! Function to retrieve the mutex that guards all calls into the (non-reentrant) CSPICE library from worker threads
+inline std::mutex& getSpiceMutex( )
+{
+    static std::mutex spiceMutex;
+    return spiceMutex;
+}
+
+//! Ephemeris that forwards all requests to another ephemeris, while holding a mutex (by default, the SPICE mutex).
+/*!
+ * Ephemeris that forwards all requests to another ephemeris, while holding a mutex (by default, the SPICE mutex). This
+ * class is used to make ephemerides that are evaluated through CSPICE, or that contain internal state (such as the
+ * interpolator lookup of a tabulated ephemeris), safe for use in concurrently running propagations.
+ */
+class SynchronizedEphemeris: public tudat::ephemerides::Ephemeris
+{
+public:
+
+    //! Constructor
+    /*!
+     * Constructor
+     * \param wrappedEphemeris Ephemeris to which all requests are forwarded
+     * \param mutex Mutex held while forwarding requests (if nullptr, the SPICE mutex is used). All wrappers of the same
+     * ephemeris must use the same mutex.
+     */
+    SynchronizedEphemeris( const std::shared_ptr< tudat::ephemerides::Ephemeris > wrappedEphemeris,
+                           const std::shared_ptr< std::mutex > mutex = nullptr ):
+        Ephemeris( wrappedEphemeris->getReferenceFrameOrigin( ), wrappedEphemeris->getReferenceFrameOrientation( ) ),
+        wrappedEphemeris_( wrappedEphemeris ),
+        ownedMutex_( mutex ),
+        mutex_( ( mutex == nullptr ) ? getSpiceMutex( ) : *mutex ){ }
+
+    Eigen::Vector6d getCartesianState( const double secondsSinceEpoch ) override
+    {
+        std::lock_guard< std::mutex > lock( mutex_ );
+        return wrappedEphemeris_->getCartesianState( secondsSinceEpoch );
+    }
+
+    Eigen::Matrix< long double, 6, 1 > getCartesianLongState( const double secondsSinceEpoch )
+    {
+        std::lock_guard< std::mutex > lock( mutex_ );
+        return wrappedEphemeris_->getCartesianLongState( secondsSinceEpoch );
+    }
+
+    Eigen::Vector6d getCartesianStateFromExtendedTime( const tudat::Time& currentTime )
+    {
+        std::lock_guard< std::mutex > lock( mutex_ );
+        return wrappedEphemeris_->getCartesianStateFromExtendedTime( currentTime );
+    }
+
+    Eigen::Matrix< long double, 6, 1 > getCartesianLongStateFromExtendedTime( const tudat::Time& currentTime )
+    {
+        std::lock_guard< std::mutex > lock( mutex_ );
+        return wrappedEphemeris_->getCartesianLongStateFromExtendedTime( currentTime );
+    }
+
+    std::shared_ptr< tudat::ephemerides::Ephemeris > getWrappedEphemeris( )
+    {
+        return wrappedEphemeris_;
+    }
+
+    std::shared_ptr< std::mutex > getMutex( )
+    {
+        return ownedMutex_;
+    }
+
+private:
+
+    std::shared_ptr< tudat::ephemerides::Ephemeris > wrappedEphemeris_;
+
+    //! Mutex held while forwarding requests, if it is not the SPICE mutex (keeps the mutex alive)
+    std::shared_ptr< std::mutex > ownedMutex_;
+
+    std::mutex& mutex_;
+};
+
+//! Rotation model that forwards all requests to another rotation model, while holding the SPICE mutex.
+class SynchronizedRotationalEphemeris: public tudat::ephemerides::RotationalEphemeris
+{
+public:
+
+    SynchronizedRotationalEphemeris( const std::shared_ptr< tudat::ephemerides::RotationalEphemeris > wrappedRotationModel ):
+        RotationalEphemeris( wrappedRotationModel->getBaseFrameOrientation( ),
+                             wrappedRotationModel->getTargetFrameOrientation( ) ),
+        wrappedRotationModel_( wrappedRotationModel ){ }
+
+    Eigen::Quaterniond getRotationToBaseFrame( const double currentTime ) override
+    {
+        std::lock_guard< std::mutex > lock( getSpiceMutex( ) );
+        return wrappedRotationModel_->getRotationToBaseFrame( currentTime );
+    }
+
+    Eigen::Quaterniond getRotationToTargetFrame( const double currentTime ) override
+    {
+        std::lock_guard< std::mutex > lock( getSpiceMutex( ) );
+        return wrappedRotationModel_->getRotationToTargetFrame( currentTime );
+    }
+
+    Eigen::Matrix3d getDerivativeOfRotationToBaseFrame( const double currentTime ) override
+    {
+        std::lock_guard< std::mutex > lock( getSpiceMutex( ) );
+        return wrappedRotationModel_->getDerivativeOfRotationToBaseFrame( currentTime );
+    }
+
+    Eigen::Matrix3d getDerivativeOfRotationToTargetFrame( const double currentTime ) override
+    {
+        std::lock_guard< std::mutex > lock( getSpiceMutex( ) );
+        return wrappedRotationModel_->getDerivativeOfRotationToTargetFrame( currentTime );
+    }
+
+    std::shared_ptr< tudat::ephemerides::RotationalEphemeris > getWrappedRotationModel( )
+    {
+        return wrappedRotationModel_;
+    }
+
+private:
+
+    std::shared_ptr< tudat::ephemerides::RotationalEphemeris > wrappedRotationModel_;
+};
+
+//! Atmosphere model that forwards all requests to another atmosphere model, while holding a mutex
+/*!
+ * Atmosphere model that forwards all requests to another atmosphere model, while holding a mutex. This class is used to
+ * make atmosphere models that contain internal state (such as the cached inputs and outputs of the NRLMSISE-00 model,
+ * or the interpolator lookup of a tabulated atmosphere) safe for use in concurrently running propagations.
+ */
+class SynchronizedAtmosphereModel: public tudat::aerodynamics::AtmosphereModel
+{
+public:
+
+    SynchronizedAtmosphereModel( const std::shared_ptr< tudat::aerodynamics::AtmosphereModel > wrappedAtmosphereModel,
+                                 const std::shared_ptr< std::mutex > mutex ):
+        wrappedAtmosphereModel_( wrappedAtmosphereModel ), mutex_( mutex )
+    {
+        windModel_ = wrappedAtmosphereModel->getWindModel( );
+    }
+
+    double getDensity( const double altitude, const double longitude, const double latitude, const double time ) override
+    {
+        std::lock_guard< std::mutex > lock( *mutex_ );
+        return wrappedAtmosphereModel_->getDensity( altitude, longitude, latitude, time );
+    }
+
+    double getPressure( const double altitude, const double longitude, const double latitude, const double time ) override
+    {
+        std::lock_guard< std::mutex > lock( *mutex_ );
+        return wrappedAtmosphereModel_->getPressure( altitude, longitude, latitude, time );
+    }
+
+    double getTemperature( const double altitude, const double longitude, const double latitude, const double time ) override
+    {
+        std::lock_guard< std::mutex > lock( *mutex_ );
+        return wrappedAtmosphereModel_->getTemperature( altitude, longitude, latitude, time );
+    }
+
+    double getSpeedOfSound( const double altitude, const double longitude, const double latitude, const double time ) override
+    {
+        std::lock_guard< std::mutex > lock( *mutex_ );
+        return wrappedAtmosphereModel_->getSpeedOfSound( altitude, longitude, latitude, time );
+    }
+
+    std::shared_ptr< tudat::aerodynamics::AtmosphereModel > getWrappedAtmosphereModel( )
+    {
+        return wrappedAtmosphereModel_;
+    }
+
+    std::shared_ptr< std::mutex > getMutex( )
+    {
+        return mutex_;
+    }
+
+private:
+
+    std::shared_ptr< tudat::aerodynamics::AtmosphereModel > wrappedAtmosphereModel_;
+
+    std::shared_ptr< std::mutex > mutex_;
+};
+
+//! Aerodynamic coefficient interface that evaluates the coefficients of another interface, while holding a mutex
+/*!
+ * Aerodynamic coefficient interface that evaluates the coefficients of another interface, while holding a mutex, and
+ * stores the evaluated coefficients itself. This class is used to share the (read-only) coefficient tables or functions
+ * of an interface between bodies in concurrently running propagations: each body has its own current coefficients,
+ * and the updates of the shared interface (which stores the last evaluated coefficients, and the interpolator lookup
+ * of tabulated coefficients) are serialized. Interfaces with control surface increments are not supported, since the
+ * increment interfaces store the state of the control surfaces of a specific body.
+ */
+class SynchronizedAerodynamicCoefficientInterface: public tudat::aerodynamics::AerodynamicCoefficientInterface
+{
+public:
+
+    SynchronizedAerodynamicCoefficientInterface(
+            const std::shared_ptr< tudat::aerodynamics::AerodynamicCoefficientInterface > wrappedCoefficientInterface,
+            const std::shared_ptr< std::mutex > mutex ):
+        AerodynamicCoefficientInterface( wrappedCoefficientInterface->getReferenceLength( ),
+                                         wrappedCoefficientInterface->getReferenceArea( ),
+                                         wrappedCoefficientInterface->getLateralReferenceLength( ),
+                                         wrappedCoefficientInterface->getMomentReferencePoint( ),
+                                         wrappedCoefficientInterface->getIndependentVariableNames( ),
+                                         wrappedCoefficientInterface->getAreCoefficientsInAerodynamicFrame( ),
+                                         wrappedCoefficientInterface->getAreCoefficientsInNegativeAxisDirection( ) ),
+        wrappedCoefficientInterface_( wrappedCoefficientInterface ), mutex_( mutex ){ }
+
+    void updateCurrentCoefficients( const std::vector< double >& independentVariables,
+                                    const double currentTime = TUDAT_NAN ) override
+    {
+        std::lock_guard< std::mutex > lock( *mutex_ );
+        wrappedCoefficientInterface_->updateCurrentCoefficients( independentVariables, currentTime );
+        currentForceCoefficients_ = wrappedCoefficientInterface_->getCurrentForceCoefficients( );
+        currentMomentCoefficients_ = wrappedCoefficientInterface_->getCurrentMomentCoefficients( );
+    }
+
+    std::shared_ptr< tudat::aerodynamics::AerodynamicCoefficientInterface > getWrappedCoefficientInterface( )
+    {
+        return wrappedCoefficientInterface_;
+    }
+
+private:
+
+    std::shared_ptr< tudat::aerodynamics::AerodynamicCoefficientInterface > wrappedCoefficientInterface_;
+
+    std::shared_ptr< std::mutex > mutex_;
+};
+
+//! Models of a system of bodies that have been replaced by synchronized wrappers (see synchronizeSpiceAccess)
+struct SpiceAccessSynchronization
+{
+    //! Bodies of which the ephemeris has been wrapped, with their original ephemeris
+    std::vector< std::pair< std::shared_ptr< tudat::simulation_setup::Body >,
+    std::shared_ptr< tudat::ephemerides::Ephemeris > > > wrappedEphemerides_;
+
+    //! Bodies of which the rotation model has been wrapped, with their original rotation model
+    std::vector< std::pair< std::shared_ptr< tudat::simulation_setup::Body >,
+    std::shared_ptr< tudat::ephemerides::RotationalEphemeris > > > wrappedRotationModels_;
+};
+
+//! Function to make all SPICE-based ephemerides and rotation models of a system of bodies safe for concurrent use
+/*!
+ * Function to make all SPICE-based ephemerides and rotation models of a system of bodies safe for concurrent use, by
+ * replacing them with a synchronized model that wraps the original one. Models that are already synchronized are
+ * left untouched. This function modifies the bodies, and should not be called while these bodies are in use; the
+ * original models can be put back with restoreSpiceAccess, once the concurrent use of the bodies has finished.
+ * \param bodies System of bodies for which the models are to be wrapped
+ * \return Models that have been replaced by this call, to be passed to restoreSpiceAccess
+ */
+inline SpiceAccessSynchronization synchronizeSpiceAccess( tudat::simulation_setup::SystemOfBodies& bodies )
+{
+    SpiceAccessSynchronization synchronization;
+    for( auto bodyIterator : bodies.getMap( ) )
+    {
+        std::shared_ptr< tudat::simulation_setup::Body > currentBody = bodyIterator.second;
+        if( std::dynamic_pointer_cast< tudat::ephemerides::SpiceEphemeris >( currentBody->getEphemeris( ) ) != nullptr )
+        {
+            synchronization.wrappedEphemerides_.push_back( std::make_pair( currentBody, currentBody->getEphemeris( ) ) );
+            currentBody->setEphemeris(
+                        std::make_shared< SynchronizedEphemeris >( currentBody->getEphemeris( ) ) );
+        }
+
+        if( std::dynamic_pointer_cast< tudat::ephemerides::SpiceRotationalEphemeris >(
+                    currentBody->getRotationalEphemeris( ) ) != nullptr )
+        {
+            synchronization.wrappedRotationModels_.push_back(
+                        std::make_pair( currentBody, currentBody->getRotationalEphemeris( ) ) );
+            currentBody->setRotationalEphemeris(
+                        std::make_shared< SynchronizedRotationalEphemeris >( currentBody->getRotationalEphemeris( ) ) );
+        }
+    }
+    return synchronization;
+}
+
+//! Function to put back the SPICE-based models of a system of bodies that were wrapped by synchronizeSpiceAccess
+/*!
+ * Function to put back the SPICE-based ephemerides and rotation models of a system of bodies that were replaced by
+ * synchronized wrappers in a call to synchronizeSpiceAccess, so that the bodies are returned to the user as they were
+ * provided. Models that have been replaced again since that call are left untouched. This function modifies the
+ * bodies, and should not be called while these bodies are in use.
+ * \param synchronization Models replaced by synchronizeSpiceAccess
+ */
+inline void restoreSpiceAccess( const SpiceAccessSynchronization& synchronization )
+{
+    for( auto ephemerisIterator : synchronization.wrappedEphemerides_ )
+    {
+        std::shared_ptr< SynchronizedEphemeris > synchronizedEphemeris =
+                std::dynamic_pointer_cast< SynchronizedEphemeris >( ephemerisIterator.first->getEphemeris( ) );
+        if( synchronizedEphemeris != nullptr &&
+                synchronizedEphemeris->getWrappedEphemeris( ) == ephemerisIterator.second )
+        {
+            ephemerisIterator.first->setEphemeris( ephemerisIterator.second );
+        }
+    }
+
+    for( auto rotationModelIterator : synchronization.wrappedRotationModels_ )
+    {
+        std::shared_ptr< SynchronizedRotationalEphemeris > synchronizedRotationModel =
+                std::dynamic_pointer_cast< SynchronizedRotationalEphemeris >(
+                    rotationModelIterator.first->getRotationalEphemeris( ) );
+        if( synchronizedRotationModel != nullptr &&
+                synchronizedRotationModel->getWrappedRotationModel( ) == rotationModelIterator.second )
+        {
+            rotationModelIterator.first->setRotationalEphemeris( rotationModelIterator.second );
+        }
+    }
+}
+
+} // namespace tudatpy
+
+#endif // TUDATPY_SYNCHRONIZED_ENVIRONMENT_H
@@ -0,0 +1,307 @@
+/*    Copyright (c) 2010-2022, Delft University of Technology
+ *    All rights reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ */
+
+#ifndef TUDATPY_TABULATED_AERODYNAMIC_GUIDANCE_H
+#define TUDATPY_TABULATED_AERODYNAMIC_GUIDANCE_H
+
+#include <algorithm>
+#include <functional>
+#include <map>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include <Eigen/Core>
+
+#include "tudat/astro/aerodynamics/aerodynamicGuidance.h"
+#include "tudat/astro/aerodynamics/flightConditions.h"
+#include "tudat/math/interpolators/createInterpolator.h"
+#include "tudat/simulation/environment_setup/body.h"
+#include "tudat/simulation/environment_setup/createRotationModel.h"
+
+namespace tudatpy
+{
+
+//! Quantities by which the tables of a TabulatedAerodynamicGuidance can be indexed
+enum AerodynamicGuidanceIndependentVariables
+{
+    time_guidance_variable,
+    altitude_guidance_variable,
+    airspeed_guidance_variable,
+    mach_number_guidance_variable,
+    specific_energy_guidance_variable
+};
+
+//! Aerodynamic guidance that interpolates the aerodynamic angles from a table
+/*!
+ * Aerodynamic guidance that interpolates the angle of attack, sideslip angle and bank angle from a table, indexed by
+ * time or by a quantity computed from the current flight conditions of the vehicle (altitude, airspeed, Mach number
+ * or specific energy). The guidance is fully evaluated in C++, so that it does not require any call to Python during
+ * the propagation.
+ *
+ * Optionally, the sign of the bank angle is reversed each time the independent variable passes one of a list of
+ * reversal values. The reversals are determined from the current value of the independent variable only (not from the
+ * history of the propagation), so that the guidance gives the same result for each evaluation of the state derivative
+ * at the same state. For this purpose, time is assumed to increase, and the other independent variables are assumed to
+ * decrease during the flight (as is the case for altitude, airspeed, Mach number and specific energy during an entry),
+ * so that a reversal at value v is active when the independent variable is below v.
+ */
+class TabulatedAerodynamicGuidance: public tudat::aerodynamics::AerodynamicGuidance
+{
+public:
+
+    //! Constructor
+    /*!
+     * Constructor
+     * \param vehicle Body for which the guidance is computed (only used if the guidance is not indexed by time)
+     * \param independentVariable Quantity by which the guidance table is indexed
+     * \param guidanceTable Angle of attack, sideslip angle and bank angle (in that order) as a function of the
+     * independent variable
+     * \param interpolatorSettings Settings for the interpolation of the guidance table
+     * \param bankReversalValues Values of the independent variable at which the sign of the bank angle is reversed
+     * \param centralBodyGravitationalParameter Gravitational parameter of the central body, used only for the
+     * specific energy
+     */
+    TabulatedAerodynamicGuidance(
+            const std::shared_ptr< tudat::simulation_setup::Body > vehicle,
+            const AerodynamicGuidanceIndependentVariables independentVariable,
+            const std::map< double, Eigen::Vector3d >& guidanceTable,
+            const std::shared_ptr< tudat::interpolators::InterpolatorSettings > interpolatorSettings,
+            const std::vector< double >& bankReversalValues = std::vector< double >( ),
+            const double centralBodyGravitationalParameter = TUDAT_NAN ):
+        vehicle_( vehicle ), independentVariable_( independentVariable ),
+        bankReversalValues_( bankReversalValues ),
+        centralBodyGravitationalParameter_( centralBodyGravitationalParameter )
+    {
+        if( guidanceTable.size( ) < 2 )
+        {
+            throw std::runtime_error( "Error when creating tabulated aerodynamic guidance, at least two table entries are required" );
+        }
+        if( independentVariable_ != time_guidance_variable && vehicle_.lock( ) == nullptr )
+        {
+            throw std::runtime_error( "Error when creating tabulated aerodynamic guidance, vehicle is required for guidance that is not indexed by time" );
+        }
+        if( independentVariable_ == specific_energy_guidance_variable && !( centralBodyGravitationalParameter_ > 0.0 ) )
+        {
+            throw std::runtime_error( "Error when creating tabulated aerodynamic guidance, gravitational parameter of central body is required for guidance indexed by specific energy" );
+        }
+
+        guidanceInterpolator_ = tudat::interpolators::createOneDimensionalInterpolator< double, Eigen::Vector3d >(
+                    guidanceTable, interpolatorSettings );
+        std::sort( bankReversalValues_.begin( ), bankReversalValues_.end( ) );
+    }
+
+    //! Function to update the aerodynamic angles to the current time and flight conditions
+    void updateGuidance( const double currentTime ) override
+    {
+        const double independentVariableValue = getIndependentVariableValue( currentTime );
+        const Eigen::Vector3d aerodynamicAngles = guidanceInterpolator_->interpolate( independentVariableValue );
+
+        currentAngleOfAttack_ = aerodynamicAngles( 0 );
+        currentAngleOfSideslip_ = aerodynamicAngles( 1 );
+        currentBankAngle_ = aerodynamicAngles( 2 );
+        if( getNumberOfActiveBankReversals( independentVariableValue ) % 2 == 1 )
+        {
+            currentBankAngle_ = -currentBankAngle_;
+        }
+    }
+
+    //! Function to retrieve the aerodynamic angles (angle of attack, sideslip angle, bank angle) at the given time
+    Eigen::Vector3d getAerodynamicAngles( const double currentTime )
+    {
+        updateGuidance( currentTime );
+        return ( Eigen::Vector3d( ) << currentAngleOfAttack_, currentAngleOfSideslip_, currentBankAngle_ ).finished( );
+    }
+
+    AerodynamicGuidanceIndependentVariables getIndependentVariable( )
+    {
+        return independentVariable_;
+    }
+
+    std::vector< double > getBankReversalValues( )
+    {
+        return bankReversalValues_;
+    }
+
+    //! Function to compute the number of bank reversals that are active at the given value of the independent variable
+    unsigned int getNumberOfActiveBankReversals( const double independentVariableValue )
+    {
+        if( independentVariable_ == time_guidance_variable )
+        {
+            return static_cast< unsigned int >(
+                        std::upper_bound( bankReversalValues_.begin( ), bankReversalValues_.end( ), independentVariableValue ) -
+                        bankReversalValues_.begin( ) );
+        }
+        else
+        {
+            return static_cast< unsigned int >(
+                        bankReversalValues_.end( ) -
+                        std::upper_bound( bankReversalValues_.begin( ), bankReversalValues_.end( ), independentVariableValue ) );
+        }
+    }
+
+private:
+
+    //! Function to compute the current value of the independent variable of the guidance table
+    double getIndependentVariableValue( const double currentTime )
+    {
+        if( independentVariable_ == time_guidance_variable )
+        {
+            return currentTime;
+        }
+
+        // Flight conditions are created with the acceleration models, after the guidance has been created
+        if( flightConditions_ == nullptr )
+        {
+            retrieveFlightConditions( );
+        }
+
+        switch( independentVariable_ )
+        {
+        case altitude_guidance_variable:
+            return flightConditions_->getCurrentAltitude( );
+        case airspeed_guidance_variable:
+            return flightConditions_->getCurrentAirspeed( );
+        case mach_number_guidance_variable:
+            return atmosphericFlightConditions_->getCurrentMachNumber( );
+        case specific_energy_guidance_variable:
+            return 0.5 * flightConditions_->getCurrentAirspeed( ) * flightConditions_->getCurrentAirspeed( ) -
+                    centralBodyGravitationalParameter_ /
+                    flightConditions_->getCurrentBodyCenteredBodyFixedState( ).segment( 0, 3 ).norm( );
+        default:
+            throw std::runtime_error( "Error in tabulated aerodynamic guidance, independent variable " +
+                                      std::to_string( independentVariable_ ) + " not recognized" );
+        }
+    }
+
+    void retrieveFlightConditions( )
+    {
+        const std::shared_ptr< tudat::simulation_setup::Body > vehicle = vehicle_.lock( );
+        if( vehicle == nullptr || vehicle->getFlightConditions( ) == nullptr )
+        {
+            throw std::runtime_error( "Error in tabulated aerodynamic guidance, vehicle has no flight conditions" );
+        }
+        flightConditions_ = vehicle->getFlightConditions( );
+
+        if( independentVariable_ == mach_number_guidance_variable )
+        {
+            atmosphericFlightConditions_ = std::dynamic_pointer_cast< tudat::aerodynamics::AtmosphericFlightConditions >(
+                        flightConditions_ );
+            if( atmosphericFlightConditions_ == nullptr )
+            {
+                throw std::runtime_error( "Error in tabulated aerodynamic guidance, guidance indexed by Mach number requires atmospheric flight conditions" );
+            }
+        }
+    }
+
+    //! Vehicle, stored as weak pointer since the guidance is (indirectly) stored in the vehicle's rotation model
+    std::weak_ptr< tudat::simulation_setup::Body > vehicle_;
+
+    AerodynamicGuidanceIndependentVariables independentVariable_;
+
+    std::shared_ptr< tudat::interpolators::OneDimensionalInterpolator< double, Eigen::Vector3d > > guidanceInterpolator_;
+
+    //! Values of the independent variable at which the sign of the bank angle is reversed (sorted)
+    std::vector< double > bankReversalValues_;
+
+    double centralBodyGravitationalParameter_;
+
+    std::shared_ptr< tudat::aerodynamics::FlightConditions > flightConditions_;
+
+    std::shared_ptr< tudat::aerodynamics::AtmosphericFlightConditions > atmosphericFlightConditions_;
+};
+
+//! Function to create a tabulated aerodynamic guidance for a body in a system of bodies
+/*!
+ * Function to create a tabulated aerodynamic guidance for a body in a system of bodies (see TabulatedAerodynamicGuidance)
+ * \param bodies System of bodies containing the vehicle
+ * \param bodyName Name of the vehicle
+ * \param centralBodyName Name of the body w.r.t. which the flight conditions are computed
+ * \param independentVariable Quantity by which the guidance table is indexed
+ * \param guidanceTable Angle of attack, sideslip angle and bank angle (in that order) as a function of the independent
+ * variable
+ * \param bankReversalValues Values of the independent variable at which the sign of the bank angle is reversed
+ * \param interpolatorSettings Settings for the interpolation of the guidance table (linear interpolation with the
+ * boundary values used outside of the table if nullptr)
+ * \return Tabulated aerodynamic guidance
+ */
+inline std::shared_ptr< TabulatedAerodynamicGuidance > createTabulatedAerodynamicGuidance(
+        const tudat::simulation_setup::SystemOfBodies& bodies,
+        const std::string& bodyName,
+        const std::string& centralBodyName,
+        const AerodynamicGuidanceIndependentVariables independentVariable,
+        const std::map< double, Eigen::Vector3d >& guidanceTable,
+        const std::vector< double >& bankReversalValues = std::vector< double >( ),
+        const std::shared_ptr< tudat::interpolators::InterpolatorSettings > interpolatorSettings = nullptr )
+{
+    double centralBodyGravitationalParameter = TUDAT_NAN;
+    if( independentVariable == specific_energy_guidance_variable )
+    {
+        if( bodies.at( centralBodyName )->getGravityFieldModel( ) == nullptr )
+        {
+            throw std::runtime_error( "Error when creating tabulated aerodynamic guidance indexed by specific energy, central body " +
+                                      centralBodyName + " has no gravity field" );
+        }
+        centralBodyGravitationalParameter = bodies.at( centralBodyName )->getGravityFieldModel( )->getGravitationalParameter( );
+    }
+
+    std::shared_ptr< tudat::interpolators::InterpolatorSettings > guidanceInterpolatorSettings = interpolatorSettings;
+    if( guidanceInterpolatorSettings == nullptr )
+    {
+        guidanceInterpolatorSettings = std::make_shared< tudat::interpolators::InterpolatorSettings >(
+                    tudat::interpolators::linear_interpolator, tudat::interpolators::huntingAlgorithm,
+                    false, tudat::interpolators::use_boundary_value );
+    }
+
+    return std::make_shared< TabulatedAerodynamicGuidance >(
+                bodies.at( bodyName ), independentVariable, guidanceTable, guidanceInterpolatorSettings,
+                bankReversalValues, centralBodyGravitationalParameter );
+}
+
+//! Function to retrieve the aerodynamic angles (angle of attack, sideslip angle, bank angle) from a guidance object
+inline Eigen::Vector3d getAerodynamicGuidanceAngles(
+        const std::shared_ptr< tudat::aerodynamics::AerodynamicGuidance > aerodynamicGuidance,
+        const double currentTime )
+{
+    aerodynamicGuidance->updateGuidance( currentTime );
+    return ( Eigen::Vector3d( ) << aerodynamicGuidance->getCurrentAngleOfAttack( ),
+             aerodynamicGuidance->getCurrentAngleOfSideslip( ),
+             aerodynamicGuidance->getCurrentBankAngle( ) ).finished( );
+}
+
+//! Function to create settings for a rotation model defined by the aerodynamic angles computed by a guidance object
+/*!
+ * Function to create settings for a rotation model defined by the aerodynamic angles computed by a guidance object. For
+ * a guidance object defined in C++ (e.g. TabulatedAerodynamicGuidance), the angles are computed without calling Python.
+ * \param centralBody Body w.r.t. which the aerodynamic angles are defined
+ * \param baseFrame Base frame of the rotation model
+ * \param targetFrame Target frame of the rotation model
+ * \param aerodynamicGuidance Guidance object computing the aerodynamic angles
+ * \return Rotation model settings
+ */
+inline std::shared_ptr< tudat::simulation_setup::RotationModelSettings > aerodynamicGuidanceRotationSettings(
+        const std::string& centralBody,
+        const std::string& baseFrame,
+        const std::string& targetFrame,
+        const std::shared_ptr< tudat::aerodynamics::AerodynamicGuidance > aerodynamicGuidance )
+{
+    if( aerodynamicGuidance == nullptr )
+    {
+        throw std::runtime_error( "Error when creating aerodynamic angle-based rotation model settings, no guidance provided" );
+    }
+    return tudat::simulation_setup::aerodynamicAngleRotationSettings(
+                centralBody, baseFrame, targetFrame,
+                std::bind( &getAerodynamicGuidanceAngles, aerodynamicGuidance, std::placeholders::_1 ) );
+}
+
+} // namespace tudatpy
+
+#endif // TUDATPY_TABULATED_AERODYNAMIC_GUIDANCE_H
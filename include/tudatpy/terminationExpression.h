@@ -0,0 +1,404 @@
+/*    Copyright (c) 2010-2022, Delft University of Technology
+ *    All rights reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ */
+
+#ifndef TUDATPY_TERMINATION_EXPRESSION_H
+#define TUDATPY_TERMINATION_EXPRESSION_H
+
+#include <cctype>
+#include <cstdlib>
+#include <map>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "tudat/simulation/propagation_setup/propagationTerminationSettings.h"
+
+namespace tudatpy
+{
+
+//! Types of nodes in a parsed termination expression
+enum TerminationExpressionNodeTypes
+{
+    comparison_termination_node,
+    conjunction_termination_node,
+    disjunction_termination_node,
+    negation_termination_node
+};
+
+//! Node of a parsed termination expression
+struct TerminationExpressionNode
+{
+    TerminationExpressionNode( const TerminationExpressionNodeTypes nodeType ):
+        nodeType_( nodeType ), limitValue_( 0.0 ), terminateBelowLimit_( false ){ }
+
+    TerminationExpressionNodeTypes nodeType_;
+
+    //! Name of the compared variable (comparison nodes only)
+    std::string variableName_;
+
+    //! Value to which the variable is compared (comparison nodes only)
+    double limitValue_;
+
+    //! Boolean denoting whether the condition is met when the variable is below the limit (comparison nodes only)
+    bool terminateBelowLimit_;
+
+    //! Operands (conjunction, disjunction and negation nodes only)
+    std::vector< std::shared_ptr< TerminationExpressionNode > > children_;
+};
+
+//! Recursive-descent parser for termination expressions
+/*!
+ * Recursive-descent parser for termination expressions, with the following grammar:
+ *
+ *  expression := conjunction ( ( "or" | "||" ) conjunction )*
+ *  conjunction := unary ( ( "and" | "&&" ) unary )*
+ *  unary := ( "not" | "!" ) unary | "(" expression ")" | comparison
+ *  comparison := variable ( "<" | "<=" | ">" | ">=" ) number | number ( "<" | "<=" | ">" | ">=" ) variable
+ *
+ * where a variable is an identifier ([A-Za-z_][A-Za-z0-9_]*), and a number is a floating-point literal.
+ */
+class TerminationExpressionParser
+{
+public:
+
+    TerminationExpressionParser( const std::string& expression ):
+        expression_( expression ), position_( 0 ){ }
+
+    //! Function to parse the complete expression
+    std::shared_ptr< TerminationExpressionNode > parse( )
+    {
+        std::shared_ptr< TerminationExpressionNode > rootNode = parseDisjunction( );
+        skipWhitespace( );
+        if( position_ != expression_.size( ) )
+        {
+            throwParseError( "unexpected input \"" + expression_.substr( position_ ) + "\"" );
+        }
+        return rootNode;
+    }
+
+private:
+
+    std::shared_ptr< TerminationExpressionNode > parseDisjunction( )
+    {
+        std::shared_ptr< TerminationExpressionNode > node = parseConjunction( );
+        while( matchKeyword( "or" ) || matchSymbol( "||" ) )
+        {
+            node = combineNodes( disjunction_termination_node, node, parseConjunction( ) );
+        }
+        return node;
+    }
+
+    std::shared_ptr< TerminationExpressionNode > parseConjunction( )
+    {
+        std::shared_ptr< TerminationExpressionNode > node = parseUnary( );
+        while( matchKeyword( "and" ) || matchSymbol( "&&" ) )
+        {
+            node = combineNodes( conjunction_termination_node, node, parseUnary( ) );
+        }
+        return node;
+    }
+
+    std::shared_ptr< TerminationExpressionNode > parseUnary( )
+    {
+        if( matchKeyword( "not" ) || matchSymbol( "!" ) )
+        {
+            std::shared_ptr< TerminationExpressionNode > node =
+                    std::make_shared< TerminationExpressionNode >( negation_termination_node );
+            node->children_.push_back( parseUnary( ) );
+            return node;
+        }
+        else if( matchSymbol( "(" ) )
+        {
+            std::shared_ptr< TerminationExpressionNode > node = parseDisjunction( );
+            if( !matchSymbol( ")" ) )
+            {
+                throwParseError( "expected \")\"" );
+            }
+            return node;
+        }
+        return parseComparison( );
+    }
+
+    std::shared_ptr< TerminationExpressionNode > parseComparison( )
+    {
+        std::shared_ptr< TerminationExpressionNode > node =
+                std::make_shared< TerminationExpressionNode >( comparison_termination_node );
+
+        double leftValue = 0.0;
+        const bool variableIsOnLeft = !parseNumber( leftValue );
+        if( variableIsOnLeft )
+        {
+            node->variableName_ = parseIdentifier( );
+        }
+
+        bool operatorIsLessThan = false;
+        if( matchSymbol( "<=" ) || matchSymbol( "<" ) )
+        {
+            operatorIsLessThan = true;
+        }
+        else if( matchSymbol( ">=" ) || matchSymbol( ">" ) )
+        {
+            operatorIsLessThan = false;
+        }
+        else
+        {
+            throwParseError( "expected comparison operator (<, <=, > or >=)" );
+        }
+
+        if( variableIsOnLeft )
+        {
+            if( !parseNumber( node->limitValue_ ) )
+            {
+                throwParseError( "expected number on right-hand side of comparison with " + node->variableName_ );
+            }
+            node->terminateBelowLimit_ = operatorIsLessThan;
+        }
+        else
+        {
+            node->variableName_ = parseIdentifier( );
+            node->limitValue_ = leftValue;
+            node->terminateBelowLimit_ = !operatorIsLessThan;
+        }
+        return node;
+    }
+
+    std::string parseIdentifier( )
+    {
+        skipWhitespace( );
+        const std::size_t startPosition = position_;
+        while( position_ < expression_.size( ) &&
+               ( std::isalpha( static_cast< unsigned char >( expression_.at( position_ ) ) ) ||
+                 expression_.at( position_ ) == '_' ||
+                 ( position_ > startPosition && std::isdigit( static_cast< unsigned char >( expression_.at( position_ ) ) ) ) ) )
+        {
+            position_++;
+        }
+        if( position_ == startPosition )
+        {
+            throwParseError( "expected variable name" );
+        }
+        return expression_.substr( startPosition, position_ - startPosition );
+    }
+
+    bool parseNumber( double& value )
+    {
+        skipWhitespace( );
+        if( position_ >= expression_.size( ) ||
+                !( std::isdigit( static_cast< unsigned char >( expression_.at( position_ ) ) ) ||
+                   expression_.at( position_ ) == '.' || expression_.at( position_ ) == '-' ||
+                   expression_.at( position_ ) == '+' ) )
+        {
+            return false;
+        }
+
+        const char* startPointer = expression_.c_str( ) + position_;
+        char* endPointer = nullptr;
+        value = std::strtod( startPointer, &endPointer );
+        if( endPointer == startPointer )
+        {
+            return false;
+        }
+        position_ += static_cast< std::size_t >( endPointer - startPointer );
+        return true;
+    }
+
+    bool matchSymbol( const std::string& symbol )
+    {
+        skipWhitespace( );
+        if( expression_.compare( position_, symbol.size( ), symbol ) == 0 )
+        {
+            position_ += symbol.size( );
+            return true;
+        }
+        return false;
+    }
+
+    //! Function to match a keyword, which must not be followed by an identifier character
+    bool matchKeyword( const std::string& keyword )
+    {
+        skipWhitespace( );
+        const std::size_t endPosition = position_ + keyword.size( );
+        if( expression_.compare( position_, keyword.size( ), keyword ) == 0 &&
+                ( endPosition == expression_.size( ) ||
+                  !( std::isalnum( static_cast< unsigned char >( expression_.at( endPosition ) ) ) ||
+                     expression_.at( endPosition ) == '_' ) ) )
+        {
+            position_ = endPosition;
+            return true;
+        }
+        return false;
+    }
+
+    void skipWhitespace( )
+    {
+        while( position_ < expression_.size( ) && std::isspace( static_cast< unsigned char >( expression_.at( position_ ) ) ) )
+        {
+            position_++;
+        }
+    }
+
+    //! Function to combine two nodes with a binary operator, merging operands of nested identical operators
+    static std::shared_ptr< TerminationExpressionNode > combineNodes(
+            const TerminationExpressionNodeTypes nodeType,
+            const std::shared_ptr< TerminationExpressionNode > leftNode,
+            const std::shared_ptr< TerminationExpressionNode > rightNode )
+    {
+        if( leftNode->nodeType_ == nodeType )
+        {
+            leftNode->children_.push_back( rightNode );
+            return leftNode;
+        }
+        std::shared_ptr< TerminationExpressionNode > node = std::make_shared< TerminationExpressionNode >( nodeType );
+        node->children_.push_back( leftNode );
+        node->children_.push_back( rightNode );
+        return node;
+    }
+
+    void throwParseError( const std::string& message )
+    {
+        throw std::runtime_error( "Error when parsing termination expression \"" + expression_ + "\" at position " +
+                                  std::to_string( position_ ) + ", " + message );
+    }
+
+    std::string expression_;
+
+    std::size_t position_;
+};
+
+//! Function to create termination settings from a node of a parsed termination expression
+/*!
+ * Function to create termination settings from a node of a parsed termination expression (see
+ * createTerminationSettingsFromExpression).
+ * \param node Node of the parsed expression
+ * \param dependentVariables Dependent variable settings (of size 1) for each variable name used in the expression
+ * \param isNegated Boolean denoting whether the node is negated
+ * \param terminateExactly Boolean denoting whether the propagation is to terminate exactly on the condition
+ * \param rootFinderSettings Settings for the root finder used for exact termination
+ * \param propagateBackwards Boolean denoting whether the propagation runs backwards in time
+ * \return Termination settings
+ */
+inline std::shared_ptr< tudat::propagators::PropagationTerminationSettings > createTerminationSettingsFromExpressionNode(
+        const std::shared_ptr< TerminationExpressionNode > node,
+        const std::map< std::string, std::shared_ptr< tudat::propagators::SingleDependentVariableSaveSettings > >& dependentVariables,
+        const bool isNegated,
+        const bool terminateExactly,
+        const std::shared_ptr< tudat::root_finders::RootFinderSettings > rootFinderSettings,
+        const bool propagateBackwards )
+{
+    switch( node->nodeType_ )
+    {
+    case negation_termination_node:
+        return createTerminationSettingsFromExpressionNode(
+                    node->children_.at( 0 ), dependentVariables, !isNegated, terminateExactly, rootFinderSettings,
+                    propagateBackwards );
+    case conjunction_termination_node:
+    case disjunction_termination_node:
+    {
+        // Negation is propagated to the operands (De Morgan); a conjunction requires all operands to be met
+        const bool fulfillSingleCondition = ( ( node->nodeType_ == disjunction_termination_node ) != isNegated );
+        std::vector< std::shared_ptr< tudat::propagators::PropagationTerminationSettings > > operandSettings;
+        for( unsigned int i = 0; i < node->children_.size( ); i++ )
+        {
+            operandSettings.push_back( createTerminationSettingsFromExpressionNode(
+                                           node->children_.at( i ), dependentVariables, isNegated,
+                                           terminateExactly && fulfillSingleCondition, rootFinderSettings,
+                                           propagateBackwards ) );
+        }
+        return tudat::propagators::propagationHybridTerminationSettings( operandSettings, fulfillSingleCondition );
+    }
+    case comparison_termination_node:
+    {
+        const bool terminateBelowLimit = ( node->terminateBelowLimit_ != isNegated );
+        if( dependentVariables.count( node->variableName_ ) > 0 )
+        {
+            return tudat::propagators::propagationDependentVariableTerminationSettings(
+                        dependentVariables.at( node->variableName_ ), node->limitValue_, terminateBelowLimit,
+                        terminateExactly, rootFinderSettings );
+        }
+        else if( node->variableName_ == "time" )
+        {
+            // Time termination is met when passing the limit in the direction of propagation, so that only a comparison
+            // in that direction (time > a forwards, time < a backwards) can be expressed
+            if( terminateBelowLimit != propagateBackwards )
+            {
+                throw std::runtime_error(
+                            "Error when creating termination settings from expression, time can only be compared as " +
+                            std::string( propagateBackwards ? "lower" : "upper" ) + " limit for a propagation that runs " +
+                            std::string( propagateBackwards ? "backwards" : "forwards" ) + " in time (after negations "
+                            "are applied), since the condition would otherwise be met from the start of the propagation" );
+            }
+            return tudat::propagators::propagationTimeTerminationSettings( node->limitValue_, terminateExactly );
+        }
+        else if( node->variableName_ == "cpu_time" )
+        {
+            if( terminateBelowLimit )
+            {
+                throw std::runtime_error( "Error when creating termination settings from expression, cpu_time can only be used as upper limit" );
+            }
+            return tudat::propagators::propagationCPUTimeTerminationSettings( node->limitValue_ );
+        }
+        throw std::runtime_error( "Error when creating termination settings from expression, variable " +
+                                  node->variableName_ + " is not defined" );
+    }
+    default:
+        throw std::runtime_error( "Error when creating termination settings from expression, node type " +
+                                  std::to_string( node->nodeType_ ) + " not recognized" );
+    }
+}
+
+//! Function to create termination settings from a termination expression
+/*!
+ * Function to create termination settings from a termination expression, such as
+ * "altitude < 25.0E3 or ( mach < 3.0 and time > 1200.0 )". The expression is parsed once (see
+ * TerminationExpressionParser), and converted to the native termination settings: each comparison becomes a dependent
+ * variable termination condition (or a time or CPU time termination condition for the reserved names time and
+ * cpu_time), and boolean combinations become hybrid termination conditions. Negations are propagated to the
+ * comparisons, reversing their direction. All conditions are therefore evaluated in C++ during the propagation.
+ *
+ * Each comparison is met once the variable is on the given side of the limit (the distinction between strict and
+ * non-strict comparisons is not used), so that "x < a" terminates the propagation when x crosses a in negative direction,
+ * and "x > a" when x crosses a in positive direction. A comparison of time is met when passing the limit in the direction
+ * of propagation; it must therefore be "time > a" for a forward propagation, and "time < a" for a backward propagation
+ * (after negations are applied), otherwise an exception is thrown. If exact termination is requested, the time at which a comparison is met is found using a root finder,
+ * for all comparisons that are not part of a conjunction ("and").
+ * \param expression Termination expression
+ * \param dependentVariables Dependent variable settings (of size 1) for each variable name used in the expression
+ * \param terminateExactlyOnFinalCondition Boolean denoting whether the propagation is to terminate exactly on the
+ * condition that is met
+ * \param rootFinderSettings Settings for the root finder used for exact termination
+ * \param propagateBackwards Boolean denoting whether the propagation runs backwards in time (negative time step)
+ * \return Termination settings
+ */
+inline std::shared_ptr< tudat::propagators::PropagationTerminationSettings > createTerminationSettingsFromExpression(
+        const std::string& expression,
+        const std::map< std::string, std::shared_ptr< tudat::propagators::SingleDependentVariableSaveSettings > >& dependentVariables =
+        std::map< std::string, std::shared_ptr< tudat::propagators::SingleDependentVariableSaveSettings > >( ),
+        const bool terminateExactlyOnFinalCondition = false,
+        const std::shared_ptr< tudat::root_finders::RootFinderSettings > rootFinderSettings = nullptr,
+        const bool propagateBackwards = false )
+{
+    for( auto variableIterator : dependentVariables )
+    {
+        if( variableIterator.first == "time" || variableIterator.first == "cpu_time" )
+        {
+            throw std::runtime_error( "Error when creating termination settings from expression, variable name " +
+                                      variableIterator.first + " is reserved" );
+        }
+    }
+
+    return createTerminationSettingsFromExpressionNode(
+                TerminationExpressionParser( expression ).parse( ), dependentVariables, false,
+                terminateExactlyOnFinalCondition, rootFinderSettings, propagateBackwards );
+}
+
+} // namespace tudatpy
+
+#endif // TUDATPY_TERMINATION_EXPRESSION_H
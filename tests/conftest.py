@@ -0,0 +1,22 @@
+import numpy as np
+import pytest
+
+from tudatpy.kernel.numerical_simulation import environment_setup
+
+
+@pytest.fixture
+def create_bodies():
+    """ Factory of a system of bodies with a point-mass Earth, fixed at the origin of the J2000 frame, and an empty
+    Satellite to propagate; each call creates new bodies, so that tests can give each simulation its own environment
+    """
+    def create_earth_and_satellite(earth_gravitational_parameter):
+        body_settings = environment_setup.BodyListSettings("Earth", "J2000")
+        body_settings.add_empty_settings("Earth")
+        body_settings.get("Earth").gravity_field_settings = environment_setup.gravity_field.central(
+            earth_gravitational_parameter)
+        body_settings.get("Earth").ephemeris_settings = environment_setup.ephemeris.constant(
+            np.zeros(6), "Earth", "J2000")
+        body_settings.add_empty_settings("Satellite")
+        return environment_setup.create_system_of_bodies(body_settings)
+
+    return create_earth_and_satellite
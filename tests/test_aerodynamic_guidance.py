@@ -0,0 +1,104 @@
+import numpy as np
+import pytest
+
+from tudatpy.kernel import numerical_simulation
+from tudatpy.kernel.astro import element_conversion
+from tudatpy.kernel.numerical_simulation import environment_setup, propagation, propagation_setup
+
+EARTH_GRAVITATIONAL_PARAMETER = 3.986004418E14
+EARTH_RADIUS = 6378.0E3
+EARTH_ROTATION_RATE = 7.292115E-5
+
+
+def create_bodies():
+    body_settings = environment_setup.BodyListSettings("Earth", "J2000")
+    body_settings.add_empty_settings("Earth")
+    body_settings.get("Earth").gravity_field_settings = environment_setup.gravity_field.central(
+        EARTH_GRAVITATIONAL_PARAMETER)
+    body_settings.get("Earth").ephemeris_settings = environment_setup.ephemeris.constant(np.zeros(6), "Earth", "J2000")
+    body_settings.get("Earth").shape_settings = environment_setup.shape.spherical(EARTH_RADIUS)
+    body_settings.get("Earth").rotation_model_settings = environment_setup.rotation_model.simple(
+        "J2000", "Earth_Fixed", np.eye(3), 0.0, EARTH_ROTATION_RATE)
+    body_settings.get("Earth").atmosphere_settings = environment_setup.atmosphere.exponential(7200.0, 1.225)
+    body_settings.add_empty_settings("Vehicle")
+    body_settings.get("Vehicle").constant_mass = 500.0
+    body_settings.get("Vehicle").aerodynamic_coefficient_settings = environment_setup.aerodynamic_coefficients.constant(
+        2.0, np.array([1.5, 0.0, 0.3]))
+    return environment_setup.create_system_of_bodies(body_settings)
+
+
+def interpolate_table(guidance_table, value):
+    independent_variables = sorted(guidance_table.keys())
+    return np.array([np.interp(value, independent_variables, [guidance_table[key][i] for key in independent_variables])
+                     for i in range(3)])
+
+
+def test_time_guidance_with_bank_reversals():
+    bodies = create_bodies()
+    guidance_table = {0.0: np.array([0.1, 0.0, 0.4]), 100.0: np.array([0.3, 0.05, 0.8])}
+    guidance = propagation.tabulated_aerodynamic_guidance(
+        bodies, "Vehicle", "Earth", propagation.time_guidance_variable, guidance_table, bank_reversal_values=[60.0, 30.0])
+    assert guidance.independent_variable == propagation.time_guidance_variable
+    assert guidance.bank_reversal_values == [30.0, 60.0]
+
+    # A reversal is active at and after its epoch, and the angles outside the table are its boundary values; epochs are
+    # evaluated out of order, since the reversals depend on the current epoch only
+    for time, number_of_reversals in [(10.0, 0), (30.0, 1), (45.0, 1), (10.0, 0), (60.0, 2), (90.0, 2), (150.0, 2),
+                                      (-10.0, 0)]:
+        expected_angles = interpolate_table(guidance_table, time)
+        expected_angles[2] *= (-1.0) ** number_of_reversals
+        np.testing.assert_allclose(guidance.aerodynamic_angles(time), expected_angles, rtol=0.0, atol=1.0E-15)
+
+
+def test_guidance_checks_input():
+    bodies = create_bodies()
+    with pytest.raises(RuntimeError, match="at least two table entries"):
+        propagation.tabulated_aerodynamic_guidance(
+            bodies, "Vehicle", "Earth", propagation.time_guidance_variable, {0.0: np.zeros(3)})
+
+
+def test_altitude_guidance_in_entry_propagation():
+    bodies = create_bodies()
+    guidance_table = {0.0: np.array([0.2, 0.0, 0.3]), 150.0E3: np.array([0.5, 0.0, 1.2])}
+    bank_reversal_altitudes = [110.0E3, 95.0E3]
+    guidance = propagation.tabulated_aerodynamic_guidance(
+        bodies, "Vehicle", "Earth", propagation.altitude_guidance_variable, guidance_table,
+        bank_reversal_values=bank_reversal_altitudes)
+    environment_setup.add_rotation_model(
+        bodies, "Vehicle", environment_setup.rotation_model.aerodynamic_angle_based(
+            "Earth", "J2000", "Vehicle_Fixed", guidance))
+
+    acceleration_models = propagation_setup.create_acceleration_models(
+        bodies, {"Vehicle": {"Earth": [propagation_setup.acceleration.point_mass_gravity(),
+                                       propagation_setup.acceleration.aerodynamic()]}},
+        ["Vehicle"], ["Earth"])
+    initial_state = element_conversion.spherical_to_cartesian_elementwise(
+        radial_distance=EARTH_RADIUS + 120.0E3, latitude=0.0, longitude=0.0, speed=7.5E3,
+        flight_path_angle=np.deg2rad(-2.0), heading_angle=np.deg2rad(90.0))
+    dependent_variables = [
+        propagation_setup.dependent_variable.altitude("Vehicle", "Earth"),
+        propagation_setup.dependent_variable.angle_of_attack("Vehicle", "Earth"),
+        propagation_setup.dependent_variable.sideslip_angle("Vehicle", "Earth"),
+        propagation_setup.dependent_variable.bank_angle("Vehicle", "Earth")]
+    integrator_settings = propagation_setup.integrator.runge_kutta_fixed_step_size(
+        1.0, propagation_setup.integrator.CoefficientSets.rk_4)
+    propagator_settings = propagation_setup.propagator.translational(
+        ["Earth"], acceleration_models, ["Vehicle"], initial_state, 0.0, integrator_settings,
+        propagation_setup.propagator.time_termination(150.0), output_variables=dependent_variables)
+    dependent_variable_history = numerical_simulation.create_dynamics_simulator(
+        bodies, propagator_settings).propagation_results.dependent_variable_history
+
+    # The angles of the vehicle orientation are those of the table at the current altitude, with the sign of the bank
+    # angle reversed below each reversal altitude
+    number_of_reversals_reached = set()
+    for dependent_variables in dependent_variable_history.values():
+        altitude = dependent_variables[0]
+        number_of_reversals = sum(altitude < reversal_altitude for reversal_altitude in bank_reversal_altitudes)
+        number_of_reversals_reached.add(number_of_reversals)
+
+        expected_angles = interpolate_table(guidance_table, altitude)
+        expected_angles[2] *= (-1.0) ** number_of_reversals
+        np.testing.assert_allclose(dependent_variables[1:], expected_angles, rtol=0.0, atol=1.0E-10)
+
+    # The entry passes both reversal altitudes
+    assert number_of_reversals_reached == {0, 1, 2}
@@ -0,0 +1,116 @@
+import numpy as np
+import pytest
+
+from tudatpy.kernel import numerical_simulation
+from tudatpy.kernel.astro import element_conversion
+from tudatpy.kernel.numerical_simulation import propagation_setup
+
+EARTH_GRAVITATIONAL_PARAMETER = 3.986004418E14
+INITIAL_TIME = 0.0
+FINAL_TIME = 6000.0
+
+
+def create_propagator_settings(bodies, semi_major_axis):
+    acceleration_models = propagation_setup.create_acceleration_models(
+        bodies, {"Satellite": {"Earth": [propagation_setup.acceleration.point_mass_gravity()]}},
+        ["Satellite"], ["Earth"])
+    initial_state = element_conversion.keplerian_to_cartesian_elementwise(
+        semi_major_axis=semi_major_axis, eccentricity=0.01, inclination=np.deg2rad(50.0),
+        argument_of_periapsis=0.0, longitude_of_ascending_node=0.0, true_anomaly=0.0,
+        gravitational_parameter=EARTH_GRAVITATIONAL_PARAMETER)
+    integrator_settings = propagation_setup.integrator.runge_kutta_fixed_step_size(
+        10.0, propagation_setup.integrator.CoefficientSets.rk_4)
+    return propagation_setup.propagator.translational(
+        ["Earth"], acceleration_models, ["Satellite"], initial_state, INITIAL_TIME, integrator_settings,
+        propagation_setup.propagator.time_termination(FINAL_TIME))
+
+
+def create_batch_settings(create_bodies, number_of_samples):
+    # The acceleration models in the propagator settings are bound to the bodies for which they were created, so that the
+    # factory passed to the batch propagation must return these bodies for each sample
+    sample_bodies = [create_bodies(EARTH_GRAVITATIONAL_PARAMETER) for _ in range(number_of_samples)]
+    propagator_settings_list = [
+        create_propagator_settings(sample_bodies[i], 7000.0E3 + 100.0E3 * i) for i in range(number_of_samples)]
+    return sample_bodies, propagator_settings_list
+
+
+def test_batch_propagation_matches_serial_propagation(create_bodies):
+    number_of_samples = 6
+    sample_bodies, propagator_settings_list = create_batch_settings(create_bodies, number_of_samples)
+
+    batch_results = numerical_simulation.propagate_batch(
+        lambda sample_index: sample_bodies[sample_index], propagator_settings_list, number_of_threads=3)
+
+    assert batch_results.number_of_failed_propagations == 0
+    assert batch_results.propagation_succeeded == [True] * number_of_samples
+    assert batch_results.failure_messages == [""] * number_of_samples
+
+    serial_bodies, serial_propagator_settings_list = create_batch_settings(create_bodies, number_of_samples)
+    for i in range(number_of_samples):
+        serial_simulator = numerical_simulation.create_dynamics_simulator(
+            serial_bodies[i], serial_propagator_settings_list[i])
+
+        # Each sample is propagated by the same sequence of operations, whichever thread runs it
+        np.testing.assert_array_equal(
+            batch_results.propagation_results[i].state_array,
+            serial_simulator.propagation_results.state_array)
+
+
+def test_batch_propagation_reports_failed_samples(create_bodies):
+    number_of_samples = 3
+    sample_bodies, propagator_settings_list = create_batch_settings(create_bodies, number_of_samples)
+
+    def bodies_factory(sample_index):
+        if sample_index == 1:
+            raise RuntimeError("no bodies for sample 1")
+        return sample_bodies[sample_index]
+
+    batch_results = numerical_simulation.propagate_batch(
+        bodies_factory, propagator_settings_list, number_of_threads=2)
+
+    # A failing sample is reported, and does not affect the other samples
+    assert batch_results.number_of_failed_propagations == 1
+    assert batch_results.propagation_succeeded == [True, False, True]
+    assert "no bodies for sample 1" in batch_results.failure_messages[1]
+    assert batch_results.failure_messages[0] == ""
+    assert batch_results.failure_messages[2] == ""
+    assert batch_results.propagation_results[1] is None
+    assert batch_results.propagation_results[0].state_array[-1, 0] == pytest.approx(FINAL_TIME, abs=10.0)
+
+
+def test_batch_propagation_on_single_thread_allows_shared_bodies(create_bodies):
+    number_of_samples = 4
+    shared_bodies = create_bodies(EARTH_GRAVITATIONAL_PARAMETER)
+    propagator_settings_list = [
+        create_propagator_settings(shared_bodies, 7000.0E3 + 100.0E3 * i) for i in range(number_of_samples)]
+
+    # With a single thread, the samples do not run concurrently, so that the same bodies may be reused
+    batch_results = numerical_simulation.propagate_batch(
+        lambda sample_index: shared_bodies, propagator_settings_list, number_of_threads=1)
+    assert batch_results.number_of_failed_propagations == 0
+
+
+def test_reset_initial_state_overwrites_results(create_bodies):
+    bodies = create_bodies(EARTH_GRAVITATIONAL_PARAMETER)
+    propagator_settings = create_propagator_settings(bodies, 7000.0E3)
+    integrator_settings = propagation_setup.integrator.runge_kutta_fixed_step_size(
+        10.0, propagation_setup.integrator.CoefficientSets.rk_4)
+    dynamics_simulator = numerical_simulation.SingleArcSimulator(bodies, integrator_settings, propagator_settings)
+    initial_states = np.vstack([
+        create_propagator_settings(create_bodies(EARTH_GRAVITATIONAL_PARAMETER), semi_major_axis).initial_states
+        for semi_major_axis in [7500.0E3, 8000.0E3]])
+
+    # The returned results are the results object of the simulator, which the next propagation overwrites in place
+    first_results = dynamics_simulator.reset_initial_state_and_propagate(initial_states[0])
+    first_state_array = first_results.state_array
+    second_results = dynamics_simulator.reset_initial_state_and_propagate(initial_states[1])
+    assert second_results is first_results
+    assert second_results is dynamics_simulator.propagation_results
+    assert not np.array_equal(first_results.state_array, first_state_array)
+
+    # The results of a batch of propagations are copied, and are not overwritten by the later propagations
+    batch_results = dynamics_simulator.reset_initial_states_and_propagate(initial_states)
+    assert batch_results.number_of_failed_propagations == 0
+    np.testing.assert_array_equal(batch_results.propagation_results[0].state_array, first_state_array)
+    np.testing.assert_array_equal(
+        batch_results.propagation_results[1].state_array, dynamics_simulator.propagation_results.state_array)
@@ -0,0 +1,79 @@
+import numpy as np
+import pytest
+
+from tudatpy.kernel import numerical_simulation
+from tudatpy.kernel.astro import element_conversion
+from tudatpy.kernel.numerical_simulation import environment_setup, propagation_setup
+
+EARTH_GRAVITATIONAL_PARAMETER = 3.986004418E14
+FORCE_COEFFICIENTS = np.array([1.2, 0.1, 0.3])
+REFERENCE_AREA = 4.0
+RADIATION_PRESSURE_COEFFICIENT = 1.5
+
+
+def create_bodies(occulting_bodies=[]):
+    body_settings = environment_setup.BodyListSettings("Earth", "J2000")
+    body_settings.add_empty_settings("Earth")
+    body_settings.get("Earth").gravity_field_settings = environment_setup.gravity_field.central(
+        EARTH_GRAVITATIONAL_PARAMETER)
+    body_settings.get("Earth").ephemeris_settings = environment_setup.ephemeris.constant(
+        np.zeros(6), "Earth", "J2000")
+    body_settings.get("Earth").shape_settings = environment_setup.shape.spherical(6378.0E3)
+    body_settings.add_empty_settings("Sun")
+    body_settings.get("Sun").ephemeris_settings = environment_setup.ephemeris.constant(
+        np.array([1.496E11, 0.0, 0.0, 0.0, 0.0, 0.0]), "Earth", "J2000")
+    body_settings.add_empty_settings("Satellite")
+    body_settings.get("Satellite").constant_mass = 100.0
+    body_settings.get("Satellite").aerodynamic_coefficient_settings = environment_setup.aerodynamic_coefficients.constant(
+        REFERENCE_AREA, FORCE_COEFFICIENTS)
+    body_settings.get("Satellite").radiation_pressure_settings = {
+        "Sun": environment_setup.radiation_pressure.cannonball(
+            "Sun", REFERENCE_AREA, RADIATION_PRESSURE_COEFFICIENT, occulting_bodies)}
+    return environment_setup.create_system_of_bodies(body_settings)
+
+
+def propagate(bodies):
+    acceleration_models = propagation_setup.create_acceleration_models(
+        bodies, {"Satellite": {"Earth": [propagation_setup.acceleration.point_mass_gravity()],
+                               "Sun": [propagation_setup.acceleration.cannonball_radiation_pressure()]}},
+        ["Satellite"], ["Earth"])
+    initial_state = element_conversion.keplerian_to_cartesian_elementwise(
+        semi_major_axis=8000.0E3, eccentricity=0.01, inclination=np.deg2rad(30.0),
+        argument_of_periapsis=0.0, longitude_of_ascending_node=0.0, true_anomaly=0.0,
+        gravitational_parameter=EARTH_GRAVITATIONAL_PARAMETER)
+    integrator_settings = propagation_setup.integrator.runge_kutta_fixed_step_size(
+        10.0, propagation_setup.integrator.CoefficientSets.rk_4)
+    propagator_settings = propagation_setup.propagator.translational(
+        ["Earth"], acceleration_models, ["Satellite"], initial_state, 0.0, integrator_settings,
+        propagation_setup.propagator.time_termination(3000.0))
+    return numerical_simulation.create_dynamics_simulator(bodies, propagator_settings).propagation_results.state_array
+
+
+def test_clone_shares_aerodynamic_coefficients():
+    bodies = create_bodies()
+    cloned_bodies = bodies.clone()
+
+    # The clone evaluates the shared coefficients, and stores them separately from the original
+    original_interface = bodies.get("Satellite").aerodynamic_coefficient_interface
+    cloned_interface = cloned_bodies.get("Satellite").aerodynamic_coefficient_interface
+    assert cloned_interface is not original_interface
+    assert cloned_interface.reference_area == REFERENCE_AREA
+    cloned_interface.update_coefficients([], 0.0)
+    np.testing.assert_array_equal(cloned_interface.current_force_coefficients, FORCE_COEFFICIENTS)
+
+
+def test_clone_recreates_radiation_pressure_interface():
+    bodies = create_bodies()
+    cloned_bodies = bodies.clone()
+
+    # The radiation pressure of the clone is computed from the positions of the cloned bodies
+    np.testing.assert_array_equal(propagate(cloned_bodies), propagate(bodies))
+
+
+def test_radiation_pressure_with_occultation_is_not_cloned():
+    bodies = create_bodies(occulting_bodies=["Earth"])
+    with pytest.raises(RuntimeError, match="radiation pressure interface \\(with occulting bodies\\) of Satellite"):
+        bodies.clone()
+
+    cloned_bodies = bodies.clone(skip_models_not_cloned=True)
+    assert cloned_bodies.get("Satellite").aerodynamic_coefficient_interface is not None
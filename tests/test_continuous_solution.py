@@ -0,0 +1,77 @@
+import numpy as np
+
+from tudatpy.kernel import numerical_simulation
+from tudatpy.kernel.astro import element_conversion, two_body_dynamics
+from tudatpy.kernel.numerical_simulation import propagation_setup
+
+EARTH_GRAVITATIONAL_PARAMETER = 3.986004418E14
+INITIAL_TIME = 0.0
+FINAL_TIME = 6000.0
+TIME_STEP = 60.0
+INITIAL_KEPLER_ELEMENTS = np.array([7000.0E3, 0.1, np.deg2rad(30.0), np.deg2rad(40.0), np.deg2rad(10.0), 0.0])
+
+# Lagrange interpolation through 8 nodes, with about 100 integration steps per orbit
+POSITION_TOLERANCE = 1.0E-3
+VELOCITY_TOLERANCE = 1.0E-6
+
+
+def create_stepwise_simulator(create_bodies):
+    bodies = create_bodies(EARTH_GRAVITATIONAL_PARAMETER)
+    acceleration_models = propagation_setup.create_acceleration_models(
+        bodies, {"Satellite": {"Earth": [propagation_setup.acceleration.point_mass_gravity()]}},
+        ["Satellite"], ["Earth"])
+    initial_state = element_conversion.keplerian_to_cartesian(INITIAL_KEPLER_ELEMENTS, EARTH_GRAVITATIONAL_PARAMETER)
+    integrator_settings = propagation_setup.integrator.runge_kutta_fixed_step_size(
+        TIME_STEP, propagation_setup.integrator.CoefficientSets.rkf_78)
+    processing_settings = propagation_setup.propagator.ExtendedSingleArcPropagatorProcessingSettings(
+        create_continuous_solution=True)
+    propagator_settings = propagation_setup.propagator.translational(
+        ["Earth"], acceleration_models, ["Satellite"], initial_state, INITIAL_TIME, integrator_settings,
+        propagation_setup.propagator.time_termination(FINAL_TIME), processing_settings=processing_settings)
+    return numerical_simulation.SingleArcStepwiseSimulator(bodies, propagator_settings)
+
+
+def compute_analytic_state(epoch):
+    kepler_elements = two_body_dynamics.propagate_kepler_orbit(
+        INITIAL_KEPLER_ELEMENTS, epoch - INITIAL_TIME, EARTH_GRAVITATIONAL_PARAMETER)
+    return element_conversion.keplerian_to_cartesian(kepler_elements, EARTH_GRAVITATIONAL_PARAMETER)
+
+
+def test_continuous_solution_matches_analytic_orbit(create_bodies):
+    dynamics_simulator = create_stepwise_simulator(create_bodies)
+    dynamics_simulator.initialize_propagation()
+    while not dynamics_simulator.is_terminated:
+        dynamics_simulator.step()
+
+    continuous_solution = dynamics_simulator.continuous_solution
+    assert continuous_solution.start_epoch == INITIAL_TIME
+    assert continuous_solution.end_epoch == FINAL_TIME
+
+    # Epochs inside the integration steps, including the first and last steps (where the nodes are not centered)
+    for epoch in np.arange(INITIAL_TIME + 13.7, FINAL_TIME, 97.3):
+        analytic_state = compute_analytic_state(epoch)
+        state = continuous_solution(epoch)
+        np.testing.assert_allclose(state[:3], analytic_state[:3], rtol=0.0, atol=POSITION_TOLERANCE)
+        np.testing.assert_allclose(state[3:], analytic_state[3:], rtol=0.0, atol=VELOCITY_TOLERANCE)
+
+
+def test_continuous_solution_with_modified_state(create_bodies):
+    dynamics_simulator = create_stepwise_simulator(create_bodies)
+    dynamics_simulator.initialize_propagation()
+    dynamics_simulator.step(20)
+    modification_time = dynamics_simulator.current_time
+    state_before_modification = dynamics_simulator.current_state
+    velocity_change = np.array([0.0, 0.0, 0.0, 10.0, -5.0, 2.0])
+    dynamics_simulator.modify_current_state(state_before_modification + velocity_change)
+    while not dynamics_simulator.is_terminated:
+        dynamics_simulator.step()
+
+    # At the time of the modification, the state after the modification is returned, and the solution before it is
+    # interpolated without the nodes after it
+    continuous_solution = dynamics_simulator.continuous_solution
+    np.testing.assert_array_equal(
+        continuous_solution(modification_time), state_before_modification + velocity_change)
+    before_epoch = modification_time - 0.5 * TIME_STEP
+    analytic_state = compute_analytic_state(before_epoch)
+    np.testing.assert_allclose(
+        continuous_solution(before_epoch)[:3], analytic_state[:3], rtol=0.0, atol=POSITION_TOLERANCE)
@@ -0,0 +1,76 @@
+import numpy as np
+import pytest
+
+from tudatpy.kernel import numerical_simulation
+from tudatpy.kernel.astro import element_conversion
+from tudatpy.kernel.numerical_simulation import propagation_setup
+
+EARTH_GRAVITATIONAL_PARAMETER = 3.986004418E14
+INITIAL_TIME = 0.0
+FINAL_TIME = 3000.0
+
+
+def create_dependent_variables():
+    return [propagation_setup.dependent_variable.relative_distance("Satellite", "Earth"),
+            propagation_setup.dependent_variable.total_acceleration("Satellite")]
+
+
+def create_propagator_settings(bodies, output_variables=[]):
+    acceleration_models = propagation_setup.create_acceleration_models(
+        bodies, {"Satellite": {"Earth": [propagation_setup.acceleration.point_mass_gravity()]}},
+        ["Satellite"], ["Earth"])
+    initial_state = element_conversion.keplerian_to_cartesian_elementwise(
+        semi_major_axis=7500.0E3, eccentricity=0.1, inclination=np.deg2rad(60.0),
+        argument_of_periapsis=0.0, longitude_of_ascending_node=0.0, true_anomaly=0.0,
+        gravitational_parameter=EARTH_GRAVITATIONAL_PARAMETER)
+    integrator_settings = propagation_setup.integrator.runge_kutta_fixed_step_size(
+        10.0, propagation_setup.integrator.CoefficientSets.rk_4)
+    return propagation_setup.propagator.translational(
+        ["Earth"], acceleration_models, ["Satellite"], initial_state, INITIAL_TIME, integrator_settings,
+        propagation_setup.propagator.time_termination(FINAL_TIME), output_variables=output_variables)
+
+
+def test_dependent_variables_match_propagation(create_bodies):
+    bodies = create_bodies(EARTH_GRAVITATIONAL_PARAMETER)
+    dynamics_simulator = numerical_simulation.create_dynamics_simulator(
+        bodies, create_propagator_settings(bodies, create_dependent_variables()))
+
+    dependent_variables = numerical_simulation.compute_dependent_variables(
+        dynamics_simulator, create_dependent_variables())
+    dependent_variable_history = dynamics_simulator.propagation_results.dependent_variable_history
+    np.testing.assert_array_equal(dependent_variables[:, 0], list(dependent_variable_history.keys()))
+    for row in dependent_variables:
+        np.testing.assert_allclose(row[1:], dependent_variable_history[row[0]], rtol=1.0E-14)
+
+
+def test_parallel_evaluation_on_cloned_bodies(create_bodies):
+    bodies = create_bodies(EARTH_GRAVITATIONAL_PARAMETER)
+    dynamics_simulator = numerical_simulation.create_dynamics_simulator(bodies, create_propagator_settings(bodies))
+    epochs = list(np.linspace(INITIAL_TIME + 5.0, FINAL_TIME - 5.0, 101))
+
+    def create_worker_simulator(worker_index):
+        worker_bodies = bodies.clone()
+        return numerical_simulation.create_dynamics_simulator(
+            worker_bodies, create_propagator_settings(worker_bodies), simulate_dynamics_on_creation=False)
+
+    sequential_dependent_variables = numerical_simulation.compute_dependent_variables(
+        dynamics_simulator, create_dependent_variables(), epochs)
+    parallel_dependent_variables = numerical_simulation.compute_dependent_variables(
+        dynamics_simulator, create_dependent_variables(), epochs,
+        worker_simulator_factory=create_worker_simulator, number_of_threads=4)
+
+    # Each epoch is evaluated by the same operations, whichever simulator evaluates it, and the environment of the
+    # dynamics simulator is left at the last epoch
+    np.testing.assert_array_equal(parallel_dependent_variables, sequential_dependent_variables)
+    assert np.linalg.norm(bodies.get("Satellite").position) == pytest.approx(
+        parallel_dependent_variables[-1, 1], rel=1.0E-15)
+
+
+def test_worker_simulators_must_not_share_bodies(create_bodies):
+    bodies = create_bodies(EARTH_GRAVITATIONAL_PARAMETER)
+    dynamics_simulator = numerical_simulation.create_dynamics_simulator(bodies, create_propagator_settings(bodies))
+
+    with pytest.raises(RuntimeError, match="each simulator must have its own system of bodies"):
+        numerical_simulation.compute_dependent_variables(
+            dynamics_simulator, create_dependent_variables(),
+            worker_simulator_factory=lambda worker_index: dynamics_simulator, number_of_threads=2)
@@ -0,0 +1,215 @@
+import numpy as np
+
+from tudatpy.kernel import numerical_simulation
+from tudatpy.kernel.astro import element_conversion
+from tudatpy.kernel.numerical_simulation import environment_setup, propagation_setup
+
+EARTH_GRAVITATIONAL_PARAMETER = 3.986004418E14
+EARTH_RADIUS = 6378.0E3
+EARTH_ROTATION_RATE = 7.292115E-5
+SUN_RADIUS = 6.96E8
+SUN_DISTANCE = 1.496E11
+INITIAL_TIME = 0.0
+EPOCH_TOLERANCE = 1.0E-3
+
+
+def create_earth_sun_and_satellite():
+    # Spherical Earth, rotating about the z-axis of the J2000 frame, and a spherical Sun fixed on its x-axis
+    body_settings = environment_setup.BodyListSettings("Earth", "J2000")
+    body_settings.add_empty_settings("Earth")
+    body_settings.get("Earth").gravity_field_settings = environment_setup.gravity_field.central(
+        EARTH_GRAVITATIONAL_PARAMETER)
+    body_settings.get("Earth").ephemeris_settings = environment_setup.ephemeris.constant(np.zeros(6), "Earth", "J2000")
+    body_settings.get("Earth").shape_settings = environment_setup.shape.spherical(EARTH_RADIUS)
+    body_settings.get("Earth").rotation_model_settings = environment_setup.rotation_model.simple(
+        "J2000", "Earth_Fixed", np.eye(3), INITIAL_TIME, EARTH_ROTATION_RATE)
+    body_settings.add_empty_settings("Sun")
+    body_settings.get("Sun").ephemeris_settings = environment_setup.ephemeris.constant(
+        np.array([SUN_DISTANCE, 0.0, 0.0, 0.0, 0.0, 0.0]), "Earth", "J2000")
+    body_settings.get("Sun").shape_settings = environment_setup.shape.spherical(SUN_RADIUS)
+    body_settings.add_empty_settings("Satellite")
+    return environment_setup.create_system_of_bodies(body_settings)
+
+
+def propagate_with_events(bodies, initial_kepler_elements, final_time, integrator_settings, events):
+    acceleration_models = propagation_setup.create_acceleration_models(
+        bodies, {"Satellite": {"Earth": [propagation_setup.acceleration.point_mass_gravity()]}},
+        ["Satellite"], ["Earth"])
+    initial_state = element_conversion.keplerian_to_cartesian(initial_kepler_elements, EARTH_GRAVITATIONAL_PARAMETER)
+    processing_settings = propagation_setup.propagator.ExtendedSingleArcPropagatorProcessingSettings(events=events)
+    propagator_settings = propagation_setup.propagator.translational(
+        ["Earth"], acceleration_models, ["Satellite"], initial_state, INITIAL_TIME, integrator_settings,
+        propagation_setup.propagator.time_termination(final_time), processing_settings=processing_settings)
+    return numerical_simulation.SingleArcStepwiseSimulator(
+        bodies, propagator_settings, simulate_dynamics_on_creation=True)
+
+
+def compute_epochs_at_true_anomaly(kepler_elements, true_anomaly, final_time):
+    # Epochs (after the initial time) at which the analytic Kepler orbit passes the given true anomaly
+    semi_major_axis, eccentricity = kepler_elements[0], kepler_elements[1]
+    mean_motion = element_conversion.semi_major_axis_to_mean_motion(semi_major_axis, EARTH_GRAVITATIONAL_PARAMETER)
+    initial_mean_anomaly = element_conversion.true_to_mean_anomaly(eccentricity, kepler_elements[5])
+    mean_anomaly = element_conversion.true_to_mean_anomaly(eccentricity, true_anomaly)
+
+    first_epoch = INITIAL_TIME + np.mod(mean_anomaly - initial_mean_anomaly, 2.0 * np.pi) / mean_motion
+    orbital_period = 2.0 * np.pi / mean_motion
+    return list(np.arange(first_epoch, final_time, orbital_period))
+
+
+def compute_epochs_at_angle(initial_angle, angular_rate, angle, final_time):
+    # Epochs (after the initial time) at which an angle, increasing at a constant rate, passes the given value
+    first_epoch = INITIAL_TIME + np.mod(angle - initial_angle, 2.0 * np.pi) / angular_rate
+    return list(np.arange(first_epoch, final_time, 2.0 * np.pi / angular_rate))
+
+
+def get_events(dynamics_simulator, event_name):
+    return [event for event in dynamics_simulator.detected_events if event.event_name == event_name]
+
+
+def test_apsis_and_node_events(create_bodies):
+    kepler_elements = np.array([7000.0E3, 0.1, np.deg2rad(30.0), np.deg2rad(40.0), np.deg2rad(10.0), np.deg2rad(10.0)])
+    final_time = 12000.0
+    integrator_settings = propagation_setup.integrator.runge_kutta_variable_step_size(
+        10.0, propagation_setup.integrator.CoefficientSets.rkf_78, 1.0E-3, 300.0, 1.0E-12, 1.0E-12)
+    events = [
+        propagation_setup.propagator.apsis_event("apsis", "Satellite", "Earth"),
+        propagation_setup.propagator.node_event(
+            "ascending_node", "Satellite", "Earth",
+            crossing_direction=propagation_setup.propagator.EventCrossingDirections.increasing_crossing)]
+    dynamics_simulator = propagate_with_events(
+        create_bodies(EARTH_GRAVITATIONAL_PARAMETER), kepler_elements, final_time, integrator_settings, events)
+
+    # Apsis passages: the event function is increasing at periapsis, and decreasing at apoapsis
+    periapsis_epochs = compute_epochs_at_true_anomaly(kepler_elements, 0.0, final_time)
+    apoapsis_epochs = compute_epochs_at_true_anomaly(kepler_elements, np.pi, final_time)
+    apsis_events = get_events(dynamics_simulator, "apsis")
+    np.testing.assert_allclose(
+        [event.epoch for event in apsis_events], sorted(periapsis_epochs + apoapsis_epochs),
+        rtol=0.0, atol=EPOCH_TOLERANCE)
+    for event in apsis_events:
+        is_periapsis = np.min(np.abs(np.array(periapsis_epochs) - event.epoch)) < EPOCH_TOLERANCE
+        assert event.is_increasing == is_periapsis
+
+        expected_distance = kepler_elements[0] * (1.0 - kepler_elements[1] if is_periapsis else 1.0 + kepler_elements[1])
+        assert abs(np.linalg.norm(event.state[:3]) - expected_distance) < 0.1
+
+    # Ascending nodes only (argument of latitude of zero), at which the z-component of the position is zero
+    ascending_node_epochs = compute_epochs_at_true_anomaly(kepler_elements, -kepler_elements[3], final_time)
+    node_events = get_events(dynamics_simulator, "ascending_node")
+    np.testing.assert_allclose(
+        [event.epoch for event in node_events], ascending_node_epochs, rtol=0.0, atol=EPOCH_TOLERANCE)
+    for event in node_events:
+        assert event.is_increasing
+        assert abs(event.state[2]) < 1.0E-2
+        assert event.state[5] > 0.0
+
+    np.testing.assert_allclose(
+        dynamics_simulator.event_epochs["ascending_node"], ascending_node_epochs, rtol=0.0, atol=EPOCH_TOLERANCE)
+
+
+def test_two_crossings_within_single_step(create_bodies):
+    # Circular orbit, with a threshold just below the maximum z-component of the position, so that the threshold is
+    # crossed twice (up and down) within 56 s around the maximum, which is inside a single 300 s integration step
+    semi_major_axis = 7000.0E3
+    inclination = np.deg2rad(30.0)
+    step_size = 300.0
+    mean_motion = element_conversion.semi_major_axis_to_mean_motion(semi_major_axis, EARTH_GRAVITATIONAL_PARAMETER)
+    orbital_period = 2.0 * np.pi / mean_motion
+
+    maximum_epoch = 1440.0
+    half_width = 28.0
+    initial_argument_of_latitude = np.pi / 2.0 - mean_motion * maximum_epoch
+    kepler_elements = np.array([semi_major_axis, 0.0, inclination, 0.0, 0.0, initial_argument_of_latitude])
+    threshold = semi_major_axis * np.sin(inclination) * np.cos(mean_motion * half_width)
+
+    integrator_settings = propagation_setup.integrator.runge_kutta_fixed_step_size(
+        step_size, propagation_setup.integrator.CoefficientSets.rkf_78)
+    events = [propagation_setup.propagator.dependent_variable_event(
+        "high_latitude", propagation_setup.dependent_variable.relative_position("Satellite", "Earth"), threshold,
+        component_index=2)]
+    dynamics_simulator = propagate_with_events(
+        create_bodies(EARTH_GRAVITATIONAL_PARAMETER), kepler_elements, 8000.0, integrator_settings, events)
+
+    # The event function is below the threshold at the start, middle and end of the step containing both crossings
+    assert np.floor((maximum_epoch - half_width) / step_size) == np.floor((maximum_epoch + half_width) / step_size)
+
+    expected_epochs = []
+    for maximum in [maximum_epoch, maximum_epoch + orbital_period]:
+        expected_epochs += [maximum - half_width, maximum + half_width]
+
+    detected_events = get_events(dynamics_simulator, "high_latitude")
+    np.testing.assert_allclose(
+        [event.epoch for event in detected_events], expected_epochs, rtol=0.0, atol=EPOCH_TOLERANCE)
+    assert [event.is_increasing for event in detected_events] == [True, False, True, False]
+
+
+def test_eclipse_events():
+    # Circular equatorial orbit, starting on the x-axis (towards the Sun), so that the angle between the position and
+    # the direction opposite to the Sun is the absolute difference between the argument of latitude and pi
+    semi_major_axis = 7000.0E3
+    final_time = 12000.0
+    kepler_elements = np.array([semi_major_axis, 0.0, 0.0, 0.0, 0.0, 0.0])
+    mean_motion = element_conversion.semi_major_axis_to_mean_motion(semi_major_axis, EARTH_GRAVITATIONAL_PARAMETER)
+
+    bodies = create_earth_sun_and_satellite()
+    integrator_settings = propagation_setup.integrator.runge_kutta_variable_step_size(
+        10.0, propagation_setup.integrator.CoefficientSets.rkf_78, 1.0E-3, 300.0, 1.0E-12, 1.0E-12)
+    events = [
+        propagation_setup.propagator.eclipse_event("penumbra", bodies, "Satellite", "Earth"),
+        propagation_setup.propagator.eclipse_event("umbra", bodies, "Satellite", "Earth", use_umbra=True)]
+    dynamics_simulator = propagate_with_events(bodies, kepler_elements, final_time, integrator_settings, events)
+
+    # The penumbra is bounded by the cone of the tangents crossing between the Earth and Sun (apex on the Sun side of
+    # the Earth), and the umbra by the cone of the outer tangents (apex behind the Earth). On a circle of radius r, the
+    # boundaries are at angles asin(R_E / r) + asin((R_S + R_E) / d) and asin(R_E / r) - asin((R_S - R_E) / d) from
+    # the direction opposite to the Sun
+    earth_angular_radius = np.arcsin(EARTH_RADIUS / semi_major_axis)
+    shadow_half_angles = {
+        "penumbra": earth_angular_radius + np.arcsin((SUN_RADIUS + EARTH_RADIUS) / SUN_DISTANCE),
+        "umbra": earth_angular_radius - np.arcsin((SUN_RADIUS - EARTH_RADIUS) / SUN_DISTANCE)}
+    for event_name, half_angle in shadow_half_angles.items():
+        entry_epochs = compute_epochs_at_angle(0.0, mean_motion, np.pi - half_angle, final_time)
+        exit_epochs = compute_epochs_at_angle(0.0, mean_motion, np.pi + half_angle, final_time)
+        detected_events = get_events(dynamics_simulator, event_name)
+        np.testing.assert_allclose(
+            [event.epoch for event in detected_events], sorted(entry_epochs + exit_epochs),
+            rtol=0.0, atol=EPOCH_TOLERANCE)
+
+        # The event function is decreasing at entry, and increasing at exit
+        for event in detected_events:
+            is_exit = np.min(np.abs(np.array(exit_epochs) - event.epoch)) < EPOCH_TOLERANCE
+            assert event.is_increasing == is_exit
+
+
+def test_elevation_events():
+    # Circular equatorial orbit, seen from a station on the equator at zero longitude; the angle between the satellite
+    # and the station, as seen from the centre of the Earth, increases at the difference of the mean motion and the
+    # rotation rate of the Earth, starting with the satellite opposite to the station
+    semi_major_axis = 7000.0E3
+    final_time = 14000.0
+    minimum_elevation = np.deg2rad(10.0)
+    kepler_elements = np.array([semi_major_axis, 0.0, 0.0, 0.0, 0.0, np.pi])
+    mean_motion = element_conversion.semi_major_axis_to_mean_motion(semi_major_axis, EARTH_GRAVITATIONAL_PARAMETER)
+    relative_angular_rate = mean_motion - EARTH_ROTATION_RATE
+
+    bodies = create_earth_sun_and_satellite()
+    environment_setup.add_ground_station(bodies.get("Earth"), "Station", np.array([EARTH_RADIUS, 0.0, 0.0]))
+    integrator_settings = propagation_setup.integrator.runge_kutta_variable_step_size(
+        10.0, propagation_setup.integrator.CoefficientSets.rkf_78, 1.0E-3, 300.0, 1.0E-12, 1.0E-12)
+    events = [propagation_setup.propagator.elevation_event(
+        "pass", bodies, "Satellite", "Earth", "Station", minimum_elevation)]
+    dynamics_simulator = propagate_with_events(bodies, kepler_elements, final_time, integrator_settings, events)
+
+    # In the triangle formed by the centre of the Earth, the station and the satellite, the satellite is at the
+    # minimum elevation for a central angle of acos(R_E cos(elevation) / r) - elevation
+    central_angle = np.arccos(EARTH_RADIUS * np.cos(minimum_elevation) / semi_major_axis) - minimum_elevation
+    rise_epochs = compute_epochs_at_angle(np.pi, relative_angular_rate, -central_angle, final_time)
+    set_epochs = compute_epochs_at_angle(np.pi, relative_angular_rate, central_angle, final_time)
+    assert len(rise_epochs) == 2
+
+    detected_events = get_events(dynamics_simulator, "pass")
+    np.testing.assert_allclose(
+        [event.epoch for event in detected_events], sorted(rise_epochs + set_epochs), rtol=0.0, atol=EPOCH_TOLERANCE)
+    for event in detected_events:
+        is_rise = np.min(np.abs(np.array(rise_epochs) - event.epoch)) < EPOCH_TOLERANCE
+        assert event.is_increasing == is_rise
@@ -0,0 +1,74 @@
+import numpy as np
+
+from tudatpy.kernel import numerical_simulation
+from tudatpy.kernel.astro import element_conversion
+from tudatpy.kernel.numerical_simulation import propagation_setup
+
+EARTH_GRAVITATIONAL_PARAMETER = 3.986004418E14
+INITIAL_TIME = 0.0
+FINAL_TIME = 6000.0
+TIME_STEP = 10.0
+INITIAL_STATE = element_conversion.keplerian_to_cartesian_elementwise(
+    semi_major_axis=8000.0E3, eccentricity=0.2, inclination=np.deg2rad(30.0),
+    argument_of_periapsis=0.0, longitude_of_ascending_node=0.0, true_anomaly=0.0,
+    gravitational_parameter=EARTH_GRAVITATIONAL_PARAMETER)
+
+
+def create_propagator_settings(bodies, bodies_to_propagate, integrator_settings):
+    acceleration_models = propagation_setup.create_acceleration_models(
+        bodies, {body: {"Earth": [propagation_setup.acceleration.point_mass_gravity()]} for body in bodies_to_propagate},
+        bodies_to_propagate, ["Earth"] * len(bodies_to_propagate))
+    return propagation_setup.propagator.translational(
+        ["Earth"] * len(bodies_to_propagate), acceleration_models, bodies_to_propagate,
+        np.tile(INITIAL_STATE, len(bodies_to_propagate)), INITIAL_TIME, integrator_settings,
+        propagation_setup.propagator.time_termination(FINAL_TIME))
+
+
+def create_rk4_integrator_settings():
+    return propagation_setup.integrator.runge_kutta_fixed_step_size(
+        TIME_STEP, propagation_setup.integrator.CoefficientSets.rk_4)
+
+
+def test_default_simulator_integrates_fixed_size_state(create_bodies):
+    bodies = create_bodies(EARTH_GRAVITATIONAL_PARAMETER)
+    dynamics_simulator = numerical_simulation.create_dynamics_simulator(
+        bodies, create_propagator_settings(bodies, ["Satellite"], create_rk4_integrator_settings()))
+    assert isinstance(dynamics_simulator, numerical_simulation.SingleArcStepwiseSimulator)
+    assert dynamics_simulator.is_integrated_state_size_fixed
+    assert max(dynamics_simulator.propagation_results.state_history.keys()) == FINAL_TIME
+
+
+def test_fixed_size_state_matches_dynamic_size_state(create_bodies):
+    # Propagating a second, identical satellite makes the state size 12, which is integrated as a dynamic-size state
+    fixed_size_bodies = create_bodies(EARTH_GRAVITATIONAL_PARAMETER)
+    fixed_size_simulator = numerical_simulation.create_dynamics_simulator(
+        fixed_size_bodies, create_propagator_settings(fixed_size_bodies, ["Satellite"], create_rk4_integrator_settings()))
+
+    dynamic_size_bodies = create_bodies(EARTH_GRAVITATIONAL_PARAMETER)
+    dynamic_size_bodies.create_empty_body("Satellite2")
+    dynamic_size_simulator = numerical_simulation.create_dynamics_simulator(
+        dynamic_size_bodies, create_propagator_settings(
+            dynamic_size_bodies, ["Satellite", "Satellite2"], create_rk4_integrator_settings()))
+    assert not isinstance(dynamic_size_simulator, numerical_simulation.SingleArcStepwiseSimulator)
+
+    fixed_size_history = fixed_size_simulator.propagation_results.state_history
+    dynamic_size_history = dynamic_size_simulator.propagation_results.state_history
+    assert fixed_size_history.keys() == dynamic_size_history.keys()
+    for epoch in fixed_size_history.keys():
+        np.testing.assert_allclose(fixed_size_history[epoch], dynamic_size_history[epoch][:6], rtol=1.0E-12, atol=1.0E-6)
+
+
+def test_simulator_selection(create_bodies):
+    # Integrators other than Runge-Kutta are not integrated with fixed-size states
+    bodies = create_bodies(EARTH_GRAVITATIONAL_PARAMETER)
+    dynamics_simulator = numerical_simulation.create_dynamics_simulator(
+        bodies, create_propagator_settings(bodies, ["Satellite"], propagation_setup.integrator.adams_bashforth_moulton(
+            TIME_STEP, 1.0E-3, 1000.0, 1.0E-10, 1.0E-10)))
+    assert not isinstance(dynamics_simulator, numerical_simulation.SingleArcStepwiseSimulator)
+
+    # Propagations for which Tudat is to print output use the simulator of Tudat
+    bodies = create_bodies(EARTH_GRAVITATIONAL_PARAMETER)
+    propagator_settings = create_propagator_settings(bodies, ["Satellite"], create_rk4_integrator_settings())
+    propagator_settings.print_settings.print_termination_reason = True
+    dynamics_simulator = numerical_simulation.create_dynamics_simulator(bodies, propagator_settings)
+    assert not isinstance(dynamics_simulator, numerical_simulation.SingleArcStepwiseSimulator)
@@ -0,0 +1,84 @@
+import ctypes
+
+import numpy as np
+
+from tudatpy.kernel import numerical_simulation
+from tudatpy.kernel.numerical_simulation import propagation_setup
+
+EARTH_GRAVITATIONAL_PARAMETER = 3.986004418E14
+INITIAL_TIME = 0.0
+FINAL_TIME = 1000.0
+TIME_STEP = 10.0
+INITIAL_STATE = np.array([7.0E6, 0.0, 0.0, 0.0, 7.5E3, 0.0])
+
+# C signatures of the native callbacks, see include/tudatpy/nativeCallbacks.h
+ACCELERATION_FUNCTION = ctypes.CFUNCTYPE(None, ctypes.c_double, ctypes.POINTER(ctypes.c_double), ctypes.c_void_p)
+DEPENDENT_VARIABLE_FUNCTION = ctypes.CFUNCTYPE(
+    None, ctypes.POINTER(ctypes.c_double), ctypes.c_int32, ctypes.c_void_p)
+TERMINATION_FUNCTION = ctypes.CFUNCTYPE(ctypes.c_int32, ctypes.c_double, ctypes.c_void_p)
+
+
+def get_user_data_array(user_data, size):
+    return np.ctypeslib.as_array(ctypes.cast(user_data, ctypes.POINTER(ctypes.c_double)), shape=(size,))
+
+
+# User data: constant acceleration (3 entries), termination time, and the time of the last acceleration evaluation
+@ACCELERATION_FUNCTION
+def constant_acceleration(time, acceleration, user_data):
+    parameters = get_user_data_array(user_data, 5)
+    for index in range(3):
+        acceleration[index] = parameters[index]
+    parameters[4] = time
+
+
+@DEPENDENT_VARIABLE_FUNCTION
+def last_acceleration_time(dependent_variable, size, user_data):
+    dependent_variable[0] = get_user_data_array(user_data, 5)[4]
+
+
+@TERMINATION_FUNCTION
+def is_termination_time_reached(time, user_data):
+    return int(time >= get_user_data_array(user_data, 5)[3])
+
+
+def get_address(native_function):
+    return ctypes.cast(native_function, ctypes.c_void_p).value
+
+
+def test_native_callbacks_receive_user_data(create_bodies):
+    bodies = create_bodies(EARTH_GRAVITATIONAL_PARAMETER)
+    user_data = np.array([1.0E-3, -2.0E-3, 5.0E-4, FINAL_TIME, np.nan])
+    user_data_address = user_data.ctypes.data
+
+    acceleration_models = propagation_setup.create_acceleration_models(
+        bodies, {"Satellite": {"Earth": [propagation_setup.acceleration.custom_acceleration(
+            get_address(constant_acceleration), user_data_address)]}},
+        ["Satellite"], ["Earth"])
+    dependent_variables = [propagation_setup.dependent_variable.custom_dependent_variable(
+        get_address(last_acceleration_time), 1, user_data_address)]
+    termination_settings = propagation_setup.propagator.custom_termination(
+        get_address(is_termination_time_reached), user_data_address)
+    integrator_settings = propagation_setup.integrator.runge_kutta_fixed_step_size(
+        TIME_STEP, propagation_setup.integrator.CoefficientSets.rk_4)
+    propagator_settings = propagation_setup.propagator.translational(
+        ["Earth"], acceleration_models, ["Satellite"], INITIAL_STATE, INITIAL_TIME, integrator_settings,
+        termination_settings, output_variables=dependent_variables)
+    propagation_results = numerical_simulation.create_dynamics_simulator(
+        bodies, propagator_settings).propagation_results
+
+    # The termination time is read from the user data
+    state_history = propagation_results.state_history
+    final_time = max(state_history.keys())
+    assert final_time == FINAL_TIME
+
+    # RK4 integrates the constant acceleration, read from the user data, exactly
+    elapsed_time = final_time - INITIAL_TIME
+    expected_position = INITIAL_STATE[:3] + INITIAL_STATE[3:] * elapsed_time + 0.5 * user_data[:3] * elapsed_time ** 2
+    np.testing.assert_allclose(state_history[final_time][:3], expected_position, rtol=1.0E-12)
+    np.testing.assert_allclose(
+        state_history[final_time][3:], INITIAL_STATE[3:] + user_data[:3] * elapsed_time, rtol=1.0E-12)
+
+    # The dependent variable receives the time of the acceleration evaluation through the shared user data
+    for epoch, dependent_variable in propagation_results.dependent_variable_history.items():
+        assert np.isfinite(dependent_variable[0])
+        assert dependent_variable[0] <= epoch
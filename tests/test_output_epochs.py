@@ -0,0 +1,76 @@
+import numpy as np
+
+from tudatpy.kernel import numerical_simulation
+from tudatpy.kernel.astro import element_conversion, two_body_dynamics
+from tudatpy.kernel.numerical_simulation import propagation_setup
+
+EARTH_GRAVITATIONAL_PARAMETER = 3.986004418E14
+INITIAL_TIME = 0.0
+FINAL_TIME = 6050.0
+INITIAL_KEPLER_ELEMENTS = np.array([7000.0E3, 0.1, np.deg2rad(30.0), np.deg2rad(40.0), np.deg2rad(10.0), 0.0])
+
+# States at output epochs are integrated from the start of the integration step, so that they have the accuracy of the
+# integrator, also for steps much longer than the interval between output epochs
+MAXIMUM_STEP_SIZE = 1000.0
+POSITION_TOLERANCE = 5.0E-3
+VELOCITY_TOLERANCE = 5.0E-6
+
+
+def propagate(create_bodies, processing_settings):
+    bodies = create_bodies(EARTH_GRAVITATIONAL_PARAMETER)
+    acceleration_models = propagation_setup.create_acceleration_models(
+        bodies, {"Satellite": {"Earth": [propagation_setup.acceleration.point_mass_gravity()]}},
+        ["Satellite"], ["Earth"])
+    initial_state = element_conversion.keplerian_to_cartesian(INITIAL_KEPLER_ELEMENTS, EARTH_GRAVITATIONAL_PARAMETER)
+    integrator_settings = propagation_setup.integrator.runge_kutta_variable_step_size(
+        10.0, propagation_setup.integrator.CoefficientSets.rkf_78, 1.0E-3, MAXIMUM_STEP_SIZE, 1.0E-12, 1.0E-12)
+    propagator_settings = propagation_setup.propagator.translational(
+        ["Earth"], acceleration_models, ["Satellite"], initial_state, INITIAL_TIME, integrator_settings,
+        propagation_setup.propagator.time_termination(FINAL_TIME, terminate_exactly_on_final_condition=True),
+        processing_settings=processing_settings)
+    return numerical_simulation.create_dynamics_simulator(bodies, propagator_settings)
+
+
+def compute_analytic_state(epoch):
+    kepler_elements = two_body_dynamics.propagate_kepler_orbit(
+        INITIAL_KEPLER_ELEMENTS, epoch - INITIAL_TIME, EARTH_GRAVITATIONAL_PARAMETER)
+    return element_conversion.keplerian_to_cartesian(kepler_elements, EARTH_GRAVITATIONAL_PARAMETER)
+
+
+def check_against_analytic_orbit(state_history):
+    for epoch, state in state_history.items():
+        analytic_state = compute_analytic_state(epoch)
+        np.testing.assert_allclose(state[:3], analytic_state[:3], rtol=0.0, atol=POSITION_TOLERANCE)
+        np.testing.assert_allclose(state[3:], analytic_state[3:], rtol=0.0, atol=VELOCITY_TOLERANCE)
+
+
+def test_output_interval(create_bodies):
+    processing_settings = propagation_setup.propagator.ExtendedSingleArcPropagatorProcessingSettings(
+        output_interval=100.0)
+    state_history = propagate(create_bodies, processing_settings).state_history
+
+    # Results are saved at the initial time and every output interval, not at the integration steps
+    np.testing.assert_allclose(
+        np.array(list(state_history.keys())), np.arange(INITIAL_TIME, FINAL_TIME, 100.0), rtol=0.0, atol=1.0E-9)
+    check_against_analytic_orbit(state_history)
+
+
+def test_output_epochs(create_bodies):
+    output_epochs = [123.456, 500.0, 1777.7, 3000.0, 4321.0, 5432.1]
+    processing_settings = propagation_setup.propagator.ExtendedSingleArcPropagatorProcessingSettings(
+        output_epochs=output_epochs)
+    state_history = propagate(create_bodies, processing_settings).state_history
+
+    np.testing.assert_allclose(np.array(list(state_history.keys())), output_epochs, rtol=0.0, atol=1.0E-9)
+    check_against_analytic_orbit(state_history)
+
+
+def test_unsorted_output_epochs(create_bodies):
+    output_epochs = [4000.0, 250.0, 2500.0]
+    processing_settings = propagation_setup.propagator.ExtendedSingleArcPropagatorProcessingSettings(
+        output_epochs=output_epochs)
+    state_history = propagate(create_bodies, processing_settings).state_history
+
+    # Output epochs are saved in the order of propagation, whatever order they are provided in
+    np.testing.assert_allclose(np.array(list(state_history.keys())), sorted(output_epochs), rtol=0.0, atol=1.0E-9)
+    check_against_analytic_orbit(state_history)
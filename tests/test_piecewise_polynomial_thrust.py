@@ -0,0 +1,142 @@
+import numpy as np
+import pytest
+
+from tudatpy.kernel import numerical_simulation
+from tudatpy.kernel.astro import element_conversion
+from tudatpy.kernel.numerical_simulation import environment_setup, propagation_setup
+
+EARTH_GRAVITATIONAL_PARAMETER = 3.986004418E14
+VEHICLE_MASS = 1000.0
+SPECIFIC_IMPULSE = 300.0
+TIME_STEP = 10.0
+
+# Constant thrust in the first segment, linearly decreasing to zero in the second one, and no thrust after it (so that
+# the thrust is continuous, and integrated exactly by RK4 with steps that end at the segment boundaries)
+SEGMENT_BOUNDARIES = [0.0, 100.0, 200.0]
+SEGMENT_COEFFICIENTS = [
+    np.array([[2.0, -1.0, 0.5]]),
+    np.array([[2.0, -1.0, 0.5], [-0.02, 0.01, -0.005]])]
+
+
+def compute_analytic_thrust(time):
+    if time < SEGMENT_BOUNDARIES[0] or time > SEGMENT_BOUNDARIES[-1]:
+        return np.zeros(3)
+    segment_index = min(np.searchsorted(SEGMENT_BOUNDARIES, time, side="right") - 1, len(SEGMENT_COEFFICIENTS) - 1)
+    local_time = time - SEGMENT_BOUNDARIES[segment_index]
+    coefficients = SEGMENT_COEFFICIENTS[segment_index]
+    return sum(coefficients[k] * local_time ** k for k in range(coefficients.shape[0]))
+
+
+def create_bodies():
+    body_settings = environment_setup.BodyListSettings("Earth", "J2000")
+    body_settings.add_empty_settings("Earth")
+    body_settings.get("Earth").gravity_field_settings = environment_setup.gravity_field.central(
+        EARTH_GRAVITATIONAL_PARAMETER)
+    body_settings.get("Earth").ephemeris_settings = environment_setup.ephemeris.constant(np.zeros(6), "Earth", "J2000")
+    body_settings.add_empty_settings("Vehicle")
+    body_settings.get("Vehicle").constant_mass = VEHICLE_MASS
+    return environment_setup.create_system_of_bodies(body_settings)
+
+
+def add_thrust_profile(bodies, thrust_frame, central_body=""):
+    thrust_profile = propagation_setup.thrust.piecewise_polynomial_thrust_profile(
+        bodies, "Vehicle", SEGMENT_BOUNDARIES, SEGMENT_COEFFICIENTS, thrust_frame, central_body)
+    environment_setup.add_rotation_model(
+        bodies, "Vehicle", propagation_setup.thrust.piecewise_polynomial_thrust_orientation(
+            thrust_profile, "J2000", "Vehicle_Fixed"))
+    environment_setup.add_engine_model(
+        "Vehicle", "MainEngine", propagation_setup.thrust.piecewise_polynomial_thrust_magnitude(
+            thrust_profile, SPECIFIC_IMPULSE), bodies)
+    return thrust_profile
+
+
+def propagate_with_thrust(bodies, exerting_accelerations, initial_state, final_time):
+    acceleration_models = propagation_setup.create_acceleration_models(
+        bodies, {"Vehicle": exerting_accelerations}, ["Vehicle"], ["Earth"])
+    dependent_variables = [propagation_setup.dependent_variable.single_acceleration(
+        propagation_setup.acceleration.thrust_acceleration_type, "Vehicle", "Vehicle")]
+    integrator_settings = propagation_setup.integrator.runge_kutta_fixed_step_size(
+        TIME_STEP, propagation_setup.integrator.CoefficientSets.rk_4)
+    propagator_settings = propagation_setup.propagator.translational(
+        ["Earth"], acceleration_models, ["Vehicle"], initial_state, 0.0, integrator_settings,
+        propagation_setup.propagator.time_termination(final_time), output_variables=dependent_variables)
+    return numerical_simulation.create_dynamics_simulator(bodies, propagator_settings).propagation_results
+
+
+def test_thrust_profile_evaluation():
+    bodies = create_bodies()
+    thrust_profile = propagation_setup.thrust.piecewise_polynomial_thrust_profile(
+        bodies, "Vehicle", SEGMENT_BOUNDARIES, SEGMENT_COEFFICIENTS)
+    assert thrust_profile.thrust_frame == propagation_setup.thrust.inertial_polynomial_thrust_frame
+
+    # Epochs inside the segments, on their boundaries, and out of order (so that the segment search is not only
+    # incremental), and epochs outside the profile
+    for time in [0.0, 50.0, 99.9, 100.0, 150.0, 199.0, 25.0, 175.0, -1.0, 250.0]:
+        expected_thrust = compute_analytic_thrust(time)
+        assert thrust_profile.thrust_magnitude(time) == pytest.approx(np.linalg.norm(expected_thrust), rel=1.0E-14)
+        if np.linalg.norm(expected_thrust) > 0.0:
+            np.testing.assert_allclose(
+                thrust_profile.inertial_thrust_direction(time), expected_thrust / np.linalg.norm(expected_thrust),
+                rtol=0.0, atol=1.0E-14)
+        else:
+            np.testing.assert_array_equal(thrust_profile.inertial_thrust_direction(time), [1.0, 0.0, 0.0])
+
+
+def test_thrust_profile_checks_input():
+    bodies = create_bodies()
+    with pytest.raises(RuntimeError, match="number of segment boundaries"):
+        propagation_setup.thrust.piecewise_polynomial_thrust_profile(
+            bodies, "Vehicle", SEGMENT_BOUNDARIES[:2], SEGMENT_COEFFICIENTS)
+    with pytest.raises(RuntimeError, match="thrust must have 3 components"):
+        propagation_setup.thrust.piecewise_polynomial_thrust_profile(
+            bodies, "Vehicle", [0.0, 1.0], [np.ones((1, 2))])
+    with pytest.raises(RuntimeError, match="central body is required"):
+        propagation_setup.thrust.piecewise_polynomial_thrust_profile(
+            bodies, "Vehicle", SEGMENT_BOUNDARIES, SEGMENT_COEFFICIENTS,
+            propagation_setup.thrust.rsw_polynomial_thrust_frame)
+
+
+def test_inertial_thrust_propagation():
+    # Without gravity, the velocity change is the integral of the thrust acceleration, which RK4 integrates exactly
+    bodies = create_bodies()
+    add_thrust_profile(bodies, propagation_setup.thrust.inertial_polynomial_thrust_frame)
+    initial_state = np.array([7.0E6, 0.0, 0.0, 0.0, 7.5E3, 0.0])
+    final_time = 300.0
+    propagation_results = propagate_with_thrust(
+        bodies, {"Vehicle": [propagation_setup.acceleration.thrust_from_engine("MainEngine")]}, initial_state, final_time)
+
+    for epoch, dependent_variables in propagation_results.dependent_variable_history.items():
+        np.testing.assert_allclose(
+            dependent_variables, compute_analytic_thrust(epoch) / VEHICLE_MASS, rtol=0.0, atol=1.0E-15)
+
+    first_segment_impulse = SEGMENT_COEFFICIENTS[0][0] * 100.0
+    second_segment_impulse = SEGMENT_COEFFICIENTS[1][0] * 100.0 + SEGMENT_COEFFICIENTS[1][1] * 100.0 ** 2 / 2.0
+    final_state = propagation_results.state_history[final_time]
+    np.testing.assert_allclose(
+        final_state[3:], initial_state[3:] + (first_segment_impulse + second_segment_impulse) / VEHICLE_MASS,
+        rtol=1.0E-12)
+
+
+def test_rsw_thrust_propagation():
+    bodies = create_bodies()
+    add_thrust_profile(bodies, propagation_setup.thrust.rsw_polynomial_thrust_frame, "Earth")
+    initial_state = element_conversion.keplerian_to_cartesian_elementwise(
+        semi_major_axis=7000.0E3, eccentricity=0.05, inclination=np.deg2rad(40.0),
+        argument_of_periapsis=0.0, longitude_of_ascending_node=0.0, true_anomaly=0.0,
+        gravitational_parameter=EARTH_GRAVITATIONAL_PARAMETER)
+    propagation_results = propagate_with_thrust(
+        bodies, {"Earth": [propagation_setup.acceleration.point_mass_gravity()],
+                 "Vehicle": [propagation_setup.acceleration.thrust_from_engine("MainEngine")]},
+        initial_state, 200.0)
+
+    # The thrust acceleration, rotated to the RSW frame of the current state, is the profile
+    state_history = propagation_results.state_history
+    for epoch, thrust_acceleration in propagation_results.dependent_variable_history.items():
+        position, velocity = state_history[epoch][:3], state_history[epoch][3:]
+        radial_direction = position / np.linalg.norm(position)
+        normal_direction = np.cross(position, velocity) / np.linalg.norm(np.cross(position, velocity))
+        rsw_to_inertial = np.column_stack(
+            [radial_direction, np.cross(normal_direction, radial_direction), normal_direction])
+        np.testing.assert_allclose(
+            rsw_to_inertial.T @ thrust_acceleration, compute_analytic_thrust(epoch) / VEHICLE_MASS,
+            rtol=0.0, atol=1.0E-12)
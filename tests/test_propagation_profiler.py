@@ -0,0 +1,75 @@
+import numpy as np
+
+from tudatpy.kernel import numerical_simulation
+from tudatpy.kernel.astro import element_conversion
+from tudatpy.kernel.numerical_simulation import propagation_setup
+
+EARTH_GRAVITATIONAL_PARAMETER = 3.986004418E14
+INITIAL_TIME = 0.0
+FINAL_TIME = 2000.0
+TIME_STEP = 10.0
+NUMBER_OF_STEPS = int(FINAL_TIME / TIME_STEP)
+
+
+def create_stepwise_simulator(create_bodies, profiling_settings):
+    bodies = create_bodies(EARTH_GRAVITATIONAL_PARAMETER)
+    acceleration_models = propagation_setup.create_acceleration_models(
+        bodies, {"Satellite": {"Earth": [
+            propagation_setup.acceleration.point_mass_gravity(),
+            propagation_setup.acceleration.custom_acceleration(lambda time: np.array([1.0E-6, 0.0, 0.0]))]}},
+        ["Satellite"], ["Earth"])
+    initial_state = element_conversion.keplerian_to_cartesian_elementwise(
+        semi_major_axis=8000.0E3, eccentricity=0.2, inclination=np.deg2rad(30.0),
+        argument_of_periapsis=0.0, longitude_of_ascending_node=0.0, true_anomaly=0.0,
+        gravitational_parameter=EARTH_GRAVITATIONAL_PARAMETER)
+    dependent_variables = [
+        propagation_setup.dependent_variable.relative_distance("Satellite", "Earth"),
+        propagation_setup.dependent_variable.custom_dependent_variable(lambda: np.array([1.0]), 1)]
+    integrator_settings = propagation_setup.integrator.runge_kutta_fixed_step_size(
+        TIME_STEP, propagation_setup.integrator.CoefficientSets.rk_4)
+    processing_settings = propagation_setup.propagator.ExtendedSingleArcPropagatorProcessingSettings(
+        profiling=profiling_settings)
+    propagator_settings = propagation_setup.propagator.translational(
+        ["Earth"], acceleration_models, ["Satellite"], initial_state, INITIAL_TIME, integrator_settings,
+        propagation_setup.propagator.time_termination(FINAL_TIME), output_variables=dependent_variables,
+        processing_settings=processing_settings)
+    return numerical_simulation.SingleArcStepwiseSimulator(bodies, propagator_settings)
+
+
+def propagate_to_end(dynamics_simulator):
+    dynamics_simulator.initialize_propagation()
+    while not dynamics_simulator.is_terminated:
+        dynamics_simulator.step()
+
+
+def test_profiled_quantities(create_bodies):
+    dynamics_simulator = create_stepwise_simulator(create_bodies, propagation_setup.propagator.profiling())
+    propagate_to_end(dynamics_simulator)
+
+    quantities = {quantity.name: quantity for quantity in dynamics_simulator.profiler.profiled_quantities}
+    acceleration_quantities = [quantity for quantity in quantities.values() if quantity.category == "acceleration"]
+    custom_quantities = [quantity for quantity in quantities.values() if quantity.category == "custom_callback"]
+    assert len(acceleration_quantities) == 1
+    assert "Earth on Satellite" in acceleration_quantities[0].name
+    assert len(custom_quantities) == 2
+
+    # Each acceleration model is timed once per state derivative evaluation (four per RK4 step), as is the environment
+    # update
+    number_of_state_derivatives = quantities["State derivative"].number_of_calls
+    assert number_of_state_derivatives >= 4 * NUMBER_OF_STEPS
+    assert quantities["Environment update"].category == "environment"
+    assert quantities["Environment update"].number_of_calls == number_of_state_derivatives
+    assert acceleration_quantities[0].number_of_calls == number_of_state_derivatives
+    for quantity in custom_quantities:
+        assert quantity.number_of_calls > 0
+        assert quantity.total_time >= 0.0
+
+
+def test_profiling_does_not_modify_results(create_bodies):
+    profiled_simulator = create_stepwise_simulator(create_bodies, propagation_setup.propagator.profiling())
+    propagate_to_end(profiled_simulator)
+    reference_simulator = create_stepwise_simulator(create_bodies, None)
+    propagate_to_end(reference_simulator)
+
+    assert profiled_simulator.current_time == reference_simulator.current_time
+    np.testing.assert_array_equal(profiled_simulator.current_state, reference_simulator.current_state)
@@ -0,0 +1,202 @@
+import numpy as np
+import pytest
+
+from tudatpy.kernel import numerical_simulation
+from tudatpy.kernel.astro import element_conversion, two_body_dynamics
+from tudatpy.kernel.numerical_simulation import propagation_setup, estimation, estimation_setup
+
+EARTH_GRAVITATIONAL_PARAMETER = 3.986004418E14
+INITIAL_TIME = 0.0
+FINAL_TIME = 10800.0
+OBSERVATION_TIMES = list(np.arange(60.0, FINAL_TIME - 600.0, 60.0))
+OUTPUT_TIMES = list(np.arange(600.0, FINAL_TIME - 1200.0, 450.0))
+
+INITIAL_KEPLER_ELEMENTS = np.array([7000.0E3, 0.05, np.deg2rad(50.0), np.deg2rad(20.0), np.deg2rad(30.0), 0.0])
+
+COVARIANCE_RELATIVE_TOLERANCE = 1.0E-8
+
+
+def create_link_definition():
+    return estimation_setup.observation.link_definition({
+        estimation_setup.observation.LinkEndType.observed_body:
+            estimation_setup.observation.body_origin_link_end_id("Satellite")})
+
+
+def create_translational_propagator_settings(bodies, initial_state, initial_time, final_time):
+    acceleration_models = propagation_setup.create_acceleration_models(
+        bodies, {"Satellite": {"Earth": [propagation_setup.acceleration.point_mass_gravity()]}},
+        ["Satellite"], ["Earth"])
+    integrator_settings = propagation_setup.integrator.runge_kutta_fixed_step_size(
+        30.0, propagation_setup.integrator.CoefficientSets.rkf_78)
+    return propagation_setup.propagator.translational(
+        ["Earth"], acceleration_models, ["Satellite"], initial_state, initial_time, integrator_settings,
+        propagation_setup.propagator.time_termination(final_time))
+
+
+def create_estimator_and_covariance(bodies, propagator_settings, observation_times):
+    # Estimator of the initial state(s) of the satellite and the gravitational parameter of the Earth, and the covariance
+    # of these parameters from the Cartesian position of the satellite
+    parameter_settings = estimation_setup.parameter.initial_states(propagator_settings, bodies)
+    parameter_settings.append(estimation_setup.parameter.gravitational_parameter("Earth"))
+    estimated_parameters = estimation_setup.create_parameter_set(parameter_settings, bodies, propagator_settings)
+    observation_settings = [estimation_setup.observation.cartesian_position(create_link_definition())]
+    estimator = numerical_simulation.Estimator(
+        bodies, estimated_parameters, observation_settings, propagator_settings)
+
+    simulation_settings = [estimation_setup.observation.tabulated_simulation_settings(
+        estimation_setup.observation.ObservableType.position_observable_type, create_link_definition(),
+        observation_times, reference_link_end_type=estimation_setup.observation.LinkEndType.observed_body)]
+    observations = estimation.simulate_observations(simulation_settings, estimator.observation_simulators, bodies)
+
+    covariance_analysis_input = estimation.CovarianceAnalysisInput(observations)
+    covariance_analysis_input.define_covariance_settings(print_output_to_terminal=False)
+    covariance_analysis_input.set_constant_weight(1.0)
+    return estimator, estimator.compute_covariance(covariance_analysis_input)
+
+
+def create_single_arc_estimator(create_bodies):
+    bodies = create_bodies(EARTH_GRAVITATIONAL_PARAMETER)
+    initial_state = element_conversion.keplerian_to_cartesian(INITIAL_KEPLER_ELEMENTS, EARTH_GRAVITATIONAL_PARAMETER)
+    propagator_settings = create_translational_propagator_settings(bodies, initial_state, INITIAL_TIME, FINAL_TIME)
+    estimator, covariance_output = create_estimator_and_covariance(bodies, propagator_settings, OBSERVATION_TIMES)
+    return estimator, covariance_output, bodies
+
+
+def compute_inertial_to_rsw_rotation(state):
+    # Rows are the radial (R), along-track (S) and cross-track (W) directions
+    radial_direction = state[:3] / np.linalg.norm(state[:3])
+    angular_momentum = np.cross(state[:3], state[3:])
+    cross_track_direction = angular_momentum / np.linalg.norm(angular_momentum)
+    along_track_direction = np.cross(cross_track_direction, radial_direction)
+    return np.array([radial_direction, along_track_direction, cross_track_direction])
+
+
+def rotate_to_rsw(inertial_covariance, bodies, epoch, state_start_indices):
+    # Each 6x6 translational state block is rotated to the RSW frame of the satellite, other parameters are unchanged
+    position_rotation = compute_inertial_to_rsw_rotation(
+        bodies.get("Satellite").state_in_base_frame_from_ephemeris(epoch) -
+        bodies.get("Earth").state_in_base_frame_from_ephemeris(epoch))
+    rotation = np.identity(inertial_covariance.shape[0])
+    for start_index in state_start_indices:
+        rotation[start_index:start_index + 3, start_index:start_index + 3] = position_rotation
+        rotation[start_index + 3:start_index + 6, start_index + 3:start_index + 6] = position_rotation
+    return rotation @ inertial_covariance @ rotation.T
+
+
+def assert_matrices_close(matrix, reference_matrix):
+    # Symmetric positive-definite matrices, compared after scaling by the square roots of their diagonals, as (near-)zero
+    # entries are only determined up to the rounding errors of the diagonal entries
+    scaling = np.outer(np.sqrt(np.diag(reference_matrix)), np.sqrt(np.diag(reference_matrix)))
+    np.testing.assert_allclose(
+        matrix / scaling, reference_matrix / scaling, rtol=0.0, atol=COVARIANCE_RELATIVE_TOLERANCE)
+
+
+def test_rsw_covariance_matches_rotated_inertial_covariance(create_bodies):
+    estimator, covariance_output, bodies = create_single_arc_estimator(create_bodies)
+
+    inertial_covariance = estimation.propagate_covariance(
+        covariance_output.covariance, estimator.state_transition_interface, OUTPUT_TIMES)
+    rsw_epochs, rsw_covariance = estimation.propagate_covariance_rsw_split_output(
+        covariance_output, estimator, OUTPUT_TIMES)
+    np.testing.assert_array_equal(rsw_epochs, OUTPUT_TIMES)
+
+    for epoch, covariance in zip(rsw_epochs, rsw_covariance):
+        # Covariance of all parameters: the propagated state, followed by the gravitational parameter
+        assert covariance.shape == (7, 7)
+        expected_covariance = rotate_to_rsw(inertial_covariance[epoch], bodies, epoch, [0])
+        assert_matrices_close(covariance, expected_covariance)
+        assert covariance[6, 6] == covariance_output.covariance[6, 6]
+
+
+def test_rsw_formal_errors_match_rotated_inertial_covariance(create_bodies):
+    estimator, covariance_output, bodies = create_single_arc_estimator(create_bodies)
+
+    inertial_covariance = estimation.propagate_covariance(
+        covariance_output.covariance, estimator.state_transition_interface, OUTPUT_TIMES)
+    rsw_epochs, rsw_formal_errors = estimation.propagate_formal_errors_rsw_split_output(
+        covariance_output, estimator, OUTPUT_TIMES)
+    np.testing.assert_array_equal(rsw_epochs, OUTPUT_TIMES)
+
+    # Formal errors are computed from the diagonal only, without forming the propagated covariance
+    for epoch, formal_errors in zip(rsw_epochs, rsw_formal_errors):
+        expected_covariance = rotate_to_rsw(inertial_covariance[epoch], bodies, epoch, [0])
+        np.testing.assert_allclose(
+            formal_errors, np.sqrt(np.diag(expected_covariance)), rtol=COVARIANCE_RELATIVE_TOLERANCE, atol=0.0)
+
+
+ARC_START_TIMES = [600.0, 5700.0]
+ARC_DURATION = 4800.0
+
+
+def create_multi_arc_estimator(create_bodies):
+    bodies = create_bodies(EARTH_GRAVITATIONAL_PARAMETER)
+    single_arc_settings = []
+    observation_times = []
+    for arc_start_time in ARC_START_TIMES:
+        arc_initial_kepler_elements = two_body_dynamics.propagate_kepler_orbit(
+            INITIAL_KEPLER_ELEMENTS, arc_start_time - INITIAL_TIME, EARTH_GRAVITATIONAL_PARAMETER)
+        arc_initial_state = element_conversion.keplerian_to_cartesian(
+            arc_initial_kepler_elements, EARTH_GRAVITATIONAL_PARAMETER)
+        single_arc_settings.append(create_translational_propagator_settings(
+            bodies, arc_initial_state, arc_start_time, arc_start_time + ARC_DURATION))
+        observation_times += list(np.arange(arc_start_time + 60.0, arc_start_time + ARC_DURATION - 60.0, 60.0))
+
+    propagator_settings = propagation_setup.propagator.multi_arc(single_arc_settings)
+    estimator, covariance_output = create_estimator_and_covariance(bodies, propagator_settings, observation_times)
+    return estimator, covariance_output, bodies
+
+
+def test_stacked_output_matches_split_output(create_bodies):
+    estimator, covariance_output, _ = create_single_arc_estimator(create_bodies)
+
+    _, split_covariance = estimation.propagate_covariance_rsw_split_output(covariance_output, estimator, OUTPUT_TIMES)
+    _, split_formal_errors = estimation.propagate_formal_errors_rsw_split_output(
+        covariance_output, estimator, OUTPUT_TIMES)
+
+    # Results are computed per epoch, so that they do not depend on the number of threads
+    for number_of_threads in [1, 4]:
+        stacked_epochs, stacked_covariance = estimation.propagate_covariance_rsw_stacked_output(
+            covariance_output, estimator, OUTPUT_TIMES, number_of_threads=number_of_threads)
+        np.testing.assert_array_equal(stacked_epochs, OUTPUT_TIMES)
+        assert stacked_covariance.shape == (len(OUTPUT_TIMES), 7, 7)
+        np.testing.assert_array_equal(stacked_covariance, np.array(split_covariance))
+
+        stacked_epochs, stacked_formal_errors = estimation.propagate_formal_errors_rsw_stacked_output(
+            covariance_output, estimator, OUTPUT_TIMES, number_of_threads=number_of_threads)
+        np.testing.assert_array_equal(stacked_epochs, OUTPUT_TIMES)
+        assert stacked_formal_errors.shape == (len(OUTPUT_TIMES), 7)
+        np.testing.assert_array_equal(stacked_formal_errors, np.array(split_formal_errors))
+
+
+def test_multi_arc_rsw_covariance(create_bodies):
+    estimator, covariance_output, bodies = create_multi_arc_estimator(create_bodies)
+    output_times = [arc_start_time + offset for arc_start_time in ARC_START_TIMES for offset in [0.0, 1000.0, 4000.0]]
+
+    inertial_covariance = estimation.propagate_covariance(
+        covariance_output.covariance, estimator.state_transition_interface, output_times)
+    rsw_epochs, rsw_covariance = estimation.propagate_covariance_rsw_stacked_output(
+        covariance_output, estimator, output_times, number_of_threads=1)
+    _, rsw_formal_errors = estimation.propagate_formal_errors_rsw_stacked_output(
+        covariance_output, estimator, output_times, number_of_threads=1)
+    np.testing.assert_array_equal(rsw_epochs, output_times)
+
+    # Covariance of the propagated state, in the RSW frame of the satellite in the arc containing the epoch
+    assert rsw_covariance.shape == (len(output_times), 6, 6)
+    for i, epoch in enumerate(output_times):
+        expected_covariance = rotate_to_rsw(inertial_covariance[epoch], bodies, epoch, [0])
+        assert_matrices_close(rsw_covariance[i], expected_covariance)
+        np.testing.assert_allclose(
+            rsw_formal_errors[i], np.sqrt(np.diag(expected_covariance)), rtol=COVARIANCE_RELATIVE_TOLERANCE, atol=0.0)
+
+    # Arcs are processed concurrently, writing the results of each epoch to its own entry
+    _, parallel_rsw_covariance = estimation.propagate_covariance_rsw_stacked_output(
+        covariance_output, estimator, output_times, number_of_threads=2)
+    np.testing.assert_array_equal(parallel_rsw_covariance, rsw_covariance)
+
+
+def test_multi_arc_epoch_before_first_arc(create_bodies):
+    estimator, covariance_output, _ = create_multi_arc_estimator(create_bodies)
+
+    with pytest.raises(RuntimeError, match="before the start of the first arc"):
+        estimation.propagate_covariance_rsw_stacked_output(
+            covariance_output, estimator, [ARC_START_TIMES[0] - 300.0])
@@ -0,0 +1,251 @@
+import numpy as np
+import pytest
+
+from tudatpy.kernel import numerical_simulation
+from tudatpy.kernel.astro import element_conversion
+from tudatpy.kernel.numerical_simulation import propagation_setup, estimation, estimation_setup
+
+EARTH_GRAVITATIONAL_PARAMETER = 3.986004418E14
+INITIAL_TIME = 0.0
+FINAL_TIME = 10800.0
+OBSERVATION_TIMES = list(np.arange(60.0, FINAL_TIME - 600.0, 60.0))
+NUMBER_OF_BATCHES = 4
+OBSERVATION_WEIGHT = 1.0
+
+INITIAL_STATE = element_conversion.keplerian_to_cartesian_elementwise(
+    semi_major_axis=7000.0E3, eccentricity=0.05, inclination=np.deg2rad(50.0),
+    argument_of_periapsis=np.deg2rad(20.0), longitude_of_ascending_node=np.deg2rad(30.0), true_anomaly=0.0,
+    gravitational_parameter=EARTH_GRAVITATIONAL_PARAMETER)
+INITIAL_STATE_PERTURBATION = np.array([10.0, -5.0, 8.0, 1.0E-2, -5.0E-3, 8.0E-3])
+
+# The filter (QR decomposition) and the estimator (normal equations) differ only in rounding errors
+POSITION_TOLERANCE = 1.0E-3
+VELOCITY_TOLERANCE = 1.0E-6
+COVARIANCE_RELATIVE_TOLERANCE = 1.0E-6
+
+
+def create_link_definition():
+    return estimation_setup.observation.link_definition({
+        estimation_setup.observation.LinkEndType.observed_body:
+            estimation_setup.observation.body_origin_link_end_id("Satellite")})
+
+
+def create_estimator(create_bodies, initial_state):
+    # Estimator of the initial state of the satellite, from its Cartesian position
+    bodies = create_bodies(EARTH_GRAVITATIONAL_PARAMETER)
+    acceleration_models = propagation_setup.create_acceleration_models(
+        bodies, {"Satellite": {"Earth": [propagation_setup.acceleration.point_mass_gravity()]}},
+        ["Satellite"], ["Earth"])
+    integrator_settings = propagation_setup.integrator.runge_kutta_fixed_step_size(
+        30.0, propagation_setup.integrator.CoefficientSets.rkf_78)
+    propagator_settings = propagation_setup.propagator.translational(
+        ["Earth"], acceleration_models, ["Satellite"], initial_state, INITIAL_TIME, integrator_settings,
+        propagation_setup.propagator.time_termination(FINAL_TIME))
+
+    parameter_settings = estimation_setup.parameter.initial_states(propagator_settings, bodies)
+    estimated_parameters = estimation_setup.create_parameter_set(parameter_settings, bodies, propagator_settings)
+    observation_settings = [estimation_setup.observation.cartesian_position(create_link_definition())]
+    estimator = numerical_simulation.Estimator(
+        bodies, estimated_parameters, observation_settings, propagator_settings)
+    return estimator, bodies
+
+
+def simulate_observations(create_bodies, observation_times):
+    estimator, bodies = create_estimator(create_bodies, INITIAL_STATE)
+    simulation_settings = [estimation_setup.observation.tabulated_simulation_settings(
+        estimation_setup.observation.ObservableType.position_observable_type, create_link_definition(),
+        list(observation_times), reference_link_end_type=estimation_setup.observation.LinkEndType.observed_body)]
+    return estimation.simulate_observations(simulation_settings, estimator.observation_simulators, bodies)
+
+
+def simulate_observation_batches(create_bodies):
+    return [simulate_observations(create_bodies, batch_times)
+            for batch_times in np.array_split(OBSERVATION_TIMES, NUMBER_OF_BATCHES)]
+
+
+def assert_states_close(state, reference_state):
+    np.testing.assert_allclose(state[:3], reference_state[:3], rtol=0.0, atol=POSITION_TOLERANCE)
+    np.testing.assert_allclose(state[3:], reference_state[3:], rtol=0.0, atol=VELOCITY_TOLERANCE)
+
+
+def assert_matrices_close(matrix, reference_matrix):
+    # Symmetric positive-definite matrices, compared after scaling by the square roots of their diagonals, as (near-)zero
+    # entries are only determined up to the rounding errors of the diagonal entries
+    scaling = np.outer(np.sqrt(np.diag(reference_matrix)), np.sqrt(np.diag(reference_matrix)))
+    np.testing.assert_allclose(
+        matrix / scaling, reference_matrix / scaling, rtol=0.0, atol=COVARIANCE_RELATIVE_TOLERANCE)
+
+
+def test_filter_matches_estimator_iteration(create_bodies):
+    perturbed_initial_state = INITIAL_STATE + INITIAL_STATE_PERTURBATION
+
+    filter_estimator, _ = create_estimator(create_bodies, perturbed_initial_state)
+    square_root_information_filter = numerical_simulation.SquareRootInformationFilter(filter_estimator)
+    for observation_batch in simulate_observation_batches(create_bodies):
+        square_root_information_filter.add_observations(observation_batch, weight=OBSERVATION_WEIGHT)
+
+    assert square_root_information_filter.number_of_batches == NUMBER_OF_BATCHES
+    assert square_root_information_filter.number_of_observations == 3 * len(OBSERVATION_TIMES)
+    np.testing.assert_array_equal(square_root_information_filter.reference_parameters, perturbed_initial_state)
+
+    # Without relinearization, the filter estimate is that of the first iteration of the batch estimator
+    observations = simulate_observations(create_bodies, OBSERVATION_TIMES)
+    estimation_input = estimation.EstimationInput(
+        observations, convergence_checker=estimation.estimation_convergence_checker(maximum_iterations=2))
+    estimation_input.define_estimation_settings(print_output_to_terminal=False)
+    estimation_input.set_constant_weight(OBSERVATION_WEIGHT)
+    reference_estimator, _ = create_estimator(create_bodies, perturbed_initial_state)
+    reference_output = reference_estimator.perform_estimation(estimation_input)
+    assert_states_close(square_root_information_filter.parameter_estimate, reference_output.parameter_history[:, 1])
+
+    # Covariance at the reference parameters, at which the partials of the filter are computed
+    covariance_analysis_input = estimation.CovarianceAnalysisInput(observations)
+    covariance_analysis_input.define_covariance_settings(print_output_to_terminal=False)
+    covariance_analysis_input.set_constant_weight(OBSERVATION_WEIGHT)
+    covariance_estimator, _ = create_estimator(create_bodies, perturbed_initial_state)
+    covariance_output = covariance_estimator.compute_covariance(covariance_analysis_input)
+    assert_matrices_close(square_root_information_filter.covariance, covariance_output.covariance)
+    np.testing.assert_allclose(
+        square_root_information_filter.formal_errors, covariance_output.formal_errors,
+        rtol=COVARIANCE_RELATIVE_TOLERANCE, atol=0.0)
+
+
+def test_batches_are_equivalent_to_single_batch(create_bodies):
+    perturbed_initial_state = INITIAL_STATE + INITIAL_STATE_PERTURBATION
+
+    batch_estimator, _ = create_estimator(create_bodies, perturbed_initial_state)
+    batch_filter = numerical_simulation.SquareRootInformationFilter(batch_estimator)
+    batch_residuals = [batch_filter.add_observations(observation_batch)
+                       for observation_batch in simulate_observation_batches(create_bodies)]
+
+    single_estimator, _ = create_estimator(create_bodies, perturbed_initial_state)
+    single_filter = numerical_simulation.SquareRootInformationFilter(single_estimator)
+    single_residuals = single_filter.add_observations(simulate_observations(create_bodies, OBSERVATION_TIMES))
+    assert single_filter.number_of_batches == 1
+
+    # The residuals are computed at the reference parameters, whichever batch the observations are in
+    np.testing.assert_allclose(np.concatenate(batch_residuals), single_residuals, rtol=0.0, atol=1.0E-6)
+    assert_states_close(batch_filter.parameter_estimate, single_filter.parameter_estimate)
+    assert_matrices_close(batch_filter.covariance, single_filter.covariance)
+    assert batch_filter.residual_sum_of_squares == pytest.approx(single_filter.residual_sum_of_squares, abs=1.0E-6)
+
+
+def test_a_priori_covariance(create_bodies):
+    a_priori_covariance = np.diag([100.0, 100.0, 100.0, 1.0E-4, 1.0E-4, 1.0E-4])
+    inverse_a_priori_covariance = np.linalg.inv(a_priori_covariance)
+
+    # Before any observations are added, the covariance is the a priori covariance
+    estimator, _ = create_estimator(create_bodies, INITIAL_STATE)
+    square_root_information_filter = numerical_simulation.SquareRootInformationFilter(
+        estimator, inverse_apriori_covariance=inverse_a_priori_covariance)
+    assert_matrices_close(square_root_information_filter.covariance, a_priori_covariance)
+    np.testing.assert_array_equal(square_root_information_filter.parameter_estimate, INITIAL_STATE)
+
+    observations = simulate_observations(create_bodies, OBSERVATION_TIMES)
+    square_root_information_filter.add_observations(observations, weight=OBSERVATION_WEIGHT)
+
+    covariance_analysis_input = estimation.CovarianceAnalysisInput(
+        observations, inverse_apriori_covariance=inverse_a_priori_covariance)
+    covariance_analysis_input.define_covariance_settings(print_output_to_terminal=False)
+    covariance_analysis_input.set_constant_weight(OBSERVATION_WEIGHT)
+    covariance_estimator, _ = create_estimator(create_bodies, INITIAL_STATE)
+    covariance_output = covariance_estimator.compute_covariance(covariance_analysis_input)
+    assert_matrices_close(square_root_information_filter.covariance, covariance_output.covariance)
+
+
+def test_relinearization(create_bodies):
+    perturbed_initial_state = INITIAL_STATE + INITIAL_STATE_PERTURBATION
+    observation_batches = simulate_observation_batches(create_bodies)
+
+    estimator, _ = create_estimator(create_bodies, perturbed_initial_state)
+    square_root_information_filter = numerical_simulation.SquareRootInformationFilter(estimator)
+    square_root_information_filter.add_observations(observation_batches[0])
+    square_root_information_filter.add_observations(observation_batches[1])
+    parameter_estimate = square_root_information_filter.parameter_estimate
+
+    # The reference is moved to the estimate, keeping the information of the observations processed so far
+    square_root_information_filter.relinearize()
+    np.testing.assert_allclose(
+        square_root_information_filter.reference_parameters, parameter_estimate, rtol=0.0, atol=1.0E-9)
+    assert_states_close(square_root_information_filter.parameter_estimate, parameter_estimate)
+
+    # Residuals of the remaining (noise-free) observations, w.r.t. the already converged reference, are small
+    for observation_batch in observation_batches[2:]:
+        residuals = square_root_information_filter.add_observations(observation_batch)
+        np.testing.assert_allclose(residuals, 0.0, rtol=0.0, atol=1.0E-2)
+
+    # The information of the first batches retains the (second-order) linearization error at the initial reference
+    final_estimate = square_root_information_filter.parameter_estimate
+    np.testing.assert_allclose(final_estimate[:3], INITIAL_STATE[:3], rtol=0.0, atol=1.0E-2)
+    np.testing.assert_allclose(final_estimate[3:], INITIAL_STATE[3:], rtol=0.0, atol=1.0E-5)
+
+
+def test_propagation_without_process_noise(create_bodies):
+    perturbed_initial_state = INITIAL_STATE + INITIAL_STATE_PERTURBATION
+    observation_batches = simulate_observation_batches(create_bodies)
+
+    reference_estimator, _ = create_estimator(create_bodies, perturbed_initial_state)
+    reference_filter = numerical_simulation.SquareRootInformationFilter(reference_estimator)
+    estimator, _ = create_estimator(create_bodies, perturbed_initial_state)
+    square_root_information_filter = numerical_simulation.SquareRootInformationFilter(estimator)
+    assert square_root_information_filter.current_epoch == INITIAL_TIME
+
+    # Propagating to the first epoch of each batch only changes the epoch at which the information is expressed
+    for observation_batch in observation_batches:
+        reference_filter.add_observations(observation_batch)
+        square_root_information_filter.propagate_to_epoch(min(observation_batch.concatenated_times))
+        square_root_information_filter.add_observations(observation_batch)
+    current_epoch = square_root_information_filter.current_epoch
+    assert current_epoch == min(observation_batches[-1].concatenated_times)
+
+    assert_states_close(square_root_information_filter.parameter_estimate, reference_filter.parameter_estimate)
+    assert_matrices_close(square_root_information_filter.covariance, reference_filter.covariance)
+    assert_matrices_close(
+        square_root_information_filter.current_covariance,
+        reference_filter.propagated_covariance([current_epoch])[current_epoch])
+
+    with pytest.raises(RuntimeError, match="is before current epoch"):
+        square_root_information_filter.propagate_to_epoch(INITIAL_TIME)
+
+
+def test_propagation_with_process_noise(create_bodies):
+    observation_batches = simulate_observation_batches(create_bodies)
+    process_noise_covariance = np.diag([1.0E2, 2.0E2, 3.0E2, 1.0E-4, 2.0E-4, 3.0E-4])
+
+    estimator, _ = create_estimator(create_bodies, INITIAL_STATE)
+    square_root_information_filter = numerical_simulation.SquareRootInformationFilter(estimator)
+    square_root_information_filter.add_observations(observation_batches[0])
+    epoch = min(observation_batches[1].concatenated_times)
+    propagated_covariance = square_root_information_filter.propagated_covariance([epoch])[epoch]
+
+    # The time update adds the process noise to the covariance of the state, mapped to the new epoch
+    epochs = []
+
+    def process_noise_function(previous_epoch, new_epoch):
+        epochs.append((previous_epoch, new_epoch))
+        return process_noise_covariance
+
+    square_root_information_filter.set_process_noise_function(process_noise_function)
+    square_root_information_filter.propagate_to_epoch(epoch)
+    assert epochs == [(INITIAL_TIME, epoch)]
+    assert_matrices_close(
+        square_root_information_filter.current_covariance, propagated_covariance + process_noise_covariance)
+
+    # An explicit process noise covariance takes precedence over the function
+    square_root_information_filter.set_process_noise_function(None)
+    with pytest.raises(RuntimeError, match="inconsistent with state size"):
+        square_root_information_filter.propagate_to_epoch(epoch, np.eye(3))
+
+    # Noise-free observations: the estimate remains at the true initial state
+    square_root_information_filter.add_observations(observation_batches[1])
+    assert_states_close(square_root_information_filter.parameter_estimate, INITIAL_STATE)
+
+
+def test_inconsistent_weights(create_bodies):
+    estimator, _ = create_estimator(create_bodies, INITIAL_STATE)
+    square_root_information_filter = numerical_simulation.SquareRootInformationFilter(estimator)
+    observations = simulate_observations(create_bodies, OBSERVATION_TIMES)
+
+    with pytest.raises(RuntimeError):
+        square_root_information_filter.add_observations(observations, np.ones(5))
+    assert square_root_information_filter.number_of_batches == 0
@@ -0,0 +1,90 @@
+import numpy as np
+import pytest
+
+from tudatpy.kernel import numerical_simulation
+from tudatpy.kernel.astro import element_conversion
+from tudatpy.kernel.numerical_simulation import propagation_setup
+
+EARTH_GRAVITATIONAL_PARAMETER = 3.986004418E14
+INITIAL_TIME = 0.0
+FINAL_TIME = 20000.0
+
+
+def create_propagator_settings(bodies, integrator_settings):
+    acceleration_models = propagation_setup.create_acceleration_models(
+        bodies, {"Satellite": {"Earth": [propagation_setup.acceleration.point_mass_gravity()]}},
+        ["Satellite"], ["Earth"])
+    initial_state = element_conversion.keplerian_to_cartesian_elementwise(
+        semi_major_axis=8000.0E3, eccentricity=0.2, inclination=np.deg2rad(30.0),
+        argument_of_periapsis=0.0, longitude_of_ascending_node=0.0, true_anomaly=0.0,
+        gravitational_parameter=EARTH_GRAVITATIONAL_PARAMETER)
+    return propagation_setup.propagator.translational(
+        ["Earth"], acceleration_models, ["Satellite"], initial_state, INITIAL_TIME, integrator_settings,
+        propagation_setup.propagator.time_termination(FINAL_TIME))
+
+
+def create_variable_step_integrator_settings():
+    return propagation_setup.integrator.runge_kutta_variable_step_size(
+        10.0, propagation_setup.integrator.CoefficientSets.rkf_78, 1.0E-3, 1000.0, 1.0E-10, 1.0E-10)
+
+
+def create_stepwise_simulator(create_bodies, integrator_settings):
+    bodies = create_bodies(EARTH_GRAVITATIONAL_PARAMETER)
+    return numerical_simulation.SingleArcStepwiseSimulator(
+        bodies, create_propagator_settings(bodies, integrator_settings))
+
+
+def create_adams_bashforth_moulton_integrator_settings():
+    return propagation_setup.integrator.adams_bashforth_moulton(
+        10.0, 1.0E-3, 1000.0, 1.0E-10, 1.0E-10)
+
+
+def propagate_to_end(dynamics_simulator):
+    while not dynamics_simulator.is_terminated:
+        dynamics_simulator.step()
+
+
+def assert_resumed_propagation_is_identical(create_bodies, checkpoint_file, create_integrator_settings):
+    # Uninterrupted propagation, with a checkpoint written part-way
+    reference_simulator = create_stepwise_simulator(create_bodies, create_integrator_settings())
+    reference_simulator.initialize_propagation()
+    reference_simulator.step(25)
+    checkpoint_time = reference_simulator.current_time
+    checkpoint_time_step = reference_simulator.current_time_step
+    reference_simulator.checkpoint(checkpoint_file)
+    propagate_to_end(reference_simulator)
+
+    # Propagation resumed in a new simulator, created with the same settings
+    resumed_simulator = create_stepwise_simulator(create_bodies, create_integrator_settings())
+    resumed_simulator.resume(checkpoint_file)
+    assert resumed_simulator.current_time == checkpoint_time
+    assert resumed_simulator.current_time_step == checkpoint_time_step
+    propagate_to_end(resumed_simulator)
+
+    assert resumed_simulator.integration_completed_successfully
+    reference_history = reference_simulator.propagation_results.state_history
+    resumed_history = resumed_simulator.propagation_results.state_history
+    assert list(resumed_history.keys()) == list(reference_history.keys())
+    for epoch in reference_history.keys():
+        np.testing.assert_array_equal(resumed_history[epoch], reference_history[epoch])
+
+    # The state derivative evaluations made when resuming are not counted
+    assert resumed_simulator.total_number_of_function_evaluations == \
+        reference_simulator.total_number_of_function_evaluations
+
+
+def test_resumed_propagation_is_identical(create_bodies, tmp_path):
+    assert_resumed_propagation_is_identical(
+        create_bodies, str(tmp_path / "propagation.ckpt"), create_variable_step_integrator_settings)
+
+
+def test_resumed_adams_bashforth_moulton_propagation_is_identical(create_bodies, tmp_path):
+    # The multistep history of the integrator is restored from the checkpoint
+    assert_resumed_propagation_is_identical(
+        create_bodies, str(tmp_path / "propagation.ckpt"), create_adams_bashforth_moulton_integrator_settings)
+
+
+def test_checkpoint_requires_running_propagation(create_bodies, tmp_path):
+    dynamics_simulator = create_stepwise_simulator(create_bodies, create_variable_step_integrator_settings())
+    with pytest.raises(RuntimeError):
+        dynamics_simulator.checkpoint(str(tmp_path / "propagation.ckpt"))
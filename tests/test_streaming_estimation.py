@@ -0,0 +1,175 @@
+import numpy as np
+import pytest
+
+from tudatpy.kernel import numerical_simulation
+from tudatpy.kernel.astro import element_conversion
+from tudatpy.kernel.numerical_simulation import propagation_setup, estimation, estimation_setup
+
+EARTH_GRAVITATIONAL_PARAMETER = 3.986004418E14
+INITIAL_TIME = 0.0
+FINAL_TIME = 10800.0
+OBSERVATION_TIMES = list(np.arange(60.0, FINAL_TIME - 600.0, 60.0))
+OBSERVATION_WEIGHT = 1.0
+
+INITIAL_STATE = element_conversion.keplerian_to_cartesian_elementwise(
+    semi_major_axis=7000.0E3, eccentricity=0.05, inclination=np.deg2rad(50.0),
+    argument_of_periapsis=np.deg2rad(20.0), longitude_of_ascending_node=np.deg2rad(30.0), true_anomaly=0.0,
+    gravitational_parameter=EARTH_GRAVITATIONAL_PARAMETER)
+INITIAL_STATE_PERTURBATION = np.array([10.0, -5.0, 8.0, 1.0E-2, -5.0E-3, 8.0E-3])
+
+# Both implementations solve the same normal equations, differing only in rounding errors
+POSITION_TOLERANCE = 1.0E-3
+VELOCITY_TOLERANCE = 1.0E-6
+COVARIANCE_RELATIVE_TOLERANCE = 1.0E-6
+
+
+def create_link_definition():
+    return estimation_setup.observation.link_definition({
+        estimation_setup.observation.LinkEndType.observed_body:
+            estimation_setup.observation.body_origin_link_end_id("Satellite")})
+
+
+def create_estimator(create_bodies, initial_state, bodies=None):
+    # Estimator of the initial state of the satellite, from its Cartesian position, each with its own bodies by default
+    if bodies is None:
+        bodies = create_bodies(EARTH_GRAVITATIONAL_PARAMETER)
+    acceleration_models = propagation_setup.create_acceleration_models(
+        bodies, {"Satellite": {"Earth": [propagation_setup.acceleration.point_mass_gravity()]}},
+        ["Satellite"], ["Earth"])
+    integrator_settings = propagation_setup.integrator.runge_kutta_fixed_step_size(
+        30.0, propagation_setup.integrator.CoefficientSets.rkf_78)
+    propagator_settings = propagation_setup.propagator.translational(
+        ["Earth"], acceleration_models, ["Satellite"], initial_state, INITIAL_TIME, integrator_settings,
+        propagation_setup.propagator.time_termination(FINAL_TIME))
+
+    parameter_settings = estimation_setup.parameter.initial_states(propagator_settings, bodies)
+    estimated_parameters = estimation_setup.create_parameter_set(parameter_settings, bodies, propagator_settings)
+    observation_settings = [estimation_setup.observation.cartesian_position(create_link_definition())]
+    estimator = numerical_simulation.Estimator(
+        bodies, estimated_parameters, observation_settings, propagator_settings)
+    return estimator, estimated_parameters, bodies
+
+
+def simulate_observations(create_bodies):
+    estimator, _, bodies = create_estimator(create_bodies, INITIAL_STATE)
+    simulation_settings = [estimation_setup.observation.tabulated_simulation_settings(
+        estimation_setup.observation.ObservableType.position_observable_type, create_link_definition(),
+        OBSERVATION_TIMES, reference_link_end_type=estimation_setup.observation.LinkEndType.observed_body)]
+    return estimation.simulate_observations(simulation_settings, estimator.observation_simulators, bodies)
+
+
+def create_estimation_input(observations, maximum_iterations):
+    estimation_input = estimation.EstimationInput(
+        observations,
+        convergence_checker=estimation.estimation_convergence_checker(maximum_iterations=maximum_iterations))
+    estimation_input.define_estimation_settings(print_output_to_terminal=False)
+    estimation_input.set_constant_weight(OBSERVATION_WEIGHT)
+    return estimation_input
+
+
+def create_covariance_analysis_input(observations):
+    covariance_analysis_input = estimation.CovarianceAnalysisInput(observations)
+    covariance_analysis_input.define_covariance_settings(print_output_to_terminal=False)
+    covariance_analysis_input.set_constant_weight(OBSERVATION_WEIGHT)
+    return covariance_analysis_input
+
+
+def assert_states_close(state, reference_state):
+    np.testing.assert_allclose(state[:3], reference_state[:3], rtol=0.0, atol=POSITION_TOLERANCE)
+    np.testing.assert_allclose(state[3:], reference_state[3:], rtol=0.0, atol=VELOCITY_TOLERANCE)
+
+
+def assert_matrices_close(matrix, reference_matrix):
+    # Symmetric positive-definite matrices, compared after scaling by the square roots of their diagonals, as (near-)zero
+    # entries are only determined up to the rounding errors of the diagonal entries
+    scaling = np.outer(np.sqrt(np.diag(reference_matrix)), np.sqrt(np.diag(reference_matrix)))
+    np.testing.assert_allclose(
+        matrix / scaling, reference_matrix / scaling, rtol=0.0, atol=COVARIANCE_RELATIVE_TOLERANCE)
+
+
+def test_streaming_estimation_matches_estimator(create_bodies):
+    observations = simulate_observations(create_bodies)
+    perturbed_initial_state = INITIAL_STATE + INITIAL_STATE_PERTURBATION
+
+    reference_estimator, reference_parameters, _ = create_estimator(create_bodies, perturbed_initial_state)
+    reference_output = reference_estimator.perform_estimation(create_estimation_input(observations, 3))
+
+    streaming_estimators = [create_estimator(create_bodies, perturbed_initial_state)[0] for _ in range(2)]
+    streaming_output = numerical_simulation.perform_streaming_estimation(
+        streaming_estimators, create_estimation_input(observations, 3))
+
+    # Same iterations: the parameters at the start of each iteration, and the final (best) estimate
+    number_of_iterations = min(len(streaming_output.parameter_history), reference_output.parameter_history.shape[1])
+    assert number_of_iterations >= 3
+    for iteration in range(number_of_iterations):
+        assert_states_close(
+            streaming_output.parameter_history[iteration], reference_output.parameter_history[:, iteration])
+    assert_states_close(streaming_output.parameter_estimate, reference_parameters.parameter_vector)
+    assert_states_close(streaming_output.parameter_estimate, INITIAL_STATE)
+
+    assert_matrices_close(streaming_output.covariance, reference_output.covariance)
+    np.testing.assert_allclose(
+        streaming_output.formal_errors, reference_output.formal_errors, rtol=COVARIANCE_RELATIVE_TOLERANCE, atol=0.0)
+    assert len(streaming_output.final_residuals) == len(observations.concatenated_observations)
+
+
+def test_parallel_estimation_matches_estimator(create_bodies):
+    observations = simulate_observations(create_bodies)
+    perturbed_initial_state = INITIAL_STATE + INITIAL_STATE_PERTURBATION
+
+    reference_estimator, reference_parameters, _ = create_estimator(create_bodies, perturbed_initial_state)
+    reference_output = reference_estimator.perform_estimation(create_estimation_input(observations, 3))
+
+    # Each call of the factory creates an estimator with its own bodies
+    parallel_parameters = []
+
+    def create_parallel_estimator(thread_index):
+        estimator, estimated_parameters, _ = create_estimator(create_bodies, perturbed_initial_state)
+        parallel_parameters.append(estimated_parameters)
+        return estimator
+
+    parallel_output = numerical_simulation.perform_estimation_in_parallel(
+        create_parallel_estimator, create_estimation_input(observations, 3), number_of_threads=3)
+
+    assert len(parallel_parameters) == 3
+    assert_states_close(parallel_output.parameter_estimate, reference_parameters.parameter_vector)
+    assert_states_close(parallel_output.parameter_estimate, INITIAL_STATE)
+    for estimated_parameters in parallel_parameters:
+        np.testing.assert_array_equal(estimated_parameters.parameter_vector, parallel_output.parameter_estimate)
+    assert_matrices_close(parallel_output.covariance, reference_output.covariance)
+
+
+def test_streaming_covariance_matches_estimator(create_bodies):
+    observations = simulate_observations(create_bodies)
+
+    reference_estimator, _, _ = create_estimator(create_bodies, INITIAL_STATE)
+    reference_output = reference_estimator.compute_covariance(create_covariance_analysis_input(observations))
+
+    # The result does not depend on the number of estimators, nor on the size of the blocks of observations. The single
+    # observation set (of 3 entries per observation time) is split into ranges of times when it exceeds the block size,
+    # including block sizes that are not a multiple of, or smaller than, the size of the observable
+    for number_of_estimators, minimum_block_size in [(1, 0), (3, 0), (3, 100), (2, 7), (2, 1)]:
+        streaming_estimators = [create_estimator(create_bodies, INITIAL_STATE)[0] for _ in range(number_of_estimators)]
+        streaming_output = numerical_simulation.compute_streaming_covariance(
+            streaming_estimators, create_covariance_analysis_input(observations),
+            minimum_block_size=minimum_block_size)
+
+        assert_matrices_close(streaming_output.inverse_covariance, reference_output.inverse_covariance)
+        assert_matrices_close(streaming_output.covariance, reference_output.covariance)
+        np.testing.assert_allclose(
+            streaming_output.formal_errors, reference_output.formal_errors,
+            rtol=COVARIANCE_RELATIVE_TOLERANCE, atol=0.0)
+
+        # Noise-free observations, simulated with the estimated initial state
+        np.testing.assert_allclose(streaming_output.final_residuals, 0.0, rtol=0.0, atol=POSITION_TOLERANCE)
+        np.testing.assert_array_equal(streaming_output.parameter_estimate, INITIAL_STATE)
+
+
+def test_streaming_estimation_rejects_shared_bodies(create_bodies):
+    observations = simulate_observations(create_bodies)
+
+    # The estimators are evaluated concurrently, so that they may not modify the same bodies
+    shared_bodies = create_bodies(EARTH_GRAVITATIONAL_PARAMETER)
+    streaming_estimators = [create_estimator(create_bodies, INITIAL_STATE, shared_bodies)[0] for _ in range(2)]
+    with pytest.raises(RuntimeError):
+        numerical_simulation.perform_streaming_estimation(streaming_estimators, create_estimation_input(observations, 3))
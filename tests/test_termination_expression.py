@@ -0,0 +1,116 @@
+import numpy as np
+import pytest
+
+from tudatpy.kernel import numerical_simulation
+from tudatpy.kernel.astro import element_conversion
+from tudatpy.kernel.numerical_simulation import propagation_setup
+
+EARTH_GRAVITATIONAL_PARAMETER = 3.986004418E14
+INITIAL_TIME = 0.0
+TIME_STEP = 10.0
+
+
+def create_distance_variables():
+    return {"distance": propagation_setup.dependent_variable.relative_distance("Satellite", "Earth")}
+
+
+def propagate(create_bodies, termination_settings, time_step=TIME_STEP):
+    # Eccentric orbit, starting at periapsis (distance of 6400 km, increasing to 9600 km at apoapsis)
+    bodies = create_bodies(EARTH_GRAVITATIONAL_PARAMETER)
+    acceleration_models = propagation_setup.create_acceleration_models(
+        bodies, {"Satellite": {"Earth": [propagation_setup.acceleration.point_mass_gravity()]}},
+        ["Satellite"], ["Earth"])
+    initial_state = element_conversion.keplerian_to_cartesian_elementwise(
+        semi_major_axis=8000.0E3, eccentricity=0.2, inclination=np.deg2rad(30.0),
+        argument_of_periapsis=0.0, longitude_of_ascending_node=0.0, true_anomaly=0.0,
+        gravitational_parameter=EARTH_GRAVITATIONAL_PARAMETER)
+    integrator_settings = propagation_setup.integrator.runge_kutta_fixed_step_size(
+        time_step, propagation_setup.integrator.CoefficientSets.rk_4)
+    propagator_settings = propagation_setup.propagator.translational(
+        ["Earth"], acceleration_models, ["Satellite"], initial_state, INITIAL_TIME, integrator_settings,
+        termination_settings)
+    return numerical_simulation.create_dynamics_simulator(bodies, propagator_settings).propagation_results.state_history
+
+
+def get_final_time(create_bodies, expression, **kwargs):
+    state_history = propagate(create_bodies, propagation_setup.propagator.expression_termination(expression, **kwargs))
+    return max(state_history.keys())
+
+
+def test_operator_precedence(create_bodies):
+    # Conjunctions bind more strongly than disjunctions, parentheses override this
+    assert get_final_time(create_bodies, "time > 300 or time > 100 and time > 1000") == 300.0
+    assert get_final_time(create_bodies, "(time > 300 || time > 100) && time > 1000") == 1000.0
+    assert get_final_time(create_bodies, "time > 1000 and time > 100 or time > 300") == 300.0
+
+    # The variable may be on either side of the comparison
+    assert get_final_time(create_bodies, "500 < time") == 500.0
+
+
+def test_negation(create_bodies):
+    assert get_final_time(create_bodies, "not (time < 400)") == 400.0
+    assert get_final_time(create_bodies, "!(time <= 400)") == 400.0
+    assert get_final_time(create_bodies, "not not time > 500") == 500.0
+
+    # Negations are propagated to the operands: not (a or b) is equivalent to (not a) and (not b)
+    assert get_final_time(create_bodies, "not (time < 400 or time < 600)") == 600.0
+    assert get_final_time(create_bodies, "not (time < 400 and time < 600)") == 400.0
+
+
+def test_time_comparison_direction(create_bodies):
+    # Time termination is met when passing the limit in the direction of propagation, so that time may only be compared
+    # in that direction
+    for expression in ["time < 1200", "not (time > 1200)", "1200 > time"]:
+        with pytest.raises(RuntimeError, match="time can only be compared"):
+            propagation_setup.propagator.expression_termination(expression)
+
+    with pytest.raises(RuntimeError, match="time can only be compared"):
+        propagation_setup.propagator.expression_termination("time > -400", propagate_backwards=True)
+
+    backward_state_history = propagate(
+        create_bodies, propagation_setup.propagator.expression_termination("time < -400", propagate_backwards=True),
+        time_step=-TIME_STEP)
+    assert min(backward_state_history.keys()) == -400.0
+    assert max(backward_state_history.keys()) == INITIAL_TIME
+
+
+def test_cpu_time(create_bodies):
+    with pytest.raises(RuntimeError, match="cpu_time can only be used as upper limit"):
+        propagation_setup.propagator.expression_termination("cpu_time < 10.0")
+
+    termination_settings = propagation_setup.propagator.expression_termination("not (cpu_time < 10.0)")
+    assert isinstance(termination_settings, propagation_setup.propagator.PropagationCPUTimeTerminationSettings)
+
+    assert get_final_time(create_bodies, "cpu_time > 1.0E6 or time > 200") == 200.0
+
+
+def test_dependent_variable_comparison(create_bodies):
+    termination_settings = propagation_setup.propagator.expression_termination(
+        "distance > 9.0E6", create_distance_variables())
+    assert isinstance(
+        termination_settings, propagation_setup.propagator.PropagationDependentVariableTerminationSettings)
+
+    # The propagation terminates on the first step at which the distance exceeds the limit
+    state_history = propagate(create_bodies, termination_settings)
+    epochs = sorted(state_history.keys())
+    assert np.linalg.norm(state_history[epochs[-1]][:3]) >= 9.0E6
+    assert np.linalg.norm(state_history[epochs[-2]][:3]) < 9.0E6
+
+
+def test_reserved_variable_names():
+    for reserved_name in ["time", "cpu_time"]:
+        with pytest.raises(RuntimeError, match="is reserved"):
+            propagation_setup.propagator.expression_termination(
+                reserved_name + " > 1.0E6", {reserved_name: create_distance_variables()["distance"]})
+
+
+def test_undefined_variable():
+    with pytest.raises(RuntimeError, match="altitude is not defined"):
+        propagation_setup.propagator.expression_termination("altitude < 25.0E3", create_distance_variables())
+
+
+@pytest.mark.parametrize("expression", [
+    "", "time >", "(time > 1", "time > 1 )", "time >> 1", "time = 1", "and time > 1", "time > 1 or", "1 < 2"])
+def test_parse_errors(expression):
+    with pytest.raises(RuntimeError, match="Error when parsing termination expression"):
+        propagation_setup.propagator.expression_termination(expression)
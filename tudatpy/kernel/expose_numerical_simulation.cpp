@@ -8,8 +8,16 @@
  *    http://tudat.tudelft.nl/LICENSE.
  */
 
+#include "tudatpy/arrayConversion.h"
+#include "tudatpy/dependentVariablePostProcessing.h"
 #include "tudatpy/docstrings.h"
+#include "tudatpy/observationPartials.h"
+#include "tudatpy/parallelExecution.h"
 #include "tudatpy/scalarTypes.h"
+#include "tudatpy/squareRootInformationFilter.h"
+#include "tudatpy/stepwiseDynamicsSimulator.h"
+#include "tudatpy/streamingEstimation.h"
+#include "tudatpy/synchronizedEnvironment.h"
 
 #include "expose_numerical_simulation.h"
 
@@ -23,6 +31,11 @@
 
 #include "tudat/basics/timeType.h"
 
+#include <condition_variable>
+#include <cstdint>
+#include <mutex>
+#include <set>
+
 #include <pybind11/operators.h>
 #include <pybind11/stl.h>
 
@@ -33,6 +46,487 @@ namespace tni = tudat::numerical_integrators;
 namespace tep = tudat::estimatable_parameters;
 namespace tom = tudat::observation_models;
 
+namespace tudat
+{
+
+namespace propagators
+{
+
+struct BatchPropagationResults
+{
+    BatchPropagationResults( const unsigned int numberOfSamples ):
+        propagationResults_( numberOfSamples ),
+        propagationSucceeded_( numberOfSamples, 0 ),
+        failureMessages_( numberOfSamples ){ }
+
+    int getNumberOfFailedPropagations( ) const
+    {
+        return static_cast< int >( std::count( propagationSucceeded_.begin( ), propagationSucceeded_.end( ), 0 ) );
+    }
+
+    std::vector< bool > getPropagationSucceeded( ) const
+    {
+        return std::vector< bool >( propagationSucceeded_.begin( ), propagationSucceeded_.end( ) );
+    }
+
+    std::vector< std::shared_ptr< SingleArcSimulationResults< double, TIME_TYPE > > > propagationResults_;
+
+    //! Success flag per sample; one byte per flag (not std::vector< bool >), since workers write neighbouring flags concurrently
+    std::vector< std::uint8_t > propagationSucceeded_;
+
+    std::vector< std::string > failureMessages_;
+};
+
+std::string getPropagationTerminationReasonString( const PropagationTerminationReason terminationReason )
+{
+    switch( terminationReason )
+    {
+    case propagation_never_run:
+        return "propagation was never run";
+    case runtime_error_caught_in_propagation:
+        return "runtime error caught in propagation";
+    case nan_or_inf_detected_in_state:
+        return "NaN or Inf detected in state";
+    default:
+        return "unknown propagation termination reason";
+    }
+}
+
+//! Class to register the bodies used by concurrently running propagations, to detect bodies shared between them
+/*!
+ * Class to register the bodies used by concurrently running propagations, to detect bodies shared between them. While
+ * registered, the SPICE-based ephemerides and rotation models of the bodies are replaced by synchronized wrappers (see
+ * tudatpy::synchronizeSpiceAccess); the original models are put back when the bodies are deregistered, so that the
+ * bodies provided by the user are returned unmodified.
+ */
+class BodiesInUseRegistry
+{
+public:
+
+    //! Function to register the bodies of a propagation, throwing an exception if any of them is already in use
+    tudatpy::SpiceAccessSynchronization registerBodies( tss::SystemOfBodies& bodies )
+    {
+        std::lock_guard< std::mutex > lock( registryMutex_ );
+        for( auto bodyIterator : bodies.getMap( ) )
+        {
+            if( bodiesInUse_.count( bodyIterator.second.get( ) ) > 0 )
+            {
+                throw std::runtime_error(
+                            "Error in batch propagation, body " + bodyIterator.first +
+                            " is used by another propagation that is running concurrently; "
+                            "a separate body system must be provided for each sample" );
+            }
+        }
+        for( auto bodyIterator : bodies.getMap( ) )
+        {
+            bodiesInUse_.insert( bodyIterator.second.get( ) );
+        }
+        return tudatpy::synchronizeSpiceAccess( bodies );
+    }
+
+    //! Function to register the bodies of a propagation, waiting until none of them is used by another propagation
+    tudatpy::SpiceAccessSynchronization waitAndRegisterBodies( tss::SystemOfBodies& bodies )
+    {
+        std::unique_lock< std::mutex > lock( registryMutex_ );
+        bodiesReleased_.wait( lock, [ & ]( )
+        {
+            for( auto bodyIterator : bodies.getMap( ) )
+            {
+                if( bodiesInUse_.count( bodyIterator.second.get( ) ) > 0 )
+                {
+                    return false;
+                }
+            }
+            return true;
+        } );
+        for( auto bodyIterator : bodies.getMap( ) )
+        {
+            bodiesInUse_.insert( bodyIterator.second.get( ) );
+        }
+        return tudatpy::synchronizeSpiceAccess( bodies );
+    }
+
+    //! Function to deregister the bodies of a propagation, putting back the models replaced when registering them
+    void deregisterBodies( tss::SystemOfBodies& bodies, const tudatpy::SpiceAccessSynchronization& synchronization )
+    {
+        {
+            std::lock_guard< std::mutex > lock( registryMutex_ );
+            tudatpy::restoreSpiceAccess( synchronization );
+            for( auto bodyIterator : bodies.getMap( ) )
+            {
+                bodiesInUse_.erase( bodyIterator.second.get( ) );
+            }
+        }
+        bodiesReleased_.notify_all( );
+    }
+
+private:
+
+    std::set< tss::Body* > bodiesInUse_;
+
+    std::mutex registryMutex_;
+
+    std::condition_variable bodiesReleased_;
+};
+
+//! Function to call a (Python) factory of the bodies or parameters of a sample or arc from a worker thread
+/*!
+ * Function to call a (Python) factory of the bodies or parameters of a sample or arc from a worker thread. The factory
+ * may call into the (non-reentrant) CSPICE library, for instance to create the ephemerides of the bodies, while other
+ * worker threads are propagating; the call is therefore made while holding the SPICE mutex. The GIL is acquired before
+ * the SPICE mutex, in the same order as a Python callback (holding the GIL) that evaluates a synchronized model.
+ * \param factory Function returning the bodies or parameters for a given sample or arc index
+ * \param index Index of the sample or arc
+ * \return Object created by the factory
+ */
+template< typename ReturnType >
+ReturnType callFactoryFromWorkerThread(
+        const std::function< ReturnType( const unsigned int ) >& factory,
+        const std::size_t index )
+{
+    py::gil_scoped_acquire acquire;
+    std::lock_guard< std::mutex > lock( tudatpy::getSpiceMutex( ) );
+    return factory( static_cast< unsigned int >( index ) );
+}
+
+//! Function to propagate a batch of samples concurrently, each with the body system returned by the factory for it
+/*!
+ * Function to propagate a batch of samples concurrently, each with the body system returned by the factory for it. The
+ * SPICE-based models of the bodies are wrapped for the duration of the propagation only (see BodiesInUseRegistry).
+ * \param bodiesFactory Function returning the body system for a given sample index (called while holding the SPICE mutex)
+ * \param propagatorSettingsList Propagator settings of each sample
+ * \param numberOfThreads Number of threads to use (see tudatpy::getNumberOfWorkerThreads)
+ * \return Results of all samples, with the failure message of each sample for which the propagation failed
+ */
+std::shared_ptr< BatchPropagationResults > propagateBatch(
+        const std::function< tss::SystemOfBodies( const unsigned int ) > bodiesFactory,
+        const std::vector< std::shared_ptr< SingleArcPropagatorSettings< double, TIME_TYPE > > >& propagatorSettingsList,
+        const int numberOfThreads )
+{
+    std::shared_ptr< BatchPropagationResults > batchResults =
+            std::make_shared< BatchPropagationResults >( propagatorSettingsList.size( ) );
+    BodiesInUseRegistry bodiesInUseRegistry;
+
+    tudatpy::executeTasksInParallel(
+                propagatorSettingsList.size( ), numberOfThreads,
+                [ & ]( const std::size_t sampleIndex, const unsigned int )
+    {
+        try
+        {
+            tss::SystemOfBodies bodies = callFactoryFromWorkerThread( bodiesFactory, sampleIndex );
+            const tudatpy::SpiceAccessSynchronization spiceAccessSynchronization =
+                    bodiesInUseRegistry.registerBodies( bodies );
+
+            std::shared_ptr< SingleArcDynamicsSimulator< double, TIME_TYPE > > dynamicsSimulator;
+            try
+            {
+                dynamicsSimulator = std::dynamic_pointer_cast< SingleArcDynamicsSimulator< double, TIME_TYPE > >(
+                            tudatpy::createDynamicsSimulator< double, TIME_TYPE >(
+                                bodies, propagatorSettingsList.at( sampleIndex ), true ) );
+            }
+            catch( ... )
+            {
+                bodiesInUseRegistry.deregisterBodies( bodies, spiceAccessSynchronization );
+                throw;
+            }
+            bodiesInUseRegistry.deregisterBodies( bodies, spiceAccessSynchronization );
+
+            std::shared_ptr< SingleArcSimulationResults< double, TIME_TYPE > > currentResults =
+                    std::dynamic_pointer_cast< SingleArcSimulationResults< double, TIME_TYPE > >(
+                        dynamicsSimulator->getPropagationResults( ) );
+            batchResults->propagationResults_.at( sampleIndex ) = currentResults;
+
+            const PropagationTerminationReason terminationReason =
+                    tudatpy::getPropagationTerminationDetails( dynamicsSimulator )->getPropagationTerminationReason( );
+            if( terminationReason == termination_condition_reached )
+            {
+                batchResults->propagationSucceeded_.at( sampleIndex ) = 1;
+            }
+            else
+            {
+                batchResults->failureMessages_.at( sampleIndex ) = getPropagationTerminationReasonString( terminationReason );
+            }
+        }
+        catch( const std::exception& caughtException )
+        {
+            batchResults->failureMessages_.at( sampleIndex ) = caughtException.what( );
+        }
+    } );
+
+    return batchResults;
+}
+
+//! Function to propagate again from a new initial state, reusing all models created by a single-arc dynamics simulator
+/*!
+ * Function to propagate again from a new initial state, reusing the acceleration models, state derivative models,
+ * environment updater, termination conditions and dependent variable functions created by a single-arc dynamics
+ * simulator, so that only the integrator is reset. The initial time and all other settings are those of the propagator
+ * settings with which the simulator was created (which are not modified).
+ * \param dynamicsSimulator Dynamics simulator with which the propagation is performed
+ * \param initialState New initial (processed, e.g. Cartesian) state of the propagation
+ * \return Results of the propagation (the results object of the simulator, which is overwritten by the next propagation)
+ */
+std::shared_ptr< SingleArcSimulationResults< double, TIME_TYPE > > resetInitialStateAndPropagate(
+        const std::shared_ptr< SingleArcDynamicsSimulator< double, TIME_TYPE > > dynamicsSimulator,
+        const Eigen::VectorXd& initialState )
+{
+    const long expectedStateSize = dynamicsSimulator->getPropagatorSettings( )->getInitialStates( ).rows( );
+    if( initialState.rows( ) != expectedStateSize )
+    {
+        throw std::runtime_error( "Error when resetting initial state of propagation, size of initial state (" +
+                                  std::to_string( initialState.rows( ) ) + ") is inconsistent with propagator settings (" +
+                                  std::to_string( expectedStateSize ) + ")" );
+    }
+
+    dynamicsSimulator->integrateEquationsOfMotion( initialState );
+    return std::dynamic_pointer_cast< SingleArcSimulationResults< double, TIME_TYPE > >(
+                dynamicsSimulator->getPropagationResults( ) );
+}
+
+//! Function to propagate from a series of initial states, reusing all models created by a single-arc dynamics simulator
+/*!
+ * Function to propagate from a series of initial states, one after the other, reusing all models created by a
+ * single-arc dynamics simulator (see resetInitialStateAndPropagate). The results of each propagation are copied from
+ * the results object of the simulator after the propagation. Results written to a result sink are overwritten by each
+ * propagation.
+ * \param dynamicsSimulator Dynamics simulator with which the propagations are performed
+ * \param initialStates Initial (processed, e.g. Cartesian) states of the propagations, one per row
+ * \return Results of the propagations, with the reason of failure of each unsuccessful propagation
+ */
+std::shared_ptr< BatchPropagationResults > resetInitialStatesAndPropagate(
+        const std::shared_ptr< SingleArcDynamicsSimulator< double, TIME_TYPE > > dynamicsSimulator,
+        const Eigen::MatrixXd& initialStates )
+{
+    std::shared_ptr< BatchPropagationResults > batchResults =
+            std::make_shared< BatchPropagationResults >( initialStates.rows( ) );
+
+    for( unsigned int i = 0; i < initialStates.rows( ); i++ )
+    {
+        try
+        {
+            batchResults->propagationResults_.at( i ) = std::make_shared< SingleArcSimulationResults< double, TIME_TYPE > >(
+                        *resetInitialStateAndPropagate( dynamicsSimulator, initialStates.row( i ).transpose( ) ) );
+
+            const PropagationTerminationReason terminationReason =
+                    tudatpy::getPropagationTerminationDetails( dynamicsSimulator )->getPropagationTerminationReason( );
+            if( terminationReason == termination_condition_reached )
+            {
+                batchResults->propagationSucceeded_.at( i ) = 1;
+            }
+            else
+            {
+                batchResults->failureMessages_.at( i ) = getPropagationTerminationReasonString( terminationReason );
+            }
+        }
+        catch( const std::exception& caughtException )
+        {
+            batchResults->failureMessages_.at( i ) = caughtException.what( );
+        }
+    }
+
+    return batchResults;
+}
+
+//! Function to execute a function for each arc of a multi-arc propagation in parallel, with the bodies of that arc
+/*!
+ * Function to execute a function for each arc of a multi-arc propagation in parallel, with the bodies of that arc.
+ * Arcs for which the body systems share one or more bodies are not run concurrently: an arc waits until its bodies are
+ * no longer used by any other arc. When a single body system is used for all arcs, the arcs are therefore run one
+ * after the other; a separate body system for each thread (or arc) is required for a speedup.
+ * \param bodiesFactory Function returning the body system to use for a given arc (with which the models in the
+ * propagator settings of that arc have been created)
+ * \param numberOfArcs Number of arcs
+ * \param numberOfThreads Number of threads to use (see tudatpy::getNumberOfWorkerThreads)
+ * \param arcFunction Function executed for each arc, called as arcFunction( arcIndex, bodies )
+ */
+template< typename ArcFunction >
+void executeArcsInParallel(
+        const std::function< tss::SystemOfBodies( const unsigned int ) > bodiesFactory,
+        const std::size_t numberOfArcs,
+        const int numberOfThreads,
+        ArcFunction arcFunction )
+{
+    BodiesInUseRegistry bodiesInUseRegistry;
+
+    tudatpy::executeTasksInParallel(
+                numberOfArcs, numberOfThreads,
+                [ & ]( const std::size_t arcIndex, const unsigned int )
+    {
+        tss::SystemOfBodies bodies = callFactoryFromWorkerThread( bodiesFactory, arcIndex );
+        const tudatpy::SpiceAccessSynchronization spiceAccessSynchronization =
+                bodiesInUseRegistry.waitAndRegisterBodies( bodies );
+        try
+        {
+            arcFunction( arcIndex, bodies );
+        }
+        catch( ... )
+        {
+            bodiesInUseRegistry.deregisterBodies( bodies, spiceAccessSynchronization );
+            throw;
+        }
+        bodiesInUseRegistry.deregisterBodies( bodies, spiceAccessSynchronization );
+    } );
+}
+
+//! Function to check whether the arcs of a multi-arc propagation are independent, so that they can be run concurrently
+/*!
+ * Function to check whether the arcs of a multi-arc propagation are independent, so that they can be run concurrently.
+ * If the initial state of each arc is transferred from the final state of the previous arc, the arcs must be
+ * propagated one after the other (with the dynamics simulators of Tudat), and an exception is thrown.
+ * \param propagatorSettings Multi-arc propagator settings
+ * \param functionName Name of the function from which the check is performed, used in the error message
+ */
+void checkArcsAreIndependent(
+        const std::shared_ptr< MultiArcPropagatorSettings< double, TIME_TYPE > > propagatorSettings,
+        const std::string& functionName )
+{
+    if( propagatorSettings->getTransferInitialStateInformationPerArc( ) )
+    {
+        throw std::runtime_error( "Error when calling " + functionName + ", the initial state of each arc is transferred "
+                                  "from the previous arc (transfer_state_to_next_arc), so that the arcs cannot be "
+                                  "propagated concurrently" );
+    }
+}
+
+//! Function to propagate the arcs of a multi-arc propagation concurrently, returning the results in arc order
+std::shared_ptr< MultiArcSimulationResults< SingleArcSimulationResults, double, TIME_TYPE > > propagateArcsInParallel(
+        const std::function< tss::SystemOfBodies( const unsigned int ) > bodiesFactory,
+        const std::shared_ptr< MultiArcPropagatorSettings< double, TIME_TYPE > > propagatorSettings,
+        const int numberOfThreads )
+{
+    checkArcsAreIndependent( propagatorSettings, "propagate_arcs_in_parallel" );
+
+    const std::vector< std::shared_ptr< SingleArcPropagatorSettings< double, TIME_TYPE > > > singleArcPropagatorSettings =
+            propagatorSettings->getSingleArcSettings( );
+    std::vector< std::shared_ptr< SingleArcSimulationResults< double, TIME_TYPE > > > singleArcResults(
+                singleArcPropagatorSettings.size( ) );
+
+    executeArcsInParallel(
+                bodiesFactory, singleArcPropagatorSettings.size( ), numberOfThreads,
+                [ & ]( const std::size_t arcIndex, tss::SystemOfBodies& bodies )
+    {
+        std::shared_ptr< DynamicsSimulator< double, TIME_TYPE > > dynamicsSimulator =
+                tudatpy::createDynamicsSimulator< double, TIME_TYPE >(
+                    bodies, singleArcPropagatorSettings.at( arcIndex ), true );
+        singleArcResults.at( arcIndex ) = std::dynamic_pointer_cast< SingleArcSimulationResults< double, TIME_TYPE > >(
+                    dynamicsSimulator->getPropagationResults( ) );
+    } );
+
+    std::shared_ptr< MultiArcSimulationResults< SingleArcSimulationResults, double, TIME_TYPE > > multiArcResults =
+            std::make_shared< MultiArcSimulationResults< SingleArcSimulationResults, double, TIME_TYPE > >( singleArcResults );
+    multiArcResults->setPropagationIsPerformed( );
+    return multiArcResults;
+}
+
+//! Function to integrate the variational equations of the arcs of a multi-arc propagation concurrently
+std::shared_ptr< MultiArcSimulationResults< SingleArcVariationalSimulationResults, double, TIME_TYPE > >
+integrateVariationalArcsInParallel(
+        const std::function< tss::SystemOfBodies( const unsigned int ) > bodiesFactory,
+        const std::shared_ptr< MultiArcPropagatorSettings< double, TIME_TYPE > > propagatorSettings,
+        const std::function< std::shared_ptr< tep::EstimatableParameterSet< double > >( const unsigned int ) > parametersFactory,
+        const int numberOfThreads )
+{
+    checkArcsAreIndependent( propagatorSettings, "integrate_variational_arcs_in_parallel" );
+
+    const std::vector< std::shared_ptr< SingleArcPropagatorSettings< double, TIME_TYPE > > > singleArcPropagatorSettings =
+            propagatorSettings->getSingleArcSettings( );
+    std::vector< std::shared_ptr< SingleArcVariationalSimulationResults< double, TIME_TYPE > > > singleArcResults(
+                singleArcPropagatorSettings.size( ) );
+
+    executeArcsInParallel(
+                bodiesFactory, singleArcPropagatorSettings.size( ), numberOfThreads,
+                [ & ]( const std::size_t arcIndex, tss::SystemOfBodies& bodies )
+    {
+        std::shared_ptr< SingleArcVariationalEquationsSolver< double, TIME_TYPE > > variationalEquationsSolver =
+                std::dynamic_pointer_cast< SingleArcVariationalEquationsSolver< double, TIME_TYPE > >(
+                    tss::createVariationalEquationsSolver< double, TIME_TYPE >(
+                        bodies, singleArcPropagatorSettings.at( arcIndex ),
+                        callFactoryFromWorkerThread( parametersFactory, arcIndex ), true ) );
+        singleArcResults.at( arcIndex ) = variationalEquationsSolver->getVariationalPropagationResults( );
+    } );
+
+    std::shared_ptr< MultiArcSimulationResults< SingleArcVariationalSimulationResults, double, TIME_TYPE > > multiArcResults =
+            std::make_shared< MultiArcSimulationResults< SingleArcVariationalSimulationResults, double, TIME_TYPE > >(
+                singleArcResults );
+    multiArcResults->setPropagationIsPerformed( );
+    return multiArcResults;
+}
+
+//! Function to compute dependent variables from the state history of a propagation, returned as array with epochs in first column
+/*!
+ * Function to compute dependent variables from the state history of a propagation, returned as array with epochs in
+ * first column (see tudatpy::computeDependentVariablesFromStateHistory). If a factory of worker simulators is provided,
+ * it is called (on the calling thread, before the GIL is released) for each additional thread, and the epochs are
+ * distributed over the dynamics simulator and the worker simulators.
+ * \param dynamicsSimulator Dynamics simulator with which the propagation was performed
+ * \param dependentVariables Dependent variables to compute
+ * \param epochs Epochs at which the dependent variables are computed (epochs of state history if empty)
+ * \param workerSimulatorFactory Function returning a simulator, with its own system of bodies, for a given worker index
+ * (epochs evaluated sequentially on the dynamics simulator if empty)
+ * \param numberOfThreads Number of threads to use if a factory is provided (see tudatpy::getNumberOfWorkerThreads)
+ * \return Dependent variables, with one row per epoch, preceded by the epoch
+ */
+py::array_t< double > computeDependentVariablesFromStateHistory(
+        const std::shared_ptr< SingleArcDynamicsSimulator< double, TIME_TYPE > > dynamicsSimulator,
+        const std::vector< std::shared_ptr< SingleDependentVariableSaveSettings > >& dependentVariables,
+        const std::vector< TIME_TYPE >& epochs,
+        const std::function< std::shared_ptr< SingleArcDynamicsSimulator< double, TIME_TYPE > >( const unsigned int ) >
+        workerSimulatorFactory,
+        const int numberOfThreads )
+{
+    std::vector< std::shared_ptr< SingleArcDynamicsSimulator< double, TIME_TYPE > > > workerSimulators;
+    if( workerSimulatorFactory != nullptr )
+    {
+        const std::size_t numberOfEpochs = ( epochs.size( ) > 0 ) ?
+                    epochs.size( ) : dynamicsSimulator->getEquationsOfMotionNumericalSolutionRaw( ).size( );
+        const unsigned int numberOfWorkers = tudatpy::getNumberOfWorkerThreads( numberOfThreads, numberOfEpochs );
+        for( unsigned int i = 1; i < numberOfWorkers; i++ )
+        {
+            workerSimulators.push_back( workerSimulatorFactory( i - 1 ) );
+        }
+    }
+
+    std::vector< TIME_TYPE > outputEpochs;
+    Eigen::Matrix< double, Eigen::Dynamic, Eigen::Dynamic, Eigen::RowMajor > dependentVariableValues;
+    {
+        py::gil_scoped_release release;
+        dependentVariableValues = tudatpy::computeDependentVariablesFromStateHistory< double, TIME_TYPE >(
+                    dynamicsSimulator, dependentVariables, epochs, outputEpochs, workerSimulators );
+    }
+
+    const std::size_t numberOfColumns = static_cast< std::size_t >( dependentVariableValues.cols( ) ) + 1;
+    double* data = new double[ outputEpochs.size( ) * numberOfColumns ];
+    for( std::size_t i = 0; i < outputEpochs.size( ); i++ )
+    {
+        data[ i * numberOfColumns ] = static_cast< double >( outputEpochs.at( i ) );
+        Eigen::Map< Eigen::Matrix< double, 1, Eigen::Dynamic > >( data + i * numberOfColumns + 1, numberOfColumns - 1 ) =
+                dependentVariableValues.row( i );
+    }
+    return tudatpy::wrapBufferInArray( data, outputEpochs.size( ), numberOfColumns );
+}
+
+}
+
+namespace simulation_setup
+{
+
+//! Function to compute the residuals and design matrix of an observation collection concurrently, one estimator per thread
+std::pair< Eigen::VectorXd, Eigen::MatrixXd > computeResidualsAndPartialsInParallel(
+        const std::vector< std::shared_ptr< OrbitDeterminationManager< double, TIME_TYPE > > >& orbitDeterminationManagers,
+        const std::shared_ptr< tom::ObservationCollection< double, TIME_TYPE > > observationCollection,
+        const Eigen::VectorXd& parameterEstimate )
+{
+    std::pair< Eigen::VectorXd, Eigen::MatrixXd > residualsAndPartials;
+    tudatpy::computeResidualsAndPartialsInParallel< double, TIME_TYPE >(
+                orbitDeterminationManagers, observationCollection, parameterEstimate,
+                residualsAndPartials.first, residualsAndPartials.second );
+    return residualsAndPartials;
+}
+
+}
+
+}
+
 namespace tudatpy {
 namespace numerical_simulation {
 
@@ -66,12 +560,205 @@ void expose_numerical_simulation(py::module &m) {
           py::arg("state_type") );
 
     m.def("create_dynamics_simulator",
-          &tss::createDynamicsSimulator<double,TIME_TYPE>,
+          &tudatpy::createDynamicsSimulator<double,TIME_TYPE>,
           py::arg("bodies"),
           py::arg("propagator_settings"),
           py::arg("simulate_dynamics_on_creation") = true,
           get_docstring("create_dynamics_simulator").c_str() );
 
+    py::class_<
+            tp::BatchPropagationResults,
+            std::shared_ptr<tp::BatchPropagationResults>>(
+                m, "BatchPropagationResults", get_docstring("BatchPropagationResults").c_str())
+            .def_readonly("propagation_results",
+                          &tp::BatchPropagationResults::propagationResults_,
+                          get_docstring("BatchPropagationResults.propagation_results").c_str())
+            .def_property_readonly("propagation_succeeded",
+                                   &tp::BatchPropagationResults::getPropagationSucceeded,
+                                   get_docstring("BatchPropagationResults.propagation_succeeded").c_str())
+            .def_readonly("failure_messages",
+                          &tp::BatchPropagationResults::failureMessages_,
+                          get_docstring("BatchPropagationResults.failure_messages").c_str())
+            .def_property_readonly("number_of_failed_propagations",
+                                   &tp::BatchPropagationResults::getNumberOfFailedPropagations,
+                                   get_docstring("BatchPropagationResults.number_of_failed_propagations").c_str());
+
+    m.def("propagate_batch",
+          &tp::propagateBatch,
+          py::arg("bodies_factory"),
+          py::arg("propagator_settings_list"),
+          py::arg("number_of_threads") = 0,
+          py::call_guard< py::gil_scoped_release >( ),
+          get_docstring("propagate_batch").c_str() );
+
+    m.def("compute_dependent_variables",
+          &tp::computeDependentVariablesFromStateHistory,
+          py::arg("dynamics_simulator"),
+          py::arg("dependent_variable_settings"),
+          py::arg("epochs") = std::vector< TIME_TYPE >( ),
+          py::arg("worker_simulator_factory") = nullptr,
+          py::arg("number_of_threads") = 0,
+          get_docstring("compute_dependent_variables").c_str() );
+
+    m.def("propagate_arcs_in_parallel",
+          &tp::propagateArcsInParallel,
+          py::arg("bodies_factory"),
+          py::arg("propagator_settings"),
+          py::arg("number_of_threads") = 0,
+          py::call_guard< py::gil_scoped_release >( ),
+          get_docstring("propagate_arcs_in_parallel").c_str() );
+
+    m.def("integrate_variational_arcs_in_parallel",
+          &tp::integrateVariationalArcsInParallel,
+          py::arg("bodies_factory"),
+          py::arg("propagator_settings"),
+          py::arg("parameters_factory"),
+          py::arg("number_of_threads") = 0,
+          py::call_guard< py::gil_scoped_release >( ),
+          get_docstring("integrate_variational_arcs_in_parallel").c_str() );
+
+    m.def("compute_residuals_and_partials_in_parallel",
+          &tss::computeResidualsAndPartialsInParallel,
+          py::arg("estimators"),
+          py::arg("observation_collection"),
+          py::arg("parameter_values") = Eigen::VectorXd::Zero( 0 ),
+          py::call_guard< py::gil_scoped_release >( ),
+          get_docstring("compute_residuals_and_partials_in_parallel").c_str() );
+
+    py::class_<
+            tudatpy::StreamingEstimationOutput,
+            std::shared_ptr<tudatpy::StreamingEstimationOutput>>(m, "StreamingEstimationOutput",
+                                                                 get_docstring("StreamingEstimationOutput").c_str())
+            .def_readonly("parameter_estimate",
+                          &tudatpy::StreamingEstimationOutput::parameterEstimate_,
+                          get_docstring("StreamingEstimationOutput.parameter_estimate").c_str())
+            .def_readonly("final_residuals",
+                          &tudatpy::StreamingEstimationOutput::residuals_,
+                          get_docstring("StreamingEstimationOutput.final_residuals").c_str())
+            .def_readonly("normalization_terms",
+                          &tudatpy::StreamingEstimationOutput::normalizationTerms_,
+                          get_docstring("StreamingEstimationOutput.normalization_terms").c_str())
+            .def_readonly("inverse_covariance",
+                          &tudatpy::StreamingEstimationOutput::inverseCovariance_,
+                          get_docstring("StreamingEstimationOutput.inverse_covariance").c_str())
+            .def_readonly("covariance",
+                          &tudatpy::StreamingEstimationOutput::covariance_,
+                          get_docstring("StreamingEstimationOutput.covariance").c_str())
+            .def_readonly("formal_errors",
+                          &tudatpy::StreamingEstimationOutput::formalErrors_,
+                          get_docstring("StreamingEstimationOutput.formal_errors").c_str())
+            .def_readonly("parameter_history",
+                          &tudatpy::StreamingEstimationOutput::parameterHistory_,
+                          get_docstring("StreamingEstimationOutput.parameter_history").c_str())
+            .def_readonly("rms_residual_history",
+                          &tudatpy::StreamingEstimationOutput::rmsResidualHistory_,
+                          get_docstring("StreamingEstimationOutput.rms_residual_history").c_str())
+            .def_readonly("best_iteration",
+                          &tudatpy::StreamingEstimationOutput::bestIteration_,
+                          get_docstring("StreamingEstimationOutput.best_iteration").c_str());
+
+    m.def("perform_streaming_estimation",
+          &tudatpy::performStreamingEstimation<double, TIME_TYPE>,
+          py::arg("estimators"),
+          py::arg("estimation_input"),
+          py::arg("minimum_block_size") = 0,
+          py::call_guard< py::gil_scoped_release >( ),
+          get_docstring("perform_streaming_estimation").c_str() );
+
+    m.def("perform_estimation_in_parallel",
+          &tudatpy::performEstimationInParallel<double, TIME_TYPE>,
+          py::arg("estimator_factory"),
+          py::arg("estimation_input"),
+          py::arg("number_of_threads") = 0,
+          py::arg("minimum_block_size") = 0,
+          py::call_guard< py::gil_scoped_release >( ),
+          get_docstring("perform_estimation_in_parallel").c_str() );
+
+    m.def("compute_streaming_covariance",
+          &tudatpy::computeStreamingCovariance<double, TIME_TYPE>,
+          py::arg("estimators"),
+          py::arg("covariance_analysis_input"),
+          py::arg("minimum_block_size") = 0,
+          py::call_guard< py::gil_scoped_release >( ),
+          get_docstring("compute_streaming_covariance").c_str() );
+
+    py::class_<
+            tudatpy::SquareRootInformationFilter<double, TIME_TYPE>,
+            std::shared_ptr<tudatpy::SquareRootInformationFilter<double, TIME_TYPE>>>(m, "SquareRootInformationFilter",
+                                                                                  get_docstring("SquareRootInformationFilter").c_str())
+            .def(py::init<
+                 const std::shared_ptr< tss::OrbitDeterminationManager<double, TIME_TYPE> >,
+                 const Eigen::MatrixXd& >( ),
+                 py::arg("estimator"),
+                 py::arg("inverse_apriori_covariance") = Eigen::MatrixXd::Zero( 0, 0 ),
+                 get_docstring("SquareRootInformationFilter.ctor").c_str() )
+            .def("add_observations",
+                 py::overload_cast< const std::shared_ptr< tom::ObservationCollection<double, TIME_TYPE> >, const Eigen::VectorXd& >(
+                     &tudatpy::SquareRootInformationFilter<double, TIME_TYPE>::addObservations ),
+                 py::arg("observation_collection"),
+                 py::arg("weights"),
+                 py::call_guard< py::gil_scoped_release >( ),
+                 get_docstring("SquareRootInformationFilter.add_observations", 0).c_str() )
+            .def("add_observations",
+                 py::overload_cast< const std::shared_ptr< tom::ObservationCollection<double, TIME_TYPE> >, const double >(
+                     &tudatpy::SquareRootInformationFilter<double, TIME_TYPE>::addObservations ),
+                 py::arg("observation_collection"),
+                 py::arg("weight") = 1.0,
+                 py::call_guard< py::gil_scoped_release >( ),
+                 get_docstring("SquareRootInformationFilter.add_observations", 1).c_str() )
+            .def("relinearize",
+                 &tudatpy::SquareRootInformationFilter<double, TIME_TYPE>::relinearize,
+                 py::call_guard< py::gil_scoped_release >( ),
+                 get_docstring("SquareRootInformationFilter.relinearize").c_str() )
+            .def("propagate_to_epoch",
+                 &tudatpy::SquareRootInformationFilter<double, TIME_TYPE>::propagateToEpoch,
+                 py::arg("epoch"),
+                 py::arg("process_noise_covariance") = Eigen::MatrixXd::Zero( 0, 0 ),
+                 py::call_guard< py::gil_scoped_release >( ),
+                 get_docstring("SquareRootInformationFilter.propagate_to_epoch").c_str() )
+            .def("set_process_noise_function",
+                 &tudatpy::SquareRootInformationFilter<double, TIME_TYPE>::setProcessNoiseFunction,
+                 py::arg("process_noise_function"),
+                 get_docstring("SquareRootInformationFilter.set_process_noise_function").c_str() )
+            .def("propagated_covariance",
+                 &tudatpy::SquareRootInformationFilter<double, TIME_TYPE>::getPropagatedCovariance,
+                 py::arg("output_times"),
+                 py::call_guard< py::gil_scoped_release >( ),
+                 get_docstring("SquareRootInformationFilter.propagated_covariance").c_str() )
+            .def_property_readonly("parameter_estimate",
+                                   &tudatpy::SquareRootInformationFilter<double, TIME_TYPE>::getParameterEstimate,
+                                   get_docstring("SquareRootInformationFilter.parameter_estimate").c_str())
+            .def_property_readonly("covariance",
+                                   &tudatpy::SquareRootInformationFilter<double, TIME_TYPE>::getCovariance,
+                                   get_docstring("SquareRootInformationFilter.covariance").c_str())
+            .def_property_readonly("current_epoch",
+                                   &tudatpy::SquareRootInformationFilter<double, TIME_TYPE>::getCurrentEpoch,
+                                   get_docstring("SquareRootInformationFilter.current_epoch").c_str())
+            .def_property_readonly("current_covariance",
+                                   &tudatpy::SquareRootInformationFilter<double, TIME_TYPE>::getCurrentCovariance,
+                                   get_docstring("SquareRootInformationFilter.current_covariance").c_str())
+            .def_property_readonly("formal_errors",
+                                   &tudatpy::SquareRootInformationFilter<double, TIME_TYPE>::getFormalErrors,
+                                   get_docstring("SquareRootInformationFilter.formal_errors").c_str())
+            .def_property_readonly("square_root_information_matrix",
+                                   &tudatpy::SquareRootInformationFilter<double, TIME_TYPE>::getSquareRootInformationMatrix,
+                                   get_docstring("SquareRootInformationFilter.square_root_information_matrix").c_str())
+            .def_property_readonly("information_vector",
+                                   &tudatpy::SquareRootInformationFilter<double, TIME_TYPE>::getInformationVector,
+                                   get_docstring("SquareRootInformationFilter.information_vector").c_str())
+            .def_property_readonly("reference_parameters",
+                                   &tudatpy::SquareRootInformationFilter<double, TIME_TYPE>::getReferenceParameters,
+                                   get_docstring("SquareRootInformationFilter.reference_parameters").c_str())
+            .def_property_readonly("residual_sum_of_squares",
+                                   &tudatpy::SquareRootInformationFilter<double, TIME_TYPE>::getResidualSumOfSquares,
+                                   get_docstring("SquareRootInformationFilter.residual_sum_of_squares").c_str())
+            .def_property_readonly("number_of_observations",
+                                   &tudatpy::SquareRootInformationFilter<double, TIME_TYPE>::getNumberOfObservations,
+                                   get_docstring("SquareRootInformationFilter.number_of_observations").c_str())
+            .def_property_readonly("number_of_batches",
+                                   &tudatpy::SquareRootInformationFilter<double, TIME_TYPE>::getNumberOfBatches,
+                                   get_docstring("SquareRootInformationFilter.number_of_batches").c_str());
+
     py::class_<
             tudat::Time >(
                 m,"Time", get_docstring("Time").c_str())
@@ -190,7 +877,185 @@ void expose_numerical_simulation(py::module &m) {
             .def_property_readonly("propagation_termination_details",
                                    &tp::SingleArcDynamicsSimulator<double, TIME_TYPE>::getPropagationTerminationReason)
             .def_property_readonly("integration_completed_successfully",
-                                   &tp::SingleArcDynamicsSimulator<double, TIME_TYPE>::integrationCompletedSuccessfully);
+                                   &tp::SingleArcDynamicsSimulator<double, TIME_TYPE>::integrationCompletedSuccessfully)
+            .def("reset_initial_state_and_propagate",
+                 &tp::resetInitialStateAndPropagate,
+                 py::arg("initial_state"),
+                 py::call_guard<py::gil_scoped_release>(),
+                 get_docstring("SingleArcSimulator.reset_initial_state_and_propagate").c_str())
+            .def("reset_initial_states_and_propagate",
+                 &tp::resetInitialStatesAndPropagate,
+                 py::arg("initial_states"),
+                 py::call_guard<py::gil_scoped_release>(),
+                 get_docstring("SingleArcSimulator.reset_initial_states_and_propagate").c_str());
+
+    py::class_<tudatpy::ContinuousSolution<TIME_TYPE, double>,
+            std::shared_ptr<tudatpy::ContinuousSolution<TIME_TYPE, double>>>(m, "ContinuousSolution",
+                                                                           get_docstring("ContinuousSolution").c_str())
+            .def("__call__",
+                 &tudatpy::ContinuousSolution<TIME_TYPE, double>::getState,
+                 py::arg("epoch"),
+                 get_docstring("ContinuousSolution.__call__").c_str())
+            .def("state",
+                 &tudatpy::ContinuousSolution<TIME_TYPE, double>::getState,
+                 py::arg("epoch"),
+                 get_docstring("ContinuousSolution.state").c_str())
+            .def("propagated_state",
+                 &tudatpy::ContinuousSolution<TIME_TYPE, double>::getPropagatedState,
+                 py::arg("epoch"),
+                 get_docstring("ContinuousSolution.propagated_state").c_str())
+            .def("states",
+                 &tudatpy::ContinuousSolution<TIME_TYPE, double>::getStates,
+                 py::arg("epochs"),
+                 get_docstring("ContinuousSolution.states").c_str())
+            .def_property_readonly("start_epoch",
+                                   &tudatpy::ContinuousSolution<TIME_TYPE, double>::getStartTime,
+                                   get_docstring("ContinuousSolution.start_epoch").c_str())
+            .def_property_readonly("end_epoch",
+                                   &tudatpy::ContinuousSolution<TIME_TYPE, double>::getEndTime,
+                                   get_docstring("ContinuousSolution.end_epoch").c_str())
+            .def_property_readonly("number_of_nodes",
+                                   &tudatpy::ContinuousSolution<TIME_TYPE, double>::getNumberOfNodes,
+                                   get_docstring("ContinuousSolution.number_of_nodes").c_str());
+
+    py::class_<tudatpy::ProfiledQuantity>(m, "ProfiledQuantity", get_docstring("ProfiledQuantity").c_str())
+            .def_readonly("name", &tudatpy::ProfiledQuantity::name_,
+                          get_docstring("ProfiledQuantity.name").c_str())
+            .def_readonly("category", &tudatpy::ProfiledQuantity::category_,
+                          get_docstring("ProfiledQuantity.category").c_str())
+            .def_readonly("number_of_calls", &tudatpy::ProfiledQuantity::numberOfCalls_,
+                          get_docstring("ProfiledQuantity.number_of_calls").c_str())
+            .def_readonly("total_time", &tudatpy::ProfiledQuantity::totalTime_,
+                          get_docstring("ProfiledQuantity.total_time").c_str())
+            .def_property_readonly("mean_time", &tudatpy::ProfiledQuantity::getMeanTime,
+                                   get_docstring("ProfiledQuantity.mean_time").c_str());
+
+    py::class_<tudatpy::PropagationProfiler,
+            std::shared_ptr<tudatpy::PropagationProfiler>>(m, "PropagationProfiler",
+                                                           get_docstring("PropagationProfiler").c_str())
+            .def_property_readonly("profiled_quantities",
+                                   &tudatpy::PropagationProfiler::getProfiledQuantities,
+                                   get_docstring("PropagationProfiler.profiled_quantities").c_str())
+            .def_property_readonly("number_of_dropped_trace_events",
+                                   &tudatpy::PropagationProfiler::getNumberOfDroppedTraceEvents,
+                                   get_docstring("PropagationProfiler.number_of_dropped_trace_events").c_str())
+            .def("report",
+                 &tudatpy::PropagationProfiler::getReport,
+                 get_docstring("PropagationProfiler.report").c_str())
+            .def("write_chrome_trace",
+                 &tudatpy::PropagationProfiler::writeChromeTrace,
+                 py::arg("file_name"),
+                 get_docstring("PropagationProfiler.write_chrome_trace").c_str());
+
+    py::class_<tudatpy::DetectedEvent,
+            std::shared_ptr<tudatpy::DetectedEvent>>(m, "DetectedEvent",
+                                                     get_docstring("DetectedEvent").c_str())
+            .def_property_readonly("event_name",
+                                   &tudatpy::DetectedEvent::getEventName,
+                                   get_docstring("DetectedEvent.event_name").c_str())
+            .def_property_readonly("epoch",
+                                   &tudatpy::DetectedEvent::getEpoch,
+                                   get_docstring("DetectedEvent.epoch").c_str())
+            .def_property_readonly("is_increasing",
+                                   &tudatpy::DetectedEvent::getIsIncreasing,
+                                   get_docstring("DetectedEvent.is_increasing").c_str())
+            .def_property_readonly("state",
+                                   &tudatpy::DetectedEvent::getState,
+                                   get_docstring("DetectedEvent.state").c_str());
+
+    py::class_<
+            tudatpy::SingleArcStepwiseDynamicsSimulator<double, TIME_TYPE>,
+            std::shared_ptr<tudatpy::SingleArcStepwiseDynamicsSimulator<double, TIME_TYPE>>,
+            tp::SingleArcDynamicsSimulator<double, TIME_TYPE>>(
+                m,"SingleArcStepwiseSimulator", get_docstring("SingleArcStepwiseSimulator").c_str())
+            .def(py::init<
+                 const tudat::simulation_setup::SystemOfBodies &,
+                 const std::shared_ptr<tp::SingleArcPropagatorSettings<double, TIME_TYPE>>,
+                 const bool>(),
+                 py::arg("bodies"),
+                 py::arg("propagator_settings"),
+                 py::arg("simulate_dynamics_on_creation") = false,
+                 get_docstring("SingleArcStepwiseSimulator.ctor").c_str())
+            .def("initialize_propagation",
+                 py::overload_cast<>(
+                     &tudatpy::SingleArcStepwiseDynamicsSimulator<double, TIME_TYPE>::initializeStepwisePropagation),
+                 get_docstring("SingleArcStepwiseSimulator.initialize_propagation").c_str())
+            .def("initialize_propagation",
+                 py::overload_cast<const Eigen::Matrix<double, Eigen::Dynamic, Eigen::Dynamic>&>(
+                     &tudatpy::SingleArcStepwiseDynamicsSimulator<double, TIME_TYPE>::initializeStepwisePropagation),
+                 py::arg("initial_states"),
+                 get_docstring("SingleArcStepwiseSimulator.initialize_propagation").c_str())
+            .def("step",
+                 &tudatpy::SingleArcStepwiseDynamicsSimulator<double, TIME_TYPE>::performSteps,
+                 py::arg("number_of_steps") = 1,
+                 py::call_guard<py::gil_scoped_release>(),
+                 get_docstring("SingleArcStepwiseSimulator.step").c_str())
+            .def("stop_propagation",
+                 &tudatpy::SingleArcStepwiseDynamicsSimulator<double, TIME_TYPE>::stopPropagation,
+                 get_docstring("SingleArcStepwiseSimulator.stop_propagation").c_str())
+            .def("modify_current_state",
+                 &tudatpy::SingleArcStepwiseDynamicsSimulator<double, TIME_TYPE>::modifyCurrentState,
+                 py::arg("new_state"),
+                 get_docstring("SingleArcStepwiseSimulator.modify_current_state").c_str())
+            .def("checkpoint",
+                 &tudatpy::SingleArcStepwiseDynamicsSimulator<double, TIME_TYPE>::writeCheckpoint,
+                 py::arg("file_name"),
+                 get_docstring("SingleArcStepwiseSimulator.checkpoint").c_str())
+            .def("resume",
+                 &tudatpy::SingleArcStepwiseDynamicsSimulator<double, TIME_TYPE>::resumeFromCheckpoint,
+                 py::arg("file_name"),
+                 get_docstring("SingleArcStepwiseSimulator.resume").c_str())
+            .def_property_readonly("current_time",
+                                   &tudatpy::SingleArcStepwiseDynamicsSimulator<double, TIME_TYPE>::getCurrentTime,
+                                   get_docstring("SingleArcStepwiseSimulator.current_time").c_str())
+            .def_property_readonly("current_state",
+                                   &tudatpy::SingleArcStepwiseDynamicsSimulator<double, TIME_TYPE>::getCurrentState,
+                                   get_docstring("SingleArcStepwiseSimulator.current_state").c_str())
+            .def_property_readonly("current_propagated_state",
+                                   &tudatpy::SingleArcStepwiseDynamicsSimulator<double, TIME_TYPE>::getCurrentPropagatedState,
+                                   get_docstring("SingleArcStepwiseSimulator.current_propagated_state").c_str())
+            .def_property_readonly("current_time_step",
+                                   &tudatpy::SingleArcStepwiseDynamicsSimulator<double, TIME_TYPE>::getCurrentTimeStep,
+                                   get_docstring("SingleArcStepwiseSimulator.current_time_step").c_str())
+            .def_property_readonly("is_initialized",
+                                   &tudatpy::SingleArcStepwiseDynamicsSimulator<double, TIME_TYPE>::isPropagationInitialized,
+                                   get_docstring("SingleArcStepwiseSimulator.is_initialized").c_str())
+            .def_property_readonly("is_terminated",
+                                   &tudatpy::SingleArcStepwiseDynamicsSimulator<double, TIME_TYPE>::isPropagationTerminated,
+                                   get_docstring("SingleArcStepwiseSimulator.is_terminated").c_str())
+            .def_property_readonly("bodies",
+                                   &tudatpy::SingleArcStepwiseDynamicsSimulator<double, TIME_TYPE>::getSystemOfBodies,
+                                   get_docstring("SingleArcStepwiseSimulator.bodies").c_str())
+            .def_property_readonly("streamed_results",
+                                   &tudatpy::SingleArcStepwiseDynamicsSimulator<double, TIME_TYPE>::getStreamedResults,
+                                   get_docstring("SingleArcStepwiseSimulator.streamed_results").c_str())
+            .def_property_readonly("propagation_termination_details",
+                                   &tudatpy::SingleArcStepwiseDynamicsSimulator<double, TIME_TYPE>::getTerminationDetails,
+                                   get_docstring("SingleArcStepwiseSimulator.propagation_termination_details").c_str())
+            .def_property_readonly("integration_completed_successfully",
+                                   &tudatpy::SingleArcStepwiseDynamicsSimulator<double, TIME_TYPE>::integrationCompletedSuccessfully,
+                                   get_docstring("SingleArcStepwiseSimulator.integration_completed_successfully").c_str())
+            .def_property_readonly("total_computation_time",
+                                   &tudatpy::SingleArcStepwiseDynamicsSimulator<double, TIME_TYPE>::getTotalComputationTime,
+                                   get_docstring("SingleArcStepwiseSimulator.total_computation_time").c_str())
+            .def_property_readonly("total_number_of_function_evaluations",
+                                   &tudatpy::SingleArcStepwiseDynamicsSimulator<double, TIME_TYPE>::getTotalNumberOfFunctionEvaluations,
+                                   get_docstring("SingleArcStepwiseSimulator.total_number_of_function_evaluations").c_str())
+            .def_property_readonly("continuous_solution",
+                                   &tudatpy::SingleArcStepwiseDynamicsSimulator<double, TIME_TYPE>::getContinuousSolution,
+                                   get_docstring("SingleArcStepwiseSimulator.continuous_solution").c_str())
+            .def_property_readonly("profiler",
+                                   &tudatpy::SingleArcStepwiseDynamicsSimulator<double, TIME_TYPE>::getProfiler,
+                                   get_docstring("SingleArcStepwiseSimulator.profiler").c_str())
+            .def_property_readonly("detected_events",
+                                   &tudatpy::SingleArcStepwiseDynamicsSimulator<double, TIME_TYPE>::getDetectedEvents,
+                                   get_docstring("SingleArcStepwiseSimulator.detected_events").c_str())
+            .def_property_readonly("event_epochs",
+                                   &tudatpy::SingleArcStepwiseDynamicsSimulator<double, TIME_TYPE>::getDetectedEventEpochs,
+                                   get_docstring("SingleArcStepwiseSimulator.event_epochs").c_str())
+            .def_property_readonly("is_integrated_state_size_fixed",
+                                   &tudatpy::SingleArcStepwiseDynamicsSimulator<double, TIME_TYPE>::isIntegratedStateSizeFixed,
+                                   get_docstring("SingleArcStepwiseSimulator.is_integrated_state_size_fixed").c_str());
     //          .def_property_readonly("dependent_variable_ids",
     //                                 &tp::SingleArcDynamicsSimulator<double, TIME_TYPE>::getDependentVariableIds,
     //                                 get_docstring("SingleArcSimulator.dependent_variable_ids").c_str());
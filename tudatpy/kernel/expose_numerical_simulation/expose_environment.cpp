@@ -14,6 +14,7 @@
 #include "expose_environment.h"
 #include <tudat/basics/deprecationWarnings.h>
 
+#include "tudatpy/bodyCloning.h"
 #include "tudatpy/docstrings.h"
 
 #include <tudat/astro/aerodynamics.h>
@@ -671,7 +672,10 @@ void expose_environment(py::module &m) {
                  get_docstring("SystemOfBodies.add_body").c_str())
             .def("remove_body", &tss::SystemOfBodies::deleteBody,
                  py::arg("body_name"),
-                 get_docstring("SystemOfBodies.remove_body").c_str());
+                 get_docstring("SystemOfBodies.remove_body").c_str())
+            .def("clone", &tudatpy::cloneSystemOfBodies,
+                 py::arg("skip_models_not_cloned") = false,
+                 get_docstring("SystemOfBodies.clone").c_str());
 //            .def_property_readonly("number_of_bodies", &tss::SystemOfBodies::getNumberOfBodies,
 //                                   get_docstring("number_of_bodies").c_str() );
 
@@ -11,6 +11,7 @@
 #include "expose_rotation_model_setup.h"
 
 #include "tudatpy/docstrings.h"
+#include "tudatpy/tabulatedAerodynamicGuidance.h"
 #include <tudat/simulation/environment_setup.h>
 #include <tudat/astro/reference_frames/referenceFrameTransformations.h>
 
@@ -141,6 +142,15 @@ namespace rotation_model {
               get_docstring("aerodynamic_angle_based").c_str()
         );
 
+        m.def("aerodynamic_angle_based",
+              &tudatpy::aerodynamicGuidanceRotationSettings,
+              py::arg("central_body"),
+              py::arg("base_frame"),
+              py::arg("target_frame"),
+              py::arg("aerodynamic_guidance"),
+              get_docstring("aerodynamic_angle_based", 1).c_str()
+        );
+
         m.def("zero_pitch_moment_aerodynamic_angle_based",
               &tss::pitchTrimRotationSettings,
               py::arg("central_body"),
@@ -13,7 +13,9 @@
 #include "tudat/astro/propagators/propagateCovariance.h"
 #include "tudat/basics/utilities.h"
 
+#include "tudatpy/arrayConversion.h"
 #include "tudatpy/docstrings.h"
+#include "tudatpy/rswCovariancePropagation.h"
 #include "tudatpy/scalarTypes.h"
 
 #include <pybind11/pybind11.h>
@@ -44,62 +46,11 @@ std::map< double, Eigen::MatrixXd > propagateCovarianceRsw(
         const std::shared_ptr< tss::OrbitDeterminationManager<double, TIME_TYPE> > orbitDeterminationManager,
         const std::vector< double > evaluationTimes )
 {
-    std::map< double, Eigen::MatrixXd > propagatedCovariance;
-    tp::propagateCovariance(
-                propagatedCovariance, estimationOutput->getUnnormalizedCovarianceMatrix( ),
-                orbitDeterminationManager->getStateTransitionAndSensitivityMatrixInterface( ), evaluationTimes );
-
-    tss::SystemOfBodies bodies = orbitDeterminationManager->getBodies( );
-
-    std::shared_ptr< tep::EstimatableParameterSet<double> > parameterSet = orbitDeterminationManager->getParametersToEstimate( );
-
-    std::map< int, std::shared_ptr< tep::EstimatableParameter< Eigen::VectorXd > > > initialStates = parameterSet->getInitialStateParameters( );
-    std::map< std::pair< std::string, std::string >, std::vector< int > > transformationList;
-    for( auto it : initialStates )
-    {
-        if( std::dynamic_pointer_cast< tep::InitialTranslationalStateParameter< double > >( it.second ) )
-        {
-            std::shared_ptr< tep::InitialTranslationalStateParameter< double > > currentInitialState =
-                    std::dynamic_pointer_cast< tep::InitialTranslationalStateParameter< double > >( it.second );
-            transformationList[ std::make_pair( currentInitialState->getParameterName( ).second.first, currentInitialState->getCentralBody( ) ) ].push_back(
-                        it.first );
-
-        }
-        else if( std::dynamic_pointer_cast< tep::ArcWiseInitialTranslationalStateParameter< double > >( it.second ) )
-        {
-            throw std::runtime_error( "Error, multi-arc not yet supported in automatic covariance conversion" );
-        }
-    }
-
-    Eigen::Matrix3d currentInertialToRswPosition;
-    Eigen::Matrix6d currentInertialToRswState;
-    Eigen::MatrixXd currentFullInertialToRswState = Eigen::MatrixXd::Zero( 6, 6 );
-
-    std::map< double, Eigen::MatrixXd > propagatedRswCovariance;
-    for( auto it : propagatedCovariance )
-    {
-        double currentTime = it.first;
-        Eigen::MatrixXd currentCovariance = it.second;
-        currentFullInertialToRswState.setZero( );
-
-        for( auto it_body : transformationList )
-        {
-            Eigen::Vector6d relativeState =
-                    bodies.getBody( it_body.first.first )->getStateInBaseFrameFromEphemeris( currentTime ) -
-                    bodies.getBody( it_body.first.second )->getStateInBaseFrameFromEphemeris( currentTime );
-            currentInertialToRswPosition = trf::getInertialToRswSatelliteCenteredFrameRotationMatrix( relativeState );
-            currentInertialToRswState.block( 0, 0, 3, 3 ) = currentInertialToRswPosition;
-            currentInertialToRswState.block( 3, 3, 3, 3 ) = currentInertialToRswPosition;
-            for( unsigned int j = 0; j < it_body.second.size( ); j++ )
-            {
-                int currentStartIndex = it_body.second.at( j );
-                currentFullInertialToRswState.block( currentStartIndex, currentStartIndex, 6, 6 ) =  currentInertialToRswState;
-            }
-        }
-        propagatedRswCovariance[ currentTime ] = currentFullInertialToRswState * currentCovariance * currentFullInertialToRswState.transpose( );
-
-    }
-    return propagatedRswCovariance;
+    return tudatpy::propagateCovarianceRsw(
+                estimationOutput->getUnnormalizedCovarianceMatrix( ),
+                orbitDeterminationManager->getStateTransitionAndSensitivityMatrixInterface( ),
+                orbitDeterminationManager->getBodies( ), orbitDeterminationManager->getParametersToEstimate( ),
+                evaluationTimes );
 }
 
 
@@ -122,14 +73,11 @@ std::map< double, Eigen::VectorXd > propagateFormalErrorsRsw(
         const std::shared_ptr< tss::OrbitDeterminationManager<double, TIME_TYPE> > orbitDeterminationManager,
         const std::vector< double > evaluationTimes )
 {
-    std::map< double, Eigen::MatrixXd > propagatedCovariance;
-    std::map< double, Eigen::VectorXd > propagatedFormalErrors;
-
-    propagatedCovariance = propagateCovarianceRsw(
-                estimationOutput, orbitDeterminationManager, evaluationTimes );
-    tp::convertCovarianceHistoryToFormalErrorHistory( propagatedFormalErrors, propagatedCovariance );
-
-    return propagatedFormalErrors;
+    return tudatpy::propagateFormalErrorsRsw(
+                estimationOutput->getUnnormalizedCovarianceMatrix( ),
+                orbitDeterminationManager->getStateTransitionAndSensitivityMatrixInterface( ),
+                orbitDeterminationManager->getBodies( ), orbitDeterminationManager->getParametersToEstimate( ),
+                evaluationTimes );
 }
 
 std::pair< std::vector< double >, std::vector< Eigen::VectorXd > > propagateFormalErrorVectorsRsw(
@@ -139,7 +87,6 @@ std::pair< std::vector< double >, std::vector< Eigen::VectorXd > > propagateForm
 {
     std::map< double, Eigen::VectorXd > propagatedFormalErrors =
             propagateFormalErrorsRsw( estimationOutput, orbitDeterminationManager, evaluationTimes );
-    tp::propagateFormalErrorsRsw( estimationOutput, orbitDeterminationManager, evaluationTimes );
     return std::make_pair( utilities::createVectorFromMapKeys(
                                propagatedFormalErrors ),
                            utilities::createVectorFromMapValues(
@@ -148,6 +95,44 @@ std::pair< std::vector< double >, std::vector< Eigen::VectorXd > > propagateForm
 
 
 
+std::pair< py::array_t< double >, py::array_t< double > > propagateCovarianceStackRsw(
+        const std::shared_ptr< tss::CovarianceAnalysisOutput<double, TIME_TYPE> > estimationOutput,
+        const std::shared_ptr< tss::OrbitDeterminationManager<double, TIME_TYPE> > orbitDeterminationManager,
+        const std::vector< double > evaluationTimes,
+        const int numberOfThreads )
+{
+    std::vector< Eigen::MatrixXd > propagatedRswCovariance;
+    {
+        py::gil_scoped_release release;
+        propagatedRswCovariance = tudatpy::propagateCovarianceRswAtEpochs(
+                    estimationOutput->getUnnormalizedCovarianceMatrix( ),
+                    orbitDeterminationManager->getStateTransitionAndSensitivityMatrixInterface( ),
+                    orbitDeterminationManager->getBodies( ), orbitDeterminationManager->getParametersToEstimate( ),
+                    evaluationTimes, numberOfThreads );
+    }
+    return std::make_pair( py::array_t< double >( evaluationTimes.size( ), evaluationTimes.data( ) ),
+                           tudatpy::stackMatricesInArray( propagatedRswCovariance ) );
+}
+
+std::pair< py::array_t< double >, py::array_t< double > > propagateFormalErrorStackRsw(
+        const std::shared_ptr< tss::CovarianceAnalysisOutput<double, TIME_TYPE> > estimationOutput,
+        const std::shared_ptr< tss::OrbitDeterminationManager<double, TIME_TYPE> > orbitDeterminationManager,
+        const std::vector< double > evaluationTimes,
+        const int numberOfThreads )
+{
+    std::vector< Eigen::VectorXd > propagatedRswFormalErrors;
+    {
+        py::gil_scoped_release release;
+        propagatedRswFormalErrors = tudatpy::propagateFormalErrorsRswAtEpochs(
+                    estimationOutput->getUnnormalizedCovarianceMatrix( ),
+                    orbitDeterminationManager->getStateTransitionAndSensitivityMatrixInterface( ),
+                    orbitDeterminationManager->getBodies( ), orbitDeterminationManager->getParametersToEstimate( ),
+                    evaluationTimes, numberOfThreads );
+    }
+    return std::make_pair( py::array_t< double >( evaluationTimes.size( ), evaluationTimes.data( ) ),
+                           tudatpy::stackVectorsInArray( propagatedRswFormalErrors ) );
+}
+
 std::pair< std::vector< double >, std::vector< Eigen::MatrixXd > > propagateCovarianceVectors(
         const Eigen::MatrixXd initialCovariance,
         const std::shared_ptr< tp::CombinedStateTransitionAndSensitivityMatrixInterface > stateTransitionInterface,
@@ -406,6 +391,22 @@ void expose_estimation(py::module &m) {
           py::arg("output_times"),
           get_docstring("propagate_formal_errors_rsw_split_output").c_str( ) );
 
+    m.def("propagate_covariance_rsw_stacked_output",
+          &tp::propagateCovarianceStackRsw,
+          py::arg("covariance_output"),
+          py::arg("estimator"),
+          py::arg("output_times"),
+          py::arg("number_of_threads") = 0,
+          get_docstring("propagate_covariance_rsw_stacked_output").c_str( ) );
+
+    m.def("propagate_formal_errors_rsw_stacked_output",
+          &tp::propagateFormalErrorStackRsw,
+          py::arg("covariance_output"),
+          py::arg("estimator"),
+          py::arg("output_times"),
+          py::arg("number_of_threads") = 0,
+          get_docstring("propagate_formal_errors_rsw_stacked_output").c_str( ) );
+
     m.def("propagate_covariance_split_output",
           py::overload_cast<
           const Eigen::MatrixXd,
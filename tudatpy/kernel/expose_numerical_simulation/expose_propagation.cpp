@@ -8,8 +8,11 @@
  *    http://tudat.tudelft.nl/LICENSE.
  */
 
+#include "tudatpy/arrayConversion.h"
+#include "tudatpy/batchedInitialStates.h"
 #include "tudatpy/docstrings.h"
 #include "tudatpy/scalarTypes.h"
+#include "tudatpy/tabulatedAerodynamicGuidance.h"
 
 #include <tudat/astro/aerodynamics/aerodynamicGuidance.h>
 #include <tudat/astro/basic_astro.h>
@@ -56,6 +59,87 @@ namespace tudatpy {
 namespace numerical_simulation {
 namespace propagation {
 
+py::array_t< double > getStateArray( tp::SingleArcSimulationResults< double, TIME_TYPE >& results )
+{
+    return tudatpy::convertTimeHistoryToArray( results.getEquationsOfMotionNumericalSolution( ) );
+}
+
+py::array_t< double > getUnprocessedStateArray( tp::SingleArcSimulationResults< double, TIME_TYPE >& results )
+{
+    return tudatpy::convertTimeHistoryToArray( results.getEquationsOfMotionNumericalSolutionRaw( ) );
+}
+
+py::array_t< double > getDependentVariableArray( tp::SingleArcSimulationResults< double, TIME_TYPE >& results )
+{
+    return tudatpy::convertTimeHistoryToArray( results.getDependentVariableHistory( ) );
+}
+
+py::array_t< double > getEpochs( tp::SingleArcSimulationResults< double, TIME_TYPE >& results )
+{
+    return tudatpy::getTimeHistoryEpochs( results.getEquationsOfMotionNumericalSolution( ) );
+}
+
+py::array_t< double > getStreamedStateArray( tudatpy::ChunkedResultReader& resultReader )
+{
+    return tudatpy::readStreamedResultsToArray( resultReader, 0, resultReader.getNumberOfRows( ), false );
+}
+
+py::array_t< double > getStreamedDependentVariableArray( tudatpy::ChunkedResultReader& resultReader )
+{
+    return tudatpy::readStreamedResultsToArray( resultReader, 0, resultReader.getNumberOfRows( ), true );
+}
+
+py::array_t< double > readStreamedStateArray( tudatpy::ChunkedResultReader& resultReader,
+                                              const std::size_t startIndex,
+                                              const std::size_t endIndex )
+{
+    return tudatpy::readStreamedResultsToArray( resultReader, startIndex, endIndex, false );
+}
+
+py::array_t< double > readStreamedDependentVariableArray( tudatpy::ChunkedResultReader& resultReader,
+                                                          const std::size_t startIndex,
+                                                          const std::size_t endIndex )
+{
+    return tudatpy::readStreamedResultsToArray( resultReader, startIndex, endIndex, true );
+}
+
+py::array_t< double > getInitialStatesOfBodiesAtEpochs(
+        const std::vector< std::string >& bodiesToPropagate,
+        const std::vector< std::string >& centralBodies,
+        const tss::SystemOfBodies& bodies,
+        const py::array_t< double, py::array::c_style | py::array::forcecast >& epochs )
+{
+    if( epochs.ndim( ) != 1 )
+    {
+        throw std::runtime_error( "Error when computing initial states at epochs, epochs must be a one-dimensional array" );
+    }
+
+    const std::size_t numberOfEpochs = static_cast< std::size_t >( epochs.shape( 0 ) );
+    const std::size_t numberOfColumns = 6 * bodiesToPropagate.size( );
+    double* data = new double[ numberOfEpochs * numberOfColumns ];
+    try
+    {
+        py::gil_scoped_release release;
+        tudatpy::getInitialStatesOfBodiesAtEpochs< TIME_TYPE, double >(
+                    bodiesToPropagate, centralBodies, bodies, epochs.data( ), numberOfEpochs, data );
+    }
+    catch( ... )
+    {
+        delete[] data;
+        throw;
+    }
+    return tudatpy::wrapBufferInArray( data, numberOfEpochs, numberOfColumns );
+}
+
+py::array_t< double > getInitialStateOfBodyAtEpochs(
+        const std::string& bodyToPropagate,
+        const std::string& centralBody,
+        const tss::SystemOfBodies& bodies,
+        const py::array_t< double, py::array::c_style | py::array::forcecast >& epochs )
+{
+    return getInitialStatesOfBodiesAtEpochs( { bodyToPropagate }, { centralBody }, bodies, epochs );
+}
+
 
 void expose_propagation(py::module &m)
 {
@@ -70,6 +154,43 @@ void expose_propagation(py::module &m)
             .def_readwrite("bank_angle", &ta::PyAerodynamicGuidance::currentBankAngle_)
             .def_readwrite("sideslip_angle", &ta::PyAerodynamicGuidance::currentAngleOfSideslip_);
 
+    py::enum_<tudatpy::AerodynamicGuidanceIndependentVariables>(m, "AerodynamicGuidanceIndependentVariables",
+                                                                get_docstring("AerodynamicGuidanceIndependentVariables").c_str())
+            .value("time_guidance_variable", tudatpy::time_guidance_variable,
+                   get_docstring("AerodynamicGuidanceIndependentVariables.time_guidance_variable").c_str())
+            .value("altitude_guidance_variable", tudatpy::altitude_guidance_variable,
+                   get_docstring("AerodynamicGuidanceIndependentVariables.altitude_guidance_variable").c_str())
+            .value("airspeed_guidance_variable", tudatpy::airspeed_guidance_variable,
+                   get_docstring("AerodynamicGuidanceIndependentVariables.airspeed_guidance_variable").c_str())
+            .value("mach_number_guidance_variable", tudatpy::mach_number_guidance_variable,
+                   get_docstring("AerodynamicGuidanceIndependentVariables.mach_number_guidance_variable").c_str())
+            .value("specific_energy_guidance_variable", tudatpy::specific_energy_guidance_variable,
+                   get_docstring("AerodynamicGuidanceIndependentVariables.specific_energy_guidance_variable").c_str())
+            .export_values();
+
+    py::class_<tudatpy::TabulatedAerodynamicGuidance,
+            std::shared_ptr< tudatpy::TabulatedAerodynamicGuidance >,
+            ta::AerodynamicGuidance >(m, "TabulatedAerodynamicGuidance",
+                                      get_docstring("TabulatedAerodynamicGuidance").c_str())
+            .def("aerodynamic_angles", &tudatpy::TabulatedAerodynamicGuidance::getAerodynamicAngles,
+                 py::arg("current_time"),
+                 get_docstring("TabulatedAerodynamicGuidance.aerodynamic_angles").c_str() )
+            .def_property_readonly("independent_variable", &tudatpy::TabulatedAerodynamicGuidance::getIndependentVariable,
+                                   get_docstring("TabulatedAerodynamicGuidance.independent_variable").c_str())
+            .def_property_readonly("bank_reversal_values", &tudatpy::TabulatedAerodynamicGuidance::getBankReversalValues,
+                                   get_docstring("TabulatedAerodynamicGuidance.bank_reversal_values").c_str());
+
+    m.def("tabulated_aerodynamic_guidance",
+          &tudatpy::createTabulatedAerodynamicGuidance,
+          py::arg("bodies"),
+          py::arg("body_name"),
+          py::arg("central_body_name"),
+          py::arg("independent_variable"),
+          py::arg("guidance_table"),
+          py::arg("bank_reversal_values") = std::vector< double >( ),
+          py::arg("interpolator_settings") = nullptr,
+          get_docstring("tabulated_aerodynamic_guidance").c_str() );
+
 
 
     py::class_<
@@ -114,6 +235,13 @@ void expose_propagation(py::module &m)
           py::arg("body_system"),
           py::arg("initial_time"));
 
+    m.def("get_initial_state_of_bodies",
+          &getInitialStatesOfBodiesAtEpochs,
+          py::arg("bodies_to_propagate"),
+          py::arg("central_bodies"),
+          py::arg("body_system"),
+          py::arg("initial_times"));
+
     m.def("get_initial_state_of_body",// overload [2/2]
           py::overload_cast<const std::string&,
           const std::string&,
@@ -125,6 +253,13 @@ void expose_propagation(py::module &m)
           py::arg("bodies"),
           py::arg("initial_time"));
 
+    m.def("get_initial_state_of_body",
+          &getInitialStateOfBodyAtEpochs,
+          py::arg("body_to_propagate"),
+          py::arg("central_body"),
+          py::arg("bodies"),
+          py::arg("initial_times"));
+
     m.def("get_initial_rotational_state_of_body",
           py::overload_cast<const std::string&,
           const std::string&,
@@ -239,9 +374,18 @@ void expose_propagation(py::module &m)
             .def_property_readonly("dependent_variable_history",
                                    &tp::SingleArcSimulationResults<double, TIME_TYPE>::getDependentVariableHistory,
                                    get_docstring("SingleArcSimulationResults.dependent_variable_history").c_str() )
-            .def_property_readonly("cumulative_computation_time_history",
-                                   &tp::SingleArcSimulationResults<double, TIME_TYPE>::getCumulativeComputationTimeHistory,
-                                   get_docstring("SingleArcSimulationResults.cumulative_computation_time_history").c_str() )
+            .def_property_readonly("state_array",
+                                   &getStateArray,
+                                   get_docstring("SingleArcSimulationResults.state_array").c_str() )
+            .def_property_readonly("unprocessed_state_array",
+                                   &getUnprocessedStateArray,
+                                   get_docstring("SingleArcSimulationResults.unprocessed_state_array").c_str() )
+            .def_property_readonly("dependent_variable_array",
+                                   &getDependentVariableArray,
+                                   get_docstring("SingleArcSimulationResults.dependent_variable_array").c_str() )
+            .def_property_readonly("epochs",
+                                   &getEpochs,
+                                   get_docstring("SingleArcSimulationResults.epochs").c_str() )
             .def_property_readonly("cumulative_computation_time_history",
                                    &tp::SingleArcSimulationResults<double, TIME_TYPE>::getCumulativeComputationTimeHistory,
                                    get_docstring("SingleArcSimulationResults.cumulative_computation_time_history").c_str() )
@@ -282,6 +426,45 @@ void expose_propagation(py::module &m)
                                    &tp::SingleArcSimulationResults<double, TIME_TYPE>::getSolutionIsCleared,
                                    get_docstring("SingleArcSimulationResults.solution_is_cleared").c_str() );
 
+    py::class_<
+            tudatpy::ChunkedResultReader,
+            std::shared_ptr<tudatpy::ChunkedResultReader>>(m, "StreamedSimulationResults",
+                                                           get_docstring("StreamedSimulationResults").c_str())
+            .def(py::init<const std::string&>(),
+                 py::arg("file_name"),
+                 get_docstring("StreamedSimulationResults.ctor").c_str() )
+            .def_property_readonly("file_name",
+                                   &tudatpy::ChunkedResultReader::getFileName,
+                                   get_docstring("StreamedSimulationResults.file_name").c_str() )
+            .def_property_readonly("number_of_epochs",
+                                   &tudatpy::ChunkedResultReader::getNumberOfRows,
+                                   get_docstring("StreamedSimulationResults.number_of_epochs").c_str() )
+            .def_property_readonly("state_size",
+                                   &tudatpy::ChunkedResultReader::getStateSize,
+                                   get_docstring("StreamedSimulationResults.state_size").c_str() )
+            .def_property_readonly("dependent_variable_size",
+                                   &tudatpy::ChunkedResultReader::getDependentVariableSize,
+                                   get_docstring("StreamedSimulationResults.dependent_variable_size").c_str() )
+            .def_property_readonly("epochs",
+                                   &tudatpy::readStreamedEpochsToArray,
+                                   get_docstring("StreamedSimulationResults.epochs").c_str() )
+            .def_property_readonly("state_array",
+                                   &getStreamedStateArray,
+                                   get_docstring("StreamedSimulationResults.state_array").c_str() )
+            .def_property_readonly("dependent_variable_array",
+                                   &getStreamedDependentVariableArray,
+                                   get_docstring("StreamedSimulationResults.dependent_variable_array").c_str() )
+            .def("read_state_array",
+                 &readStreamedStateArray,
+                 py::arg("start_index"),
+                 py::arg("end_index"),
+                 get_docstring("StreamedSimulationResults.read_state_array").c_str() )
+            .def("read_dependent_variable_array",
+                 &readStreamedDependentVariableArray,
+                 py::arg("start_index"),
+                 py::arg("end_index"),
+                 get_docstring("StreamedSimulationResults.read_dependent_variable_array").c_str() );
+
     py::class_<
             tp::SingleArcVariationalSimulationResults<double, TIME_TYPE>,
             std::shared_ptr<tp::SingleArcVariationalSimulationResults<double, TIME_TYPE>>,
@@ -14,6 +14,7 @@
 #include <tudat/basics/deprecationWarnings.h>
 
 #include "tudatpy/docstrings.h"
+#include "tudatpy/nativeCallbacks.h"
 #include <tudat/simulation/propagation_setup.h>
 
 #include <pybind11/chrono.h>
@@ -255,6 +256,12 @@ void expose_acceleration_setup(py::module &m) {
           py::arg( "acceleration_function" ),
           get_docstring("custom_acceleration").c_str());
 
+    m.def("custom_acceleration",
+          &tudatpy::nativeCustomAccelerationSettings,
+          py::arg( "acceleration_function" ),
+          py::arg( "user_data" ) = 0,
+          get_docstring("custom_acceleration", 1).c_str());
+
     m.def("direct_tidal_dissipation_acceleration", &tss::directTidalDissipationAcceleration,
           py::arg("k2_love_number"),
           py::arg("time_lag"),
@@ -12,6 +12,7 @@
 #include <tudat/basics/deprecationWarnings.h>
 
 #include "tudatpy/docstrings.h"
+#include "tudatpy/nativeCallbacks.h"
 #include <tudat/simulation/propagation_setup.h>
 
 #include <pybind11/chrono.h>
@@ -668,6 +669,13 @@ namespace dependent_variable {
               py::arg("variable_size"),
               get_docstring("custom_dependent_variable").c_str());
 
+        m.def("custom_dependent_variable",
+              &tudatpy::nativeCustomDependentVariable,
+              py::arg("custom_function"),
+              py::arg("variable_size"),
+              py::arg("user_data") = 0,
+              get_docstring("custom_dependent_variable", 1).c_str());
+
         m.def("custom",
               &tp::customDependentVariableDeprecated,
               py::arg("custom_function"),
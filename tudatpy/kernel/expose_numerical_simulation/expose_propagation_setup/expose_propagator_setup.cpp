@@ -12,6 +12,10 @@
 #include "tudatpy/scalarTypes.h"
 
 #include "tudatpy/docstrings.h"
+#include "tudatpy/eventDetection.h"
+#include "tudatpy/nativeCallbacks.h"
+#include "tudatpy/stepwiseDynamicsSimulator.h"
+#include "tudatpy/terminationExpression.h"
 
 #include <tudat/simulation/propagation_setup.h>
 #include <tudat/astro/propagators/getZeroProperModeRotationalInitialState.h>
@@ -130,6 +134,162 @@ void expose_propagator_setup(py::module &m) {
                           &tp::SingleArcPropagatorProcessingSettings::setResultsSaveFrequencyInSeconds,
                           get_docstring("SingleArcPropagatorProcessingSettings.results_save_frequency_in_seconds").c_str() );
 
+    py::class_<tudatpy::ResultSinkSettings,
+            std::shared_ptr<tudatpy::ResultSinkSettings>>(m, "ResultSinkSettings",
+                                                          get_docstring("ResultSinkSettings").c_str())
+            .def_property_readonly("file_name",
+                                   &tudatpy::ResultSinkSettings::getFileName,
+                                   get_docstring("ResultSinkSettings.file_name").c_str() )
+            .def_property_readonly("steps_per_chunk",
+                                   &tudatpy::ResultSinkSettings::getStepsPerChunk,
+                                   get_docstring("ResultSinkSettings.steps_per_chunk").c_str() );
+
+    m.def("result_sink",
+          &tudatpy::resultSinkSettings,
+          py::arg("file_name"),
+          py::arg("steps_per_chunk") = 4096,
+          get_docstring("result_sink").c_str() );
+
+    py::class_<tudatpy::ProfilingSettings,
+            std::shared_ptr<tudatpy::ProfilingSettings>>(m, "ProfilingSettings",
+                                                         get_docstring("ProfilingSettings").c_str())
+            .def_property_readonly("record_trace_events",
+                                   &tudatpy::ProfilingSettings::getRecordTraceEvents,
+                                   get_docstring("ProfilingSettings.record_trace_events").c_str() )
+            .def_property_readonly("maximum_number_of_trace_events",
+                                   &tudatpy::ProfilingSettings::getMaximumNumberOfTraceEvents,
+                                   get_docstring("ProfilingSettings.maximum_number_of_trace_events").c_str() );
+
+    m.def("profiling",
+          &tudatpy::profilingSettings,
+          py::arg("record_trace_events") = false,
+          py::arg("maximum_number_of_trace_events") = 1000000,
+          get_docstring("profiling").c_str() );
+
+    py::enum_<tudatpy::EventCrossingDirections>(m, "EventCrossingDirections",
+                                                get_docstring("EventCrossingDirections").c_str())
+            .value("any_crossing", tudatpy::EventCrossingDirections::any_crossing,
+                   get_docstring("EventCrossingDirections.any_crossing").c_str())
+            .value("increasing_crossing", tudatpy::EventCrossingDirections::increasing_crossing,
+                   get_docstring("EventCrossingDirections.increasing_crossing").c_str())
+            .value("decreasing_crossing", tudatpy::EventCrossingDirections::decreasing_crossing,
+                   get_docstring("EventCrossingDirections.decreasing_crossing").c_str())
+            .export_values();
+
+    py::class_<tudatpy::EventSettings,
+            std::shared_ptr<tudatpy::EventSettings>>(m, "EventSettings",
+                                                     get_docstring("EventSettings").c_str())
+            .def_property_readonly("event_name",
+                                   &tudatpy::EventSettings::getEventName,
+                                   get_docstring("EventSettings.event_name").c_str() )
+            .def_property_readonly("crossing_direction",
+                                   &tudatpy::EventSettings::getCrossingDirection,
+                                   get_docstring("EventSettings.crossing_direction").c_str() );
+
+    m.def("custom_event",
+          &tudatpy::customEvent,
+          py::arg("event_name"),
+          py::arg("dependent_variables"),
+          py::arg("event_function"),
+          py::arg("crossing_direction") = tudatpy::any_crossing,
+          py::arg("root_finder_settings") = nullptr,
+          get_docstring("custom_event").c_str() );
+
+    m.def("dependent_variable_event",
+          &tudatpy::dependentVariableEvent,
+          py::arg("event_name"),
+          py::arg("dependent_variable"),
+          py::arg("threshold"),
+          py::arg("crossing_direction") = tudatpy::any_crossing,
+          py::arg("component_index") = 0,
+          py::arg("root_finder_settings") = nullptr,
+          get_docstring("dependent_variable_event").c_str() );
+
+    m.def("apsis_event",
+          &tudatpy::apsisEvent,
+          py::arg("event_name"),
+          py::arg("body"),
+          py::arg("central_body"),
+          py::arg("crossing_direction") = tudatpy::any_crossing,
+          py::arg("root_finder_settings") = nullptr,
+          get_docstring("apsis_event").c_str() );
+
+    m.def("node_event",
+          &tudatpy::nodeEvent,
+          py::arg("event_name"),
+          py::arg("body"),
+          py::arg("central_body"),
+          py::arg("crossing_direction") = tudatpy::any_crossing,
+          py::arg("root_finder_settings") = nullptr,
+          get_docstring("node_event").c_str() );
+
+    m.def("eclipse_event",
+          &tudatpy::eclipseEvent,
+          py::arg("event_name"),
+          py::arg("bodies"),
+          py::arg("body"),
+          py::arg("occulting_body"),
+          py::arg("source_body") = "Sun",
+          py::arg("use_umbra") = false,
+          py::arg("crossing_direction") = tudatpy::any_crossing,
+          py::arg("root_finder_settings") = nullptr,
+          get_docstring("eclipse_event").c_str() );
+
+    m.def("elevation_event",
+          &tudatpy::elevationEvent,
+          py::arg("event_name"),
+          py::arg("bodies"),
+          py::arg("body"),
+          py::arg("station_body"),
+          py::arg("station_name"),
+          py::arg("minimum_elevation") = 0.0,
+          py::arg("crossing_direction") = tudatpy::any_crossing,
+          py::arg("root_finder_settings") = nullptr,
+          get_docstring("elevation_event").c_str() );
+
+    py::class_<tudatpy::ExtendedSingleArcPropagatorProcessingSettings,
+            std::shared_ptr<tudatpy::ExtendedSingleArcPropagatorProcessingSettings>,
+            tp::SingleArcPropagatorProcessingSettings >(m, "ExtendedSingleArcPropagatorProcessingSettings",
+                                                        get_docstring("ExtendedSingleArcPropagatorProcessingSettings").c_str())
+            .def(py::init<
+                 const std::shared_ptr<tudatpy::ResultSinkSettings>,
+                 const std::shared_ptr<tudatpy::ProfilingSettings>,
+                 const bool,
+                 const double,
+                 const std::vector<double>&,
+                 const std::vector<std::shared_ptr<tudatpy::EventSettings>>&>(),
+                 py::arg("result_sink") = std::shared_ptr<tudatpy::ResultSinkSettings>( ),
+                 py::arg("profiling") = std::shared_ptr<tudatpy::ProfilingSettings>( ),
+                 py::arg("create_continuous_solution") = false,
+                 py::arg("output_interval") = TUDAT_NAN,
+                 py::arg("output_epochs") = std::vector<double>( ),
+                 py::arg("events") = std::vector<std::shared_ptr<tudatpy::EventSettings>>( ),
+                 get_docstring("ExtendedSingleArcPropagatorProcessingSettings.ctor").c_str() )
+            .def_property("result_sink",
+                          &tudatpy::ExtendedSingleArcPropagatorProcessingSettings::getResultSinkSettings,
+                          &tudatpy::ExtendedSingleArcPropagatorProcessingSettings::setResultSinkSettings,
+                          get_docstring("ExtendedSingleArcPropagatorProcessingSettings.result_sink").c_str() )
+            .def_property("profiling",
+                          &tudatpy::ExtendedSingleArcPropagatorProcessingSettings::getProfilingSettings,
+                          &tudatpy::ExtendedSingleArcPropagatorProcessingSettings::setProfilingSettings,
+                          get_docstring("ExtendedSingleArcPropagatorProcessingSettings.profiling").c_str() )
+            .def_property("create_continuous_solution",
+                          &tudatpy::ExtendedSingleArcPropagatorProcessingSettings::getCreateContinuousSolution,
+                          &tudatpy::ExtendedSingleArcPropagatorProcessingSettings::setCreateContinuousSolution,
+                          get_docstring("ExtendedSingleArcPropagatorProcessingSettings.create_continuous_solution").c_str() )
+            .def_property("output_interval",
+                          &tudatpy::ExtendedSingleArcPropagatorProcessingSettings::getOutputTimeInterval,
+                          &tudatpy::ExtendedSingleArcPropagatorProcessingSettings::setOutputTimeInterval,
+                          get_docstring("ExtendedSingleArcPropagatorProcessingSettings.output_interval").c_str() )
+            .def_property("output_epochs",
+                          &tudatpy::ExtendedSingleArcPropagatorProcessingSettings::getOutputEpochs,
+                          &tudatpy::ExtendedSingleArcPropagatorProcessingSettings::setOutputEpochs,
+                          get_docstring("ExtendedSingleArcPropagatorProcessingSettings.output_epochs").c_str() )
+            .def_property("events",
+                          &tudatpy::ExtendedSingleArcPropagatorProcessingSettings::getEventSettings,
+                          &tudatpy::ExtendedSingleArcPropagatorProcessingSettings::setEventSettings,
+                          get_docstring("ExtendedSingleArcPropagatorProcessingSettings.events").c_str() );
+
     py::class_<tp::MultiArcPropagatorProcessingSettings,
             std::shared_ptr<tp::MultiArcPropagatorProcessingSettings>,
             tp::PropagatorProcessingSettings >(m, "MultiArcPropagatorProcessingSettings",
@@ -464,6 +624,18 @@ void expose_propagator_setup(py::module &m) {
           py::arg("processing_settings") = std::make_shared< tp::SingleArcPropagatorProcessingSettings >( ),
           get_docstring("custom_state").c_str());
 
+    m.def("custom_state",
+          &tudatpy::nativeCustomStatePropagatorSettings<double, TIME_TYPE>,
+          py::arg("state_derivative_function"),
+          py::arg("initial_state"),
+          py::arg("initial_time"),
+          py::arg("integrator_settings"),
+          py::arg("termination_settings"),
+          py::arg("output_variables") = std::vector<std::shared_ptr<tp::SingleDependentVariableSaveSettings> >(),
+          py::arg("processing_settings") = std::make_shared< tp::SingleArcPropagatorProcessingSettings >( ),
+          py::arg("user_data") = 0,
+          get_docstring("custom_state", 1).c_str());
+
 
 
 
@@ -582,12 +754,27 @@ void expose_propagator_setup(py::module &m) {
           py::arg("custom_condition"),
           get_docstring("custom_termination").c_str());
 
+    m.def("custom_termination",
+          &tudatpy::nativeCustomTerminationSettings,
+          py::arg("custom_condition"),
+          py::arg("user_data") = 0,
+          get_docstring("custom_termination", 1).c_str());
+
     m.def("hybrid_termination",
           &tp::propagationHybridTerminationSettings,
           py::arg("termination_settings"),
           py::arg("fulfill_single_condition"),
           get_docstring("hybrid_termination").c_str());
 
+    m.def("expression_termination",
+          &tudatpy::createTerminationSettingsFromExpression,
+          py::arg("expression"),
+          py::arg("variables") = std::map< std::string, std::shared_ptr< tp::SingleDependentVariableSaveSettings > >( ),
+          py::arg("terminate_exactly_on_final_condition") = false,
+          py::arg("termination_root_finder_settings") = nullptr,
+          py::arg("propagate_backwards") = false,
+          get_docstring("expression_termination").c_str());
+
     m.def("add_dependent_variable_settings",
           &tp::addDepedentVariableSettings< double >,
           py::arg("dependent_variable_settings"),
@@ -12,6 +12,8 @@
 //#include "kernel/expose_numerical_simulation/deprecation_support.h"
 
 #include "tudatpy/docstrings.h"
+#include "tudatpy/nativeCallbacks.h"
+#include "tudatpy/piecewisePolynomialThrust.h"
 #include <tudat/simulation/propagation_setup.h>
 
 #include <pybind11/chrono.h>
@@ -87,11 +89,23 @@ void expose_thrust_setup(py::module &m) {
           py::arg("specific_impulse_function"),
           get_docstring("custom_thrust_magnitude").c_str());
 
+    m.def("custom_thrust_magnitude", &tudatpy::nativeCustomThrustMagnitudeSettings,
+          py::arg("thrust_magnitude_function"),
+          py::arg("specific_impulse_function"),
+          py::arg("user_data") = 0,
+          get_docstring("custom_thrust_magnitude", 1).c_str());
+
     m.def("custom_thrust_magnitude_fixed_isp", &tss::fromFunctionThrustMagnitudeFixedIspSettings,
           py::arg("thrust_magnitude_function"),
           py::arg("specific_impulse"),
           get_docstring("custom_thrust_magnitude_fixed_isp").c_str());
 
+    m.def("custom_thrust_magnitude_fixed_isp", &tudatpy::nativeCustomThrustMagnitudeFixedIspSettings,
+          py::arg("thrust_magnitude_function"),
+          py::arg("specific_impulse"),
+          py::arg("user_data") = 0,
+          get_docstring("custom_thrust_magnitude_fixed_isp", 1).c_str());
+
 
     m.def("custom_thrust_acceleration_magnitude", &tss::customThrustAccelerationMagnitudeSettings,
           py::arg("thrust_acceleration_magnitude_function"),
@@ -104,6 +118,64 @@ void expose_thrust_setup(py::module &m) {
           get_docstring("custom_thrust_acceleration_magnitude_fixed_isp").c_str());
 
 
+    // Piecewise polynomial thrust profiles, evaluated without calls to Python
+
+    py::enum_<tudatpy::PolynomialThrustFrames>(m, "PolynomialThrustFrames",
+                                               get_docstring("PolynomialThrustFrames").c_str())
+            .value("inertial_polynomial_thrust_frame", tudatpy::inertial_polynomial_thrust_frame,
+                   get_docstring("PolynomialThrustFrames.inertial_polynomial_thrust_frame").c_str())
+            .value("rsw_polynomial_thrust_frame", tudatpy::rsw_polynomial_thrust_frame,
+                   get_docstring("PolynomialThrustFrames.rsw_polynomial_thrust_frame").c_str())
+            .value("tnw_polynomial_thrust_frame", tudatpy::tnw_polynomial_thrust_frame,
+                   get_docstring("PolynomialThrustFrames.tnw_polynomial_thrust_frame").c_str())
+            .export_values();
+
+    py::class_<
+            tudatpy::PiecewisePolynomialThrustProfile,
+            std::shared_ptr<tudatpy::PiecewisePolynomialThrustProfile>>(m, "PiecewisePolynomialThrustProfile",
+                                                                        get_docstring("PiecewisePolynomialThrustProfile").c_str())
+            .def("thrust_magnitude", &tudatpy::PiecewisePolynomialThrustProfile::getThrustMagnitude,
+                 py::arg("time"),
+                 get_docstring("PiecewisePolynomialThrustProfile.thrust_magnitude").c_str())
+            .def("inertial_thrust_direction", &tudatpy::PiecewisePolynomialThrustProfile::getInertialThrustDirection,
+                 py::arg("time"),
+                 get_docstring("PiecewisePolynomialThrustProfile.inertial_thrust_direction").c_str())
+            .def_property_readonly("thrust_frame", &tudatpy::PiecewisePolynomialThrustProfile::getThrustFrame,
+                                   get_docstring("PiecewisePolynomialThrustProfile.thrust_frame").c_str());
+
+    m.def("piecewise_polynomial_thrust_profile", &tudatpy::createPiecewisePolynomialThrustProfile,
+          py::arg("bodies"),
+          py::arg("body_name"),
+          py::arg("segment_boundaries"),
+          py::arg("segment_coefficients"),
+          py::arg("thrust_frame") = tudatpy::inertial_polynomial_thrust_frame,
+          py::arg("central_body") = "",
+          get_docstring("piecewise_polynomial_thrust_profile").c_str() );
+
+    m.def("piecewise_polynomial_thrust_magnitude",
+          py::overload_cast< const std::shared_ptr< tudatpy::PiecewisePolynomialThrustProfile >, const double >(
+              &tudatpy::piecewisePolynomialThrustMagnitudeSettings ),
+          py::arg("thrust_profile"),
+          py::arg("specific_impulse"),
+          get_docstring("piecewise_polynomial_thrust_magnitude").c_str() );
+
+    m.def("piecewise_polynomial_thrust_magnitude",
+          py::overload_cast< const std::shared_ptr< tudatpy::PiecewisePolynomialThrustProfile >,
+                             const std::map< double, double >&,
+                             const std::shared_ptr< tinterp::InterpolatorSettings > >(
+              &tudatpy::piecewisePolynomialThrustMagnitudeSettings ),
+          py::arg("thrust_profile"),
+          py::arg("specific_impulse_table"),
+          py::arg("interpolator_settings") = nullptr,
+          get_docstring("piecewise_polynomial_thrust_magnitude", 1).c_str() );
+
+    m.def("piecewise_polynomial_thrust_orientation", &tudatpy::piecewisePolynomialThrustRotationSettings,
+          py::arg("thrust_profile"),
+          py::arg("base_frame"),
+          py::arg("target_frame"),
+          get_docstring("piecewise_polynomial_thrust_orientation").c_str() );
+
+
 
 
 
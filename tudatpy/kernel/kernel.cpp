@@ -1,7 +1,12 @@
+#include <cstdlib>
+#include <new>
+
 #include <pybind11/pybind11.h>
 
 #include <tudat/config.hpp>
 
+#include "tudatpy/allocationCounter.h"
+
 #include "expose_astro.h"
 #include "expose_constants.h"
 #include "expose_example.h"
@@ -14,6 +19,44 @@
 
 namespace py = pybind11;
 
+#ifdef TUDATPY_COUNT_ALLOCATIONS
+// Replacement of the global allocation functions, counting the allocations of the kernel module (see allocationCounter.h)
+void* operator new( std::size_t size )
+{
+    tudatpy::countHeapAllocation( );
+    if( void* memory = std::malloc( size > 0 ? size : 1 ) )
+    {
+        return memory;
+    }
+    throw std::bad_alloc( );
+}
+
+void* operator new[]( std::size_t size )
+{
+    return operator new( size );
+}
+
+void operator delete( void* memory ) noexcept
+{
+    std::free( memory );
+}
+
+void operator delete[]( void* memory ) noexcept
+{
+    std::free( memory );
+}
+
+void operator delete( void* memory, std::size_t ) noexcept
+{
+    std::free( memory );
+}
+
+void operator delete[]( void* memory, std::size_t ) noexcept
+{
+    std::free( memory );
+}
+#endif
+
 PYBIND11_MODULE(kernel, m) {
 
     // Disable automatic function signatures in the docs.
@@ -29,6 +72,14 @@ PYBIND11_MODULE(kernel, m) {
     m.attr("_tudat_version_minor") = TUDAT_VERSION_MINOR;
     m.attr("_tudat_version_patch") = TUDAT_VERSION_PATCH;
 
+    // Export the counter of heap allocations (see allocationCounter.h).
+#ifdef TUDATPY_COUNT_ALLOCATIONS
+    // Heap allocations of Eigen are counted through the (failing) check that they are allowed.
+    Eigen::internal::set_is_malloc_allowed(false);
+#endif
+    m.def("_is_heap_allocation_counting_enabled", &tudatpy::isHeapAllocationCountingEnabled);
+    m.def("_get_number_of_heap_allocations", &tudatpy::getNumberOfHeapAllocations);
+
     // math module
     auto utils = m.def_submodule("utils");
     tudatpy::utils::expose_utils(utils);
@@ -35,6 +35,11 @@ def result2array(result: Dict[float, np.array]):
             [t[-1], pos_x[-1], pos_y[-1], pos_z[-1], vel_x[-1], vel_y[-1], vel_z[-1]],
         ])
 
+    For results that are retrieved from a
+    :class:`~tudatpy.numerical_simulation.propagation.SingleArcSimulationResults`
+    object, the ``state_array`` and ``dependent_variable_array`` properties
+    return the same array directly, without first creating the dictionary.
+
     Parameters
     ----------
     result : Dict[float, numpy.ndarray]